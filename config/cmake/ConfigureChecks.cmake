@@ -149,6 +149,17 @@ if (NOT WINDOWS)
   endif (HDF5_ENABLE_DIRECT_VFD)
 endif (NOT WINDOWS)
 
+#-----------------------------------------------------------------------------
+#  Check if the asynchronous I/O driver can use io_uring
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_AIO_VFD "Build the asynchronous I/O Virtual File Driver" OFF)
+  if (HDF5_ENABLE_AIO_VFD)
+    set (${HDF_PREFIX}_HAVE_AIO 1)
+    CHECK_INCLUDE_FILE_CONCAT ("linux/io_uring.h" ${HDF_PREFIX}_HAVE_LINUX_IO_URING_H)
+  endif (HDF5_ENABLE_AIO_VFD)
+endif (NOT WINDOWS)
+
 #-----------------------------------------------------------------------------
 # Check if C has __float128 extension
 #-----------------------------------------------------------------------------
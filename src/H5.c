@@ -387,6 +387,11 @@ H5_term_library(void)
     } /* end if */
 #endif
 
+#ifdef H5_HAVE_THREADSAFE
+    /* Stop the worker pool threads */
+    H5TS_pool_term();
+#endif /* H5_HAVE_THREADSAFE */
+
     /* Free open debugging streams */
     while(H5_debug_g.open_stream) {
         H5_debug_open_stream_t  *tmp_open_stream;
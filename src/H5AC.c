@@ -2390,6 +2390,38 @@ H5AC_retag_copied_metadata(const H5F_t *f, haddr_t metadata_tag)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5AC_retag_copied_metadata */
 
+
+/*------------------------------------------------------------------------------
+ * Function:    H5AC_evict_tagged_metadata()
+ *
+ * Purpose:     Evicts all (clean, unpinned) entries with the specified tag
+ *              from the cache, so that the object they belong to is read
+ *              again from the file on its next access.
+ *
+ * Return:      SUCCEED on success, FAIL otherwise.
+ *
+ *------------------------------------------------------------------------------
+ */
+herr_t
+H5AC_evict_tagged_metadata(H5F_t *f, haddr_t metadata_tag, hid_t dxpl_id)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(H5F_addr_defined(metadata_tag));
+
+    /* Call cache level function to evict metadata entries with specified tag */
+    if(H5C_evict_tagged_entries(f, dxpl_id, metadata_tag) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTEXPUNGE, FAIL, "cannot evict metadata")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_evict_tagged_metadata */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5AC_get_entry_ring
@@ -8166,6 +8166,8 @@ H5C_load_entry(H5F_t *              f,
     void *      thing = NULL;           /* Pointer to thing loaded                  */
     H5C_cache_entry_t *entry = NULL;    /* Alias for thing loaded, as cache entry   */
     size_t      len;                    /* Size of image in file                    */
+    unsigned    tries = 0;              /* # of failed deserialize attempts         */
+    uint64_t    retry_sleep = H5F_SWMR_METADATA_RETRY_SLEEP_MIN; /* Time to wait before re-reading, in ns */
     unsigned    u;                      /* Local index variable                     */
 #ifdef H5_HAVE_PARALLEL
     int         mpi_rank = 0;           /* MPI process rank                         */
@@ -8289,8 +8291,27 @@ H5C_load_entry(H5F_t *              f,
     } /* end if */
 
     /* Deserialize the on-disk image into the native memory form */
-    if(NULL == (thing = type->deserialize(image, len, udata, &dirty)))
-        HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "Can't deserialize image")
+    /* (A SWMR reader can see an image that the writer is part way through
+     *  flushing, which will fail its checksum.  Give the writer time to
+     *  finish, re-read the image and try again a bounded number of times
+     *  before giving up.)
+     */
+    while(NULL == (thing = type->deserialize(image, len, udata, &dirty))) {
+        if(!(H5F_INTENT(f) & H5F_ACC_SWMR_READ) || (type->flags & H5C__CLASS_SKIP_READS)
+                || ++tries >= H5F_SWMR_METADATA_READ_ATTEMPTS)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "Can't deserialize image")
+
+        /* Discard the error from the failed attempt */
+        H5E_clear_stack(NULL);
+
+        /* Back off before the next attempt */
+        H5_nanosleep(retry_sleep);
+        retry_sleep = MIN(2 * retry_sleep, H5F_SWMR_METADATA_RETRY_SLEEP_MAX);
+
+        /* Get the on-disk entry image again */
+        if(H5F_block_read(f, type->mem_type, addr, len, dxpl_id, image) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image")
+    } /* end while */
 
     /* If the client's cache has an image_len callback, check it */
     if(type->image_len) {
@@ -9873,6 +9894,87 @@ H5C_retag_copied_metadata(H5C_t * cache_ptr, haddr_t metadata_tag)
     FUNC_LEAVE_NOAPI_VOID
 } /* H5C_retag_copied_metadata */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C_evict_tagged_entries
+ *
+ * Purpose:     Evicts all entries with the specified tag from the cache,
+ *              so that they are loaded again from the file on their
+ *              next access.
+ *
+ *              Entries which are flush dependency parents are pinned
+ *              until all their children are gone, so the cache index is
+ *              scanned repeatedly, evicting the entries that have become
+ *              unpinned on each pass.
+ *
+ *              Entries with the tag must be clean and not protected, and
+ *              must not be pinned by the client.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_evict_tagged_entries(H5F_t * f, hid_t dxpl_id, haddr_t tag)
+{
+    H5C_t *cache_ptr;                   /* Cache for file */
+    hbool_t evicted_entries_last_pass;  /* Whether the last scan evicted anything */
+    hbool_t pinned_entries_remain;      /* Whether pinned entries were skipped */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr != NULL);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    do {
+        unsigned u;                     /* Local index variable */
+
+        evicted_entries_last_pass = FALSE;
+        pinned_entries_remain = FALSE;
+
+        /* Iterate through entries, evicting those with the specified tag */
+        for(u = 0; u < H5C__HASH_TABLE_LEN; u++) {
+            H5C_cache_entry_t *entry_ptr;       /* Current entry */
+            H5C_cache_entry_t *next_entry_ptr;  /* Next entry in hash bucket */
+
+            next_entry_ptr = cache_ptr->index[u];
+            while(next_entry_ptr != NULL) {
+                entry_ptr = next_entry_ptr;
+                next_entry_ptr = entry_ptr->ht_next;
+
+                if(entry_ptr->tag == tag) {
+                    if(entry_ptr->is_protected)
+                        HGOTO_ERROR(H5E_CACHE, H5E_CANTEXPUNGE, FAIL, "can't evict protected entry")
+                    if(entry_ptr->is_dirty)
+                        HGOTO_ERROR(H5E_CACHE, H5E_CANTEXPUNGE, FAIL, "can't evict dirty entry")
+                    if(entry_ptr->is_pinned)
+                        /* Try again after its flush dependency children are gone */
+                        pinned_entries_remain = TRUE;
+                    else {
+                        /* Evict the entry */
+                        if(H5C__flush_single_entry(f, dxpl_id, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__FLUSH_CLEAR_ONLY_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG, NULL, NULL) < 0)
+                            HGOTO_ERROR(H5E_CACHE, H5E_CANTEXPUNGE, FAIL, "entry eviction failed")
+                        evicted_entries_last_pass = TRUE;
+                    } /* end else */
+                } /* end if */
+            } /* end while */
+        } /* end for */
+    } while(evicted_entries_last_pass && pinned_entries_remain);
+
+    /* Anything still pinned is pinned by a client of the cache */
+    if(pinned_entries_remain)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTEXPUNGE, FAIL, "pinned entries with tag remain in cache")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_evict_tagged_entries */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_get_entry_ring
@@ -802,6 +802,7 @@ H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_id,
     H5P_genplist_t  *plist;     /* Property list */
     H5T_t *type;                /* Datatype */
     H5S_sel_iter_op_t dset_op;  /* Operator for iteration */
+    H5D_read_hold_t hold = {-1, -1};    /* IDs kept open during the reads */
     herr_t ret_value;           /* Return value */
 
     FUNC_ENTER_API(FAIL)
@@ -851,6 +852,10 @@ H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_id,
     if(H5P_set_vlen_mem_manager(plist, H5D__vlen_get_buf_size_alloc, &vlen_bufsize, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINIT, FAIL, "can't set VL data allocation routine")
 
+    /* Keep the dataset open, if other threads may run during the reads */
+    if(H5D__read_hold(dset, dataset_id, &hold) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't hold dataset open")
+
     /* Set the initial number of bytes required */
     vlen_bufsize.size = 0;
 
@@ -866,6 +871,8 @@ H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_id,
         *size = vlen_bufsize.size;
 
 done:
+    if(H5D__read_release(&hold) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset")
     if(fspace && H5S_close(fspace) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataspace")
     if(mspace && H5S_close(mspace) < 0)
@@ -917,3 +924,116 @@ done:
         FUNC_LEAVE_API(ret_value)
 } /* end H5Dset_extent() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Drefresh
+ *
+ * Purpose:	Refreshes all buffers associated with a dataset, so that a
+ *		reader of a file opened with H5F_ACC_SWMR_READ sees the
+ *		dimensions and data most recently flushed by the writer.
+ *		Only the dataset's own metadata is re-read; the file is not
+ *		reopened.  Has no effect on a file opened for writing.
+ *
+ * Return:	Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Drefresh(hid_t dset_id)
+{
+    H5D_t *dset;                /* Dataset for this operation */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", dset_id);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+
+    /* Private function */
+    if(H5D__refresh(dset, H5AC_ind_read_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOAD, FAIL, "unable to refresh dataset")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Drefresh() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dget_chunk_cache_stats
+ *
+ * Purpose:	Retrieves the statistics of a chunked dataset's raw data
+ *		chunk cache since the dataset was opened or the statistics
+ *		were last reset with H5Dreset_chunk_cache_stats(), along
+ *		with the cache's current occupancy, size and replacement
+ *		policy.
+ *
+ *		Reads that bypass the cache, because the cache is disabled
+ *		or a chunk doesn't fit, count as misses.
+ *
+ * Return:	Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunk_cache_stats(hid_t dset_id, H5D_chunk_cache_stats_t *stats)
+{
+    H5D_t *dset;                /* Dataset for this operation */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", dset_id, stats);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(NULL == stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no statistics buffer specified")
+
+    /* Private function */
+    if(H5D__chunk_cache_stats(dset, stats) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk cache statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunk_cache_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dreset_chunk_cache_stats
+ *
+ * Purpose:	Resets the statistics of a chunked dataset's raw data chunk
+ *		cache to zero, e.g. before measuring one phase of an
+ *		application.  The cached chunks are not affected.
+ *
+ * Return:	Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dreset_chunk_cache_stats(hid_t dset_id)
+{
+    H5D_t *dset;                /* Dataset for this operation */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", dset_id);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+    /* Private function */
+    if(H5D__chunk_cache_reset_stats(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't reset chunk cache statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dreset_chunk_cache_stats() */
+
@@ -73,9 +73,18 @@
 #define H5D_CHUNK_GET_NODE_INFO(map, node)  (map->use_single ? map->single_chunk_info : (H5D_chunk_info_t *)H5SL_item(node))
 #define H5D_CHUNK_GET_NEXT_NODE(map, node)  (map->use_single ? (H5SL_node_t *)NULL : H5SL_next(node))
 
+/* Number of chunks handed to each thread when running the filter pipeline
+ * on several threads.  (Bounds the memory held by decoded chunks that
+ * haven't been scattered to the application's buffer yet, and by encoded
+ * copies of dirty chunks that haven't been written yet)
+ */
+#define H5D_CHUNK_FILT_CHUNKS_PER_THREAD        4
+
 /* Sanity check on chunk index types: commonly used by a lot of routines in this file */
 #define H5D_CHUNK_STORAGE_INDEX_CHK(storage)                                                    \
-    HDassert((H5D_CHUNK_IDX_BTREE == storage->idx_type && H5D_COPS_BTREE == storage->ops));
+    HDassert((H5D_CHUNK_IDX_EARRAY == storage->idx_type && H5D_COPS_EARRAY == storage->ops) || \
+            (H5D_CHUNK_IDX_FARRAY == storage->idx_type && H5D_COPS_FARRAY == storage->ops) || \
+            (H5D_CHUNK_IDX_BTREE == storage->idx_type && H5D_COPS_BTREE == storage->ops));
 
 /*
  * Feature: If this constant is defined then every cache preemption and load
@@ -120,6 +129,7 @@ typedef struct H5D_rdcc_ent_t {
     hsize_t     chunk_idx;  	/*index of chunk in dataset             */
     uint8_t	*chunk;		/*the unfiltered chunk data		*/
     unsigned	idx;		/*index in hash table			*/
+    hbool_t     freq;           /*used more than once (ARC policy)      */
     struct H5D_rdcc_ent_t *next;/*next item in doubly-linked list	*/
     struct H5D_rdcc_ent_t *prev;/*previous item in doubly-linked list	*/
     struct H5D_rdcc_ent_t *tmp_next;/*next item in temporary doubly-linked list */
@@ -127,6 +137,47 @@ typedef struct H5D_rdcc_ent_t {
 } H5D_rdcc_ent_t;
 typedef H5D_rdcc_ent_t *H5D_rdcc_ent_ptr_t; /* For free lists */
 
+/* Lists of chunks recently preempted by the ARC policy */
+#define H5D_RDCC_ARC_NONE       0       /* Not found on a ghost list */
+#define H5D_RDCC_ARC_B1         1       /* Preempted after one use */
+#define H5D_RDCC_ARC_B2         2       /* Preempted after several uses */
+
+/* A chunk recently preempted by the ARC policy.  Only the chunk's
+ * coordinates are kept, so ghosts cost a few words each. */
+typedef struct H5D_rdcc_ghost_t {
+    unsigned    ndims;          /*rank of the scaled coordinates        */
+    hsize_t 	scaled[H5O_LAYOUT_NDIMS]; /*scaled chunk 'name' (coordinates) */
+    unsigned    list;           /*H5D_RDCC_ARC_B1 or H5D_RDCC_ARC_B2    */
+    struct H5D_rdcc_ghost_t *next;/*next (newer) ghost on the same list */
+    struct H5D_rdcc_ghost_t *prev;/*previous (older) ghost on the list  */
+} H5D_rdcc_ghost_t;
+
+/* Chunk cache replacement policy class.  Every callback except PRUNE may be
+ * NULL. */
+typedef struct H5D_rdcc_class_t {
+    /* Move a cached chunk which was used again */
+    void (*hit)(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+
+    /* Prepare for adding the chunk at SCALED, before room is made for it */
+    void (*admit)(H5D_rdcc_t *rdcc, unsigned ndims, const hsize_t *scaled);
+
+    /* Preempt chunks until SIZE more bytes fit in the cache */
+    herr_t (*prune)(const H5D_t *dset, hid_t dxpl_id,
+        const H5D_dxpl_cache_t *dxpl_cache, size_t size);
+
+    /* Account for a chunk added to the tail of the cache list */
+    void (*insert)(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+
+    /* Remember a chunk which is about to be preempted */
+    herr_t (*preempt)(H5D_rdcc_t *rdcc, unsigned ndims, const H5D_rdcc_ent_t *ent);
+
+    /* Account for a chunk leaving the cache for any reason */
+    void (*remove)(H5D_rdcc_t *rdcc, const H5D_rdcc_ent_t *ent);
+
+    /* Release the policy's state when the cache is destroyed */
+    herr_t (*dest)(H5D_rdcc_t *rdcc);
+} H5D_rdcc_class_t;
+
 /* Callback info for iteration to prune chunks */
 typedef struct H5D_chunk_it_ud1_t {
     H5D_chunk_common_ud_t common;       /* Common info for B-tree user data (must be first) */
@@ -202,6 +253,35 @@ typedef struct H5D_chunk_file_iter_ud_t {
 #endif /* H5_HAVE_PARALLEL */
 } H5D_chunk_file_iter_ud_t;
 
+/* Information for a chunk read & decoded ahead of the main read loop, or
+ * for a dirty chunk in the cache being encoded for a write */
+typedef struct H5D_chunk_filt_ent_t {
+    const H5D_chunk_info_t *chunk_info; /* Chunk this entry is for (reads) */
+    H5D_rdcc_ent_t *cache_ent;          /* Cache entry this entry is for (writes) */
+    H5D_chunk_ud_t udata;               /* Chunk index info for the chunk */
+    void        *buf;                   /* Chunk buffer (NULL if chunk wasn't prefetched) */
+    size_t      nbytes;                 /* # of valid bytes in buffer */
+    size_t      buf_alloc;              /* Allocated size of buffer */
+    herr_t      status;                 /* Result of running the filter pipeline */
+} H5D_chunk_filt_ent_t;
+
+/* Group of chunks to run through the filter pipeline on several threads */
+typedef struct H5D_chunk_filt_batch_t {
+    const H5O_pline_t *pline;           /* I/O pipeline to apply */
+    unsigned    flags;                  /* Pipeline direction (H5Z_FLAG_REVERSE for reads) */
+    unsigned    nthreads;               /* # of threads to use */
+    H5Z_EDC_t   err_detect;             /* Error detection info */
+    H5Z_cb_t    filter_cb;              /* Filter callback (always empty) */
+    size_t      nalloc;                 /* # of entries allocated */
+    size_t      nents;                  /* # of entries in use */
+    size_t      nbufs;                  /* # of entries with chunks to run through the pipeline */
+    H5D_chunk_filt_ent_t *ents;         /* Array of entries */
+    size_t      next;                   /* Next entry for a thread to claim */
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_simple_t lock;           /* Lock protecting "next" */
+#endif /* H5_HAVE_THREADSAFE */
+} H5D_chunk_filt_batch_t;
+
 #ifdef H5_HAVE_PARALLEL
 /* information to construct a collective I/O operation for filling chunks */
 typedef struct H5D_chunk_coll_info_t {
@@ -261,23 +341,57 @@ static herr_t H5D__chunk_mem_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
 static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled);
 static herr_t H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id,
-    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent, hbool_t reset);
+    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent, hbool_t reset,
+    H5D_chunk_filt_ent_t *filt_ent);
 static herr_t H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent, hbool_t flush);
 static void *H5D__chunk_lock(const H5D_io_info_t *io_info,
-    H5D_chunk_ud_t *udata, hbool_t relax);
+    H5D_chunk_ud_t *udata, hbool_t relax, void *prefetch);
 static herr_t H5D__chunk_unlock(const H5D_io_info_t *io_info,
     const H5D_chunk_ud_t *udata, hbool_t dirty, void *chunk,
     uint32_t naccessed);
 static herr_t H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, size_t size);
+static herr_t H5D__chunk_cache_preempt(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent);
+static void H5D__chunk_cache_w0_hit(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static void H5D__chunk_cache_lru_hit(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static herr_t H5D__chunk_cache_lru_prune(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size);
+static void H5D__chunk_cache_arc_hit(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static void H5D__chunk_cache_arc_admit(H5D_rdcc_t *rdcc, unsigned ndims,
+    const hsize_t *scaled);
+static herr_t H5D__chunk_cache_arc_prune(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size);
+static void H5D__chunk_cache_arc_insert(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static herr_t H5D__chunk_cache_arc_preempt(H5D_rdcc_t *rdcc, unsigned ndims,
+    const H5D_rdcc_ent_t *ent);
+static void H5D__chunk_cache_arc_remove(H5D_rdcc_t *rdcc,
+    const H5D_rdcc_ent_t *ent);
+static herr_t H5D__chunk_cache_arc_dest(H5D_rdcc_t *rdcc);
+static int H5D__chunk_cache_ghost_cmp(const void *_g1, const void *_g2);
+static void H5D__chunk_cache_ghost_remove(H5D_rdcc_t *rdcc,
+    H5D_rdcc_ghost_t *ghost);
+static herr_t H5D__chunk_cache_ghost_free_cb(void *item, void *key,
+    void *op_data);
 static herr_t H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata);
+static hbool_t H5D__chunk_filt_threads_ok(const H5D_io_info_t *io_info);
+static herr_t H5D__chunk_filt_batch_init(const H5D_io_info_t *io_info,
+    unsigned flags, H5D_chunk_filt_batch_t *batch);
+static herr_t H5D__chunk_filt_batch_fill(const H5D_io_info_t *io_info,
+    const H5D_chunk_map_t *fm, H5SL_node_t *chunk_node,
+    H5D_chunk_filt_batch_t *batch);
+static herr_t H5D__chunk_filt_batch_flush(const H5D_io_info_t *io_info,
+    H5D_chunk_filt_batch_t *batch);
+static herr_t H5D__chunk_filt_batch_run(H5D_chunk_filt_batch_t *batch);
+static void H5D__chunk_filt_worker(void *_batch);
 static herr_t H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info,
     const H5F_block_t *old_chunk, H5F_block_t *new_chunk, hbool_t *need_insert,
     hsize_t scaled[]);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset, hid_t dxpl_id,
     H5D_chunk_coll_info_t *chunk_info, size_t chunk_size, const void *fill_buf);
+static int H5D__chunk_cmp_addr(const void *addr1, const void *addr2);
 #endif /* H5_HAVE_PARALLEL */
 
 /*********************/
@@ -339,6 +453,40 @@ H5FL_DEFINE(H5D_chunk_info_t);
 /* Declare a free list to manage the chunk sequence information */
 H5FL_BLK_DEFINE_STATIC(chunk);
 
+/* Declare a free list to manage H5D_rdcc_ghost_t objects */
+H5FL_DEFINE_STATIC(H5D_rdcc_ghost_t);
+
+/* Chunk cache replacement policy classes, indexed by H5D_chunk_cache_policy_t */
+static const H5D_rdcc_class_t H5D_rdcc_class_g[H5D_CHUNK_CACHE_POLICY_NTYPES] = {
+    {   /* H5D_CHUNK_CACHE_POLICY_W0 */
+        H5D__chunk_cache_w0_hit,
+        NULL,
+        H5D__chunk_cache_prune,
+        NULL,
+        NULL,
+        NULL,
+        NULL
+    },
+    {   /* H5D_CHUNK_CACHE_POLICY_LRU */
+        H5D__chunk_cache_lru_hit,
+        NULL,
+        H5D__chunk_cache_lru_prune,
+        NULL,
+        NULL,
+        NULL,
+        NULL
+    },
+    {   /* H5D_CHUNK_CACHE_POLICY_ARC */
+        H5D__chunk_cache_arc_hit,
+        H5D__chunk_cache_arc_admit,
+        H5D__chunk_cache_arc_prune,
+        H5D__chunk_cache_arc_insert,
+        H5D__chunk_cache_arc_preempt,
+        H5D__chunk_cache_arc_remove,
+        H5D__chunk_cache_arc_dest
+    }
+};
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_direct_write
@@ -494,11 +642,17 @@ H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndims,
     for(u = 0, layout->nchunks = 1, layout->max_nchunks = 1; u < ndims; u++) {
         /* Round up to the next integer # of chunks, to accomodate partial chunks */
 	layout->chunks[u] = ((curr_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
-	layout->max_chunks[u] = ((max_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
+        if(H5S_UNLIMITED == max_dims[u])
+            layout->max_chunks[u] = H5S_UNLIMITED;
+        else
+            layout->max_chunks[u] = ((max_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
 
         /* Accumulate the # of chunks */
 	layout->nchunks *= layout->chunks[u];
-	layout->max_nchunks *= layout->max_chunks[u];
+        if(H5S_UNLIMITED == layout->max_chunks[u])
+            layout->max_nchunks = H5S_UNLIMITED;
+        else if(H5S_UNLIMITED != layout->max_nchunks)
+            layout->max_nchunks *= layout->max_chunks[u];
     } /* end for */
 
     /* Get the "down" sizes for each dimension */
@@ -560,7 +714,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_construct(H5F_t H5_ATTR_UNUSED *f, H5D_t *dset)
+H5D__chunk_construct(H5F_t *f, H5D_t *dset)
 {
     const H5T_t *type = dset->shared->type;      /* Convenience pointer to dataset's datatype */
     uint64_t chunk_size;        /* Size of chunk in bytes */
@@ -620,6 +774,65 @@ H5D__chunk_construct(H5F_t H5_ATTR_UNUSED *f, H5D_t *dset)
     /* Retain computed chunk size */
     H5_CHECKED_ASSIGN(dset->shared->layout.u.chunk.size, uint32_t, chunk_size, uint64_t);
 
+    /* Start with the v1 B-tree index (the layout may have been copied from
+     *  a dataset using another index type)
+     */
+    dset->shared->layout.version = H5O_LAYOUT_VERSION_DEFAULT;
+    dset->shared->layout.storage.u.chunk.idx_type = H5D_CHUNK_IDX_BTREE;
+    dset->shared->layout.storage.u.chunk.ops = H5D_COPS_BTREE;
+
+    /* Choose a more efficient chunk index, if the file format allows it */
+    /* (older versions of the library can't read the newer layout message) */
+    if(H5F_USE_LATEST_FORMAT(f)) {
+        unsigned unlim_count = 0;       /* Number of unlimited dimensions */
+        hbool_t single = TRUE;          /* Fixed dimensions all have non-zero max. size */
+
+        /* Count the unlimited dimensions */
+        for(u = 0; u < dset->shared->ndims; u++) {
+            if(H5S_UNLIMITED == dset->shared->max_dims[u])
+                unlim_count++;
+            else if(0 == dset->shared->max_dims[u])
+                single = FALSE;
+        } /* end for */
+
+        /* The v1 B-tree index isn't flushed in dependency order, so a SWMR
+         *  reader could follow a pointer to a node not yet on disk */
+        if(unlim_count > 1 && (H5F_INTENT(f) & H5F_ACC_SWMR_WRITE))
+            HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "SWMR writing is not supported for datasets with more than one unlimited dimension")
+
+        if(1 == unlim_count) {
+            /* Use extensible array index for one unlimited dimension */
+            dset->shared->layout.storage.u.chunk.idx_type = H5D_CHUNK_IDX_EARRAY;
+            dset->shared->layout.storage.u.chunk.ops = H5D_COPS_EARRAY;
+            dset->shared->layout.u.chunk.u.earray.max_nelmts_bits = H5D_EARRAY_MAX_NELMTS_BITS;
+            dset->shared->layout.u.chunk.u.earray.idx_blk_elmts = H5D_EARRAY_IDX_BLK_ELMTS;
+            dset->shared->layout.u.chunk.u.earray.sup_blk_min_data_ptrs = H5D_EARRAY_SUP_BLK_MIN_DATA_PTRS;
+            dset->shared->layout.u.chunk.u.earray.data_blk_min_elmts = H5D_EARRAY_DATA_BLK_MIN_ELMTS;
+            dset->shared->layout.u.chunk.u.earray.max_dblk_page_nelmts_bits = H5D_EARRAY_MAX_DBLOCK_PAGE_NELMTS_BITS;
+        } /* end if */
+        else if(0 == unlim_count && single) {
+            /* Use fixed array index when the max. # of chunks is known */
+            dset->shared->layout.storage.u.chunk.idx_type = H5D_CHUNK_IDX_FARRAY;
+            dset->shared->layout.storage.u.chunk.ops = H5D_COPS_FARRAY;
+            dset->shared->layout.u.chunk.u.farray.max_dblk_page_nelmts_bits = H5D_FARRAY_MAX_DBLK_PAGE_NELMTS_BITS;
+        } /* end if */
+
+        /* The new indices require the version 4 layout message */
+        if(H5D_CHUNK_IDX_BTREE != dset->shared->layout.storage.u.chunk.idx_type) {
+            unsigned enc_bytes;         /* Bytes needed to encode a dimension */
+
+            dset->shared->layout.version = H5O_LAYOUT_VERSION_4;
+
+            /* Compute the bytes needed to encode the chunk dimensions */
+            dset->shared->layout.u.chunk.enc_bytes_per_dim = 1;
+            for(u = 0; u < dset->shared->layout.u.chunk.ndims; u++) {
+                enc_bytes = (H5VM_log2_gen((uint64_t)dset->shared->layout.u.chunk.dim[u]) + 8) / 8;
+                if(enc_bytes > dset->shared->layout.u.chunk.enc_bytes_per_dim)
+                    dset->shared->layout.u.chunk.enc_bytes_per_dim = enc_bytes;
+            } /* end for */
+        } /* end if */
+    } /* end if */
+
     /* Reset address and pointer of the array struct for the chunked storage index */
     if(H5D_chunk_idx_reset(&dset->shared->layout.storage.u.chunk, TRUE) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to reset chunked storage index")
@@ -677,6 +890,21 @@ H5D__chunk_init(H5F_t *f, hid_t dxpl_id, const H5D_t *dset, hid_t dapl_id)
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    if(H5P_get(dapl, H5D_ACS_CHUNK_CACHE_POLICY_NAME, &rdcc->policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get chunk cache policy")
+    HDassert(rdcc->policy >= H5D_CHUNK_CACHE_POLICY_W0 && rdcc->policy < H5D_CHUNK_CACHE_POLICY_NTYPES);
+    rdcc->cls = &H5D_rdcc_class_g[rdcc->policy];
+
+#ifdef H5_HAVE_PARALLEL
+    /* Filtered chunks are rewritten by whichever process owns them during
+     *  a collective write, so copies cached by the other processes would go
+     *  stale.  Bypass the cache for these datasets when writing in parallel.
+     */
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) && (H5F_ACC_RDWR & H5F_INTENT(f))
+            && dset->shared->dcpl_cache.pline.nused > 0)
+        rdcc->nslots = 0;
+#endif /* H5_HAVE_PARALLEL */
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if(!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
@@ -687,6 +915,16 @@ H5D__chunk_init(H5F_t *f, hid_t dxpl_id, const H5D_t *dset, hid_t dapl_id)
 
         /* Reset any cached chunk info for this dataset */
         H5D__chunk_cinfo_cache_reset(&(rdcc->last));
+
+        /* Set up the ghost lists of the adaptive policy */
+        if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy) {
+            if(NULL == (rdcc->arc.ghosts = H5SL_create(H5SL_TYPE_GENERIC, H5D__chunk_cache_ghost_cmp)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for preempted chunks")
+
+            /* The policy counts chunks, not bytes */
+            rdcc->arc.capacity = MIN(rdcc->nslots, rdcc->nbytes_max / MAX(dset->shared->layout.u.chunk.size, 1));
+            rdcc->arc.capacity = MAX(rdcc->arc.capacity, 1);
+        } /* end if */
     } /* end else */
 
     /* Compute scaled dimension info, if dataset dims > 1 */
@@ -783,6 +1021,9 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     unsigned f_ndims;           /* The number of dimensions of the file's dataspace */
     int sm_ndims;               /* The number of dimensions of the memory buffer's dataspace (signed) */
     H5SL_node_t *curr_node;     /* Current node in skip list */
+    H5SL_t **sel_chunks;        /* Where the chunk selection skip list is kept */
+    H5S_t **single_space;       /* Where the single chunk dataspace is kept */
+    H5D_chunk_info_t **single_chunk_info;   /* Where the single chunk's info is kept */
     char bogus;                 /* "bogus" buffer to pass to selection iterator */
     unsigned u;                 /* Local index variable */
     herr_t ret_value = SUCCEED;	/* Return value		*/
@@ -834,6 +1075,26 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     fm->last_index = (hsize_t)-1;
     fm->last_chunk_info = NULL;
 
+    /* Use the dataset's cached selection info, unless another I/O operation
+     * on the dataset is still using it (while it waits for the API lock
+     * during a raw data read, for example), in which case build our own */
+    fm->sel_chunks = NULL;
+    fm->single_space = NULL;
+    fm->single_chunk_info = NULL;
+    if(dataset->shared->cache.chunk.sel_busy) {
+        fm->sel_busy = NULL;
+        sel_chunks = &fm->sel_chunks;
+        single_space = &fm->single_space;
+        single_chunk_info = &fm->single_chunk_info;
+    } /* end if */
+    else {
+        fm->sel_busy = &dataset->shared->cache.chunk.sel_busy;
+        *fm->sel_busy = TRUE;
+        sel_chunks = &dataset->shared->cache.chunk.sel_chunks;
+        single_space = &dataset->shared->cache.chunk.single_space;
+        single_chunk_info = &dataset->shared->cache.chunk.single_chunk_info;
+    } /* end else */
+
     /* Point at the dataspaces */
     fm->file_space = file_space;
     fm->mem_space = mem_space;
@@ -846,32 +1107,31 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
 #endif /* H5_HAVE_PARALLEL */
             && H5S_SEL_ALL != H5S_GET_SELECT_TYPE(file_space)) {
         /* Initialize skip list for chunk selections */
-        fm->sel_chunks = NULL;
         fm->use_single = TRUE;
 
         /* Initialize single chunk dataspace */
-        if(NULL == dataset->shared->cache.chunk.single_space) {
+        if(NULL == *single_space) {
             /* Make a copy of the dataspace for the dataset */
-            if((dataset->shared->cache.chunk.single_space = H5S_copy(file_space, TRUE, FALSE)) == NULL)
+            if((*single_space = H5S_copy(file_space, TRUE, FALSE)) == NULL)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
 
             /* Resize chunk's dataspace dimensions to size of chunk */
-            if(H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
+            if(H5S_set_extent_real(*single_space, fm->chunk_dim) < 0)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
 
             /* Set the single chunk dataspace to 'all' selection */
-            if(H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
+            if(H5S_select_all(*single_space, TRUE) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
         } /* end if */
-        fm->single_space = dataset->shared->cache.chunk.single_space;
+        fm->single_space = *single_space;
         HDassert(fm->single_space);
 
         /* Allocate the single chunk information */
-        if(NULL == dataset->shared->cache.chunk.single_chunk_info) {
-            if(NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+        if(NULL == *single_chunk_info) {
+            if(NULL == (*single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
         } /* end if */
-        fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
+        fm->single_chunk_info = *single_chunk_info;
         HDassert(fm->single_chunk_info);
 
         /* Reset chunk template information */
@@ -885,11 +1145,11 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         hbool_t sel_hyper_flag;         /* Whether file selection is a hyperslab */
 
         /* Initialize skip list for chunk selections */
-        if(NULL == dataset->shared->cache.chunk.sel_chunks) {
-            if(NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+        if(NULL == *sel_chunks) {
+            if(NULL == (*sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
         } /* end if */
-        fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
+        fm->sel_chunks = *sel_chunks;
         HDassert(fm->sel_chunks);
 
         /* We are not using single element mode */
@@ -1871,6 +2131,11 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
     hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
+    H5D_chunk_filt_batch_t filt_batch;  /* Chunks decoded ahead on several threads */
+    hbool_t     use_filt_threads;       /* Whether to run the filter pipeline on several threads */
+    size_t      filt_curr = 0;          /* Current entry in batch of decoded chunks */
+    hbool_t     defer_reads;            /* Whether chunks read straight from the file are read at once */
+    H5D_contig_vector_ud_t vec;         /* Blocks of the chunks read straight from the file */
     herr_t	ret_value = SUCCEED;	/*return value		*/
 
     FUNC_ENTER_STATIC
@@ -1881,6 +2146,15 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     HDassert(type_info);
     HDassert(fm);
 
+    /* When no conversion is needed and the driver takes lists of blocks,
+     * the reads of all chunks that bypass the chunk cache are gathered and
+     * handed to the driver together, after the other chunks are done (or,
+     * in a multi-dataset read, along with the blocks of the other datasets) */
+    defer_reads = (io_info->io_ops.single_read == H5D__select_read
+            && type_info->is_conv_noop && type_info->is_xform_noop
+            && H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_VECTOR_IO));
+    HDmemset(&vec, 0, sizeof(vec));
+
     /* Set up "nonexistent" I/O info object */
     HDmemcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
     nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
@@ -1919,18 +2193,46 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
             skip_missing_chunks = TRUE;
     }
 
+    /* Set up for running the filter pipeline on several threads, if requested */
+    HDmemset(&filt_batch, 0, sizeof(filt_batch));
+    if((use_filt_threads = H5D__chunk_filt_threads_ok(io_info)))
+        if(H5D__chunk_filt_batch_init(io_info, H5Z_FLAG_REVERSE, &filt_batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up filter batch")
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while(chunk_node) {
         H5D_chunk_info_t *chunk_info;   /* Chunk information */
         H5D_chunk_ud_t udata;		/* Chunk index pass-through	*/
+        H5D_chunk_filt_ent_t *filt_ent = NULL;  /* Chunk decoded ahead of time */
 
         /* Get the actual chunk information from the skip list node */
         chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
 
+        if(use_filt_threads) {
+            /* Read & decode the next group of chunks, when the current group is used up */
+            if(filt_curr == filt_batch.nents) {
+                if(H5D__chunk_filt_batch_fill(io_info, fm, chunk_node, &filt_batch) < 0)
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+                filt_curr = 0;
+            } /* end if */
+
+            /* Check for a chunk that was decoded ahead of time */
+            HDassert(filt_batch.ents[filt_curr].chunk_info == chunk_info);
+            if(filt_batch.ents[filt_curr].buf) {
+                filt_ent = &filt_batch.ents[filt_curr];
+                udata = filt_ent->udata;
+            } /* end if */
+            filt_curr++;
+        } /* end if */
+
         /* Get the info for the chunk in the file */
-        if(H5D__chunk_lookup(io_info->dset, io_info->md_dxpl_id, chunk_info->scaled, &udata) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        /* (Chunks that were in the cache when the batch was read may have been
+         *      evicted since, so look them up again)
+         */
+        if(NULL == filt_ent)
+            if(H5D__chunk_lookup(io_info->dset, io_info->md_dxpl_id, chunk_info->scaled, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
         /* Sanity check */
         HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) || 
@@ -1957,7 +2259,12 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
 
                 /* Lock the chunk into the cache */
-                if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE)))
+                chunk = H5D__chunk_lock(io_info, &udata, FALSE, filt_ent ? filt_ent->buf : NULL);
+
+                /* The chunk lock routine now owns any prefetched chunk buffer */
+                if(filt_ent)
+                    filt_ent->buf = NULL;
+                if(NULL == chunk)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
                 /* Set up the storage buffer information for this chunk */
@@ -1972,14 +2279,24 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
 
                 /* Point I/O info at temporary I/O info for this chunk */
                 chk_io_info = &ctg_io_info;
+
+                /* Count the uncached read as a miss */
+                io_info->dset->shared->cache.chunk.stats.nmisses++;
+                io_info->dset->shared->cache.chunk.stats.nbytes_read += chunk_info->chunk_points * type_info->src_type_size;
             } /* end else if */
             else {
                 /* Point I/O info at "nonexistent" I/O info for this chunk */
                 chk_io_info = &nonexistent_io_info;
             } /* end else */
 
-            /* Perform the actual read operation */
-            if((io_info->io_ops.single_read)(chk_io_info, type_info,
+            /* Perform the actual read operation, or queue it */
+            if(defer_reads && chk_io_info == &ctg_io_info) {
+                if(H5D__contig_vector_add(chk_io_info, type_info->src_type_size,
+                        (size_t)chunk_info->chunk_points, chunk_info->fspace, chunk_info->mspace,
+                        io_info->multi ? &io_info->multi->vec : &vec) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't build block list")
+            } /* end if */
+            else if((io_info->io_ops.single_read)(chk_io_info, type_info,
                     (hsize_t)chunk_info->chunk_points, chunk_info->fspace, chunk_info->mspace) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
 
@@ -1992,10 +2309,387 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
         chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
     } /* end while */
 
+    /* Read the queued chunks */
+    if(H5D__contig_vector_read(&ctg_io_info, &vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+
 done:
+    /* Release the blocks of queued chunks, after a failure */
+    H5MM_xfree(vec.addrs);
+    H5MM_xfree(vec.sizes);
+    H5MM_xfree(vec.rbufs);
+
+    /* Release any chunks decoded ahead of time that weren't used */
+    if(filt_batch.ents) {
+        size_t u;       /* Local index variable */
+
+        for(u = 0; u < filt_batch.nents; u++)
+            if(filt_batch.ents[u].buf)
+                filt_batch.ents[u].buf = H5D__chunk_mem_xfree(filt_batch.ents[u].buf, filt_batch.pline);
+        filt_batch.ents = (H5D_chunk_filt_ent_t *)H5MM_xfree(filt_batch.ents);
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_filt_threads_ok
+ *
+ * Purpose:	Decide whether the chunks touched by an I/O operation can
+ *		be run through the filter pipeline on several threads.
+ *
+ *		This requires a thread-safe build, more than one thread
+ *		requested in the DXPL, no filter callback (which would be
+ *		invoked from the worker threads) and a pipeline made only of
+ *		the library's own filters, all of which are already
+ *		registered.  Third-party filters aren't known to be safe to
+ *		call concurrently.
+ *
+ * Return:	TRUE/FALSE (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_filt_threads_ok(const H5D_io_info_t *io_info)
+{
+    const H5O_pline_t *pline;           /* I/O pipeline info */
+    hbool_t     ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(io_info->dxpl_cache);
+
+    pline = &(io_info->dset->shared->dcpl_cache.pline);
+    if(io_info->dxpl_cache->filter_nthreads > 1 && pline->nused > 0
+            && NULL == io_info->dxpl_cache->filter_cb.func) {
+#ifdef H5_HAVE_THREADSAFE
+        size_t      u;                  /* Local index variable */
+
+        ret_value = TRUE;
+        for(u = 0; u < pline->nused; u++)
+            if(pline->filter[u].id >= H5Z_FILTER_RESERVED
+                    || H5Z_filter_avail(pline->filter[u].id) <= 0) {
+                ret_value = FALSE;
+                break;
+            } /* end if */
+#endif /* H5_HAVE_THREADSAFE */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filt_threads_ok() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_filt_batch_init
+ *
+ * Purpose:	Set up a batch for running the filter pipeline in direction
+ *		FLAGS over groups of chunks, on the number of threads in the
+ *		DXPL.  The caller must free the batch's entries.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_filt_batch_init(const H5D_io_info_t *io_info, unsigned flags,
+    H5D_chunk_filt_batch_t *batch)
+{
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(batch);
+
+    batch->pline = &(io_info->dset->shared->dcpl_cache.pline);
+    batch->flags = flags;
+#ifdef H5_HAVE_THREADSAFE
+    batch->nthreads = MIN(io_info->dxpl_cache->filter_nthreads, H5TS_POOL_MAX_THREADS + 1);
+#else /* H5_HAVE_THREADSAFE */
+    batch->nthreads = 1;
+#endif /* H5_HAVE_THREADSAFE */
+    batch->err_detect = io_info->dxpl_cache->err_detect;
+    batch->nalloc = (size_t)batch->nthreads * H5D_CHUNK_FILT_CHUNKS_PER_THREAD;
+    batch->nents = 0;
+    if(NULL == (batch->ents = (H5D_chunk_filt_ent_t *)H5MM_calloc(batch->nalloc * sizeof(H5D_chunk_filt_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter batch")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filt_batch_init() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_filt_batch_fill
+ *
+ * Purpose:	Look up the next group of chunks for a read, starting at
+ *		CHUNK_NODE, read the raw data for the ones that aren't in
+ *		the chunk cache with one vector read and run the filter
+ *		pipeline over them on the number of threads in the DXPL.
+ *
+ *		Every chunk in the group gets an entry.  Entries for chunks
+ *		that were decoded hold the buffer with the decoded chunk,
+ *		which is handed to H5D__chunk_lock() in place of reading it
+ *		there, along with the chunk's index information, so the main
+ *		read loop doesn't need to look it up again.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_filt_batch_fill(const H5D_io_info_t *io_info, const H5D_chunk_map_t *fm,
+    H5SL_node_t *chunk_node, H5D_chunk_filt_batch_t *batch)
+{
+    const H5D_t *dset = io_info->dset;  /* Local pointer to the dataset info */
+    haddr_t     *addrs = NULL;          /* File addresses of chunks to read */
+    size_t      *sizes = NULL;          /* Sizes of chunks to read */
+    void        **bufs = NULL;          /* Buffers for chunks to read */
+#ifndef NDEBUG
+    size_t      u;                      /* Local index variable */
+#endif /* NDEBUG */
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(fm);
+    HDassert(chunk_node);
+    HDassert(batch);
+    HDassert(batch->ents);
+    HDassert(batch->flags & H5Z_FLAG_REVERSE);
+#ifndef NDEBUG
+    for(u = 0; u < batch->nents; u++)
+        HDassert(NULL == batch->ents[u].buf);
+#endif /* NDEBUG */
+
+    /* Allocate the block list for reading the chunks */
+    if(NULL == (addrs = (haddr_t *)H5MM_malloc(batch->nalloc * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block address list")
+    if(NULL == (sizes = (size_t *)H5MM_malloc(batch->nalloc * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block size list")
+    if(NULL == (bufs = (void **)H5MM_malloc(batch->nalloc * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block buffer list")
+
+    /* Look up the chunks and list the raw data for ones not in the cache */
+    batch->nents = 0;
+    batch->nbufs = 0;
+    while(chunk_node && batch->nents < batch->nalloc) {
+        H5D_chunk_filt_ent_t *ent = &batch->ents[batch->nents];
+
+        /* Get the chunk's information & its info in the file */
+        ent->chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+        if(H5D__chunk_lookup(dset, io_info->md_dxpl_id, ent->chunk_info->scaled, &ent->udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        batch->nents++;
+
+        if(UINT_MAX == ent->udata.idx_hint && H5F_addr_defined(ent->udata.chunk_block.offset)) {
+            H5_CHECKED_ASSIGN(ent->nbytes, size_t, ent->udata.chunk_block.length, hsize_t);
+            ent->buf_alloc = ent->nbytes;
+            ent->status = SUCCEED;
+            if(NULL == (ent->buf = H5D__chunk_mem_alloc(ent->nbytes, batch->pline)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+            addrs[batch->nbufs] = ent->udata.chunk_block.offset;
+            sizes[batch->nbufs] = ent->nbytes;
+            bufs[batch->nbufs] = ent->buf;
+            batch->nbufs++;
+        } /* end if */
+
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
+
+    /* Read the chunks all at once */
+    if(batch->nbufs > 0 && H5F_block_read_vector(dset->oloc.file, batch->nbufs, addrs, sizes, io_info->raw_dxpl_id, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+    /* Run the filter pipeline over the chunks read */
+    if(H5D__chunk_filt_batch_run(batch) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+
+done:
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filt_batch_fill() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_filt_batch_flush
+ *
+ * Purpose:	Write all the dirty chunks in the dataset's chunk cache,
+ *		a group at a time: copies of the chunks in a group are run
+ *		through the filter pipeline on the number of threads in the
+ *		DXPL, then the encoded chunks are written one by one.  The
+ *		chunks stay in the cache, clean.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_filt_batch_flush(const H5D_io_info_t *io_info, H5D_chunk_filt_batch_t *batch)
+{
+    const H5D_t *dset = io_info->dset;  /* Local pointer to the dataset info */
+    H5D_rdcc_ent_t *ent;                /* Current cache entry */
+    size_t      chunk_size;             /* Size of a chunk in memory */
+    size_t      u;                      /* Local index variable */
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(batch);
+    HDassert(batch->ents);
+    HDassert(!(batch->flags & H5Z_FLAG_REVERSE));
+
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+
+    ent = dset->shared->cache.chunk.head;
+    while(ent) {
+        /* Copy the next group of dirty chunks */
+        batch->nents = 0;
+        batch->nbufs = 0;
+        for(; ent && batch->nents < batch->nalloc; ent = ent->next)
+            if(ent->dirty && !ent->locked) {
+                H5D_chunk_filt_ent_t *fent = &batch->ents[batch->nents++];
+
+                fent->cache_ent = ent;
+                fent->udata.filter_mask = 0;
+                fent->nbytes = chunk_size;
+                fent->buf_alloc = chunk_size;
+                fent->status = SUCCEED;
+                if(NULL == (fent->buf = H5MM_malloc(chunk_size)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                HDmemcpy(fent->buf, ent->chunk, chunk_size);
+                batch->nbufs++;
+            } /* end if */
+
+        /* Encode the chunks */
+        if(H5D__chunk_filt_batch_run(batch) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
+
+        /* Write them */
+        for(u = 0; u < batch->nents; u++)
+            if(H5D__chunk_flush_entry(dset, io_info->md_dxpl_id, io_info->dxpl_cache, batch->ents[u].cache_ent, FALSE, &batch->ents[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+    } /* end while */
+
+done:
+    /* Release any encoded chunks that weren't written */
+    for(u = 0; u < batch->nents; u++)
+        batch->ents[u].buf = H5MM_xfree(batch->ents[u].buf);
+    batch->nents = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filt_batch_flush() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_filt_batch_run
+ *
+ * Purpose:	Run the filter pipeline over the entries of a batch that
+ *		hold a chunk, on the calling thread and threads from the
+ *		library's worker pool.
+ *
+ *		The worker threads only record a status in each entry; an
+ *		error is pushed here, once they have all finished.  If no
+ *		worker threads can be had, the calling thread runs the
+ *		pipeline over all the entries itself.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_filt_batch_run(H5D_chunk_filt_batch_t *batch)
+{
+    size_t      u;                      /* Local index variable */
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(batch);
+
+    if(batch->nbufs > 0) {
+        batch->next = 0;
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_init(&batch->lock);
+        (void)H5TS_pool_run((unsigned)MIN(batch->nthreads, batch->nbufs), H5D__chunk_filt_worker, batch);
+        H5TS_mutex_destroy(&batch->lock);
+#else /* H5_HAVE_THREADSAFE */
+        H5D__chunk_filt_worker(batch);
+#endif /* H5_HAVE_THREADSAFE */
+
+        /* Check for errors from the filter pipeline */
+        for(u = 0; u < batch->nents; u++)
+            if(batch->ents[u].buf && batch->ents[u].status < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "filter pipeline failed")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filt_batch_run() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_filt_worker
+ *
+ * Purpose:	Thread routine for filtering chunks: repeatedly claims the
+ *		next entry in a batch that holds a chunk and runs the filter
+ *		pipeline over it, until there are none left.
+ *
+ *		Errors are only recorded in each entry's status, for the
+ *		calling thread to report.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_filt_worker(void *_batch)
+{
+    H5D_chunk_filt_batch_t *batch = (H5D_chunk_filt_batch_t *)_batch;
+
+    /* No FUNC_ENTER, this routine runs outside the library's API lock */
+
+    for(;;) {
+        H5D_chunk_filt_ent_t *ent;      /* Entry to filter */
+        size_t idx;                     /* Index of entry to filter */
+
+        /* Claim the next entry with a chunk buffer */
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_lock_simple(&batch->lock);
+#endif /* H5_HAVE_THREADSAFE */
+        while(batch->next < batch->nents && NULL == batch->ents[batch->next].buf)
+            batch->next++;
+        idx = batch->next++;
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_unlock_simple(&batch->lock);
+#endif /* H5_HAVE_THREADSAFE */
+        if(idx >= batch->nents)
+            break;
+
+        ent = &batch->ents[idx];
+        ent->status = H5Z_pipeline(batch->pline, batch->flags, &(ent->udata.filter_mask),
+                batch->err_detect, batch->filter_cb, &ent->nbytes, &ent->buf_alloc, &ent->buf);
+    } /* end for */
+} /* end H5D__chunk_filt_worker() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_write
@@ -2021,6 +2715,9 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
     hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t    dst_accessed_bytes = 0; /* Total accessed size in a chunk */
+    H5D_chunk_filt_batch_t filt_batch;  /* Dirty chunks encoded on several threads */
+    hbool_t     use_filt_threads;       /* Whether to run the filter pipeline on several threads */
+    size_t      filt_ndirty = 0;        /* # of chunks dirtied since the cache was last flushed */
     herr_t	ret_value = SUCCEED;	/* Return value		*/
 
     FUNC_ENTER_STATIC
@@ -2047,6 +2744,12 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     /* Initialize temporary compact storage info */
     cpt_store.compact.dirty = &cpt_dirty;
 
+    /* Set up for running the filter pipeline on several threads, if requested */
+    HDmemset(&filt_batch, 0, sizeof(filt_batch));
+    if((use_filt_threads = H5D__chunk_filt_threads_ok(io_info)))
+        if(H5D__chunk_filt_batch_init(io_info, 0, &filt_batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up filter batch")
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while(chunk_node) {
@@ -2091,7 +2794,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 entire_chunk = FALSE;
 
             /* Lock the chunk into the cache */
-            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk)))
+            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, NULL)))
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
             /* Set up the storage buffer information for this chunk */
@@ -2133,6 +2836,9 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
 
             /* Point I/O info at temporary I/O info for this chunk */
             chk_io_info = &ctg_io_info;
+
+            /* Count the bytes written around the cache */
+            io_info->dset->shared->cache.chunk.stats.nbytes_written += chunk_info->chunk_points * type_info->dst_type_size;
         } /* end else */
 
         /* Perform the actual write operation */
@@ -2144,6 +2850,14 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
 	if(chunk) {
 	    if(H5D__chunk_unlock(io_info, &udata, TRUE, chunk, dst_accessed_bytes) < 0)
 		HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+
+            /* Encode & write a group of dirty chunks at a time, before the
+             * cache would evict them one by one */
+            if(use_filt_threads && ++filt_ndirty >= filt_batch.nalloc) {
+                if(H5D__chunk_filt_batch_flush(io_info, &filt_batch) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to flush dirty chunks")
+                filt_ndirty = 0;
+            } /* end if */
 	} /* end if */
 	else {
             if(need_insert && io_info->dset->shared->layout.storage.u.chunk.ops->insert)
@@ -2155,7 +2869,15 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
         chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
     } /* end while */
 
+    /* Encode & write the rest of the dirty chunks */
+    if(use_filt_threads && filt_ndirty > 0)
+        if(H5D__chunk_filt_batch_flush(io_info, &filt_batch) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to flush dirty chunks")
+
 done:
+    if(filt_batch.ents)
+        filt_batch.ents = (H5D_chunk_filt_ent_t *)H5MM_xfree(filt_batch.ents);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_write() */
 
@@ -2195,7 +2917,7 @@ H5D__chunk_flush(H5D_t *dset, hid_t dxpl_id)
     /* Loop over all entries in the chunk cache */
     for(ent = rdcc->head; ent; ent = next) {
 	next = ent->next;
-        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE) < 0)
+        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE, NULL) < 0)
             nerrors++;
     } /* end for */
     if(nerrors)
@@ -2243,6 +2965,19 @@ H5D__chunk_io_term(const H5D_chunk_map_t *fm)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTNEXT, FAIL, "can't iterate over chunks")
     } /* end else */
 
+    /* Hand the dataset's selection info back, or release our own */
+    if(fm->sel_busy)
+        *fm->sel_busy = FALSE;
+    else {
+        if(fm->sel_chunks)
+            H5SL_close(fm->sel_chunks);
+        if(fm->single_space)
+            if(H5S_close(fm->single_space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release single chunk dataspace")
+        if(fm->single_chunk_info)
+            (void)H5FL_FREE(H5D_chunk_info_t, fm->single_chunk_info);
+    } /* end else */
+
     /* Free the memory chunk dataspace template */
     if(fm->mchunk_tmpl)
         if(H5S_close(fm->mchunk_tmpl) < 0)
@@ -2303,6 +3038,10 @@ H5D__chunk_dest(H5D_t *dset, hid_t dxpl_id)
     if(nerrors)
 	HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
+    /* Release the replacement policy's state */
+    if(rdcc->cls && rdcc->cls->dest && (rdcc->cls->dest)(rdcc) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk cache policy info")
+
     /* Release cache structures */
     if(rdcc->slot)
         rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
@@ -2326,40 +3065,155 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D_chunk_idx_reset
+ * Function:	H5D__chunk_index_close
  *
- * Purpose:	Reset index information
+ * Purpose:	Discard all cached chunks and release the in-memory chunk
+ *		index of a dataset opened for reading, so that the index
+ *		metadata can be evicted and re-read from the file.
  *
  * Return:	Non-negative on success/Negative on failure
  *
- * Programmer:	Quincey Koziol
- *              Thursday, January 15, 2009
- *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr)
+H5D__chunk_index_close(const H5D_t *dset, hid_t dxpl_id)
 {
-    herr_t ret_value = SUCCEED;         /* Return value */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    H5D_rdcc_ent_t	*ent = NULL, *next = NULL;      /* Pointer to current & next cache entries */
+    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
+    herr_t      ret_value = SUCCEED;       /* Return value */
 
-    FUNC_ENTER_NOAPI(FAIL)
+    FUNC_ENTER_PACKAGE
 
     /* Sanity checks */
-    HDassert(storage);
-    HDassert(storage->ops);
-    H5D_CHUNK_STORAGE_INDEX_CHK(storage);
+    HDassert(dset);
+    HDassert(0 == (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR));
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
 
-    /* Reset index structures */
-    if((storage->ops->reset)(storage, reset_addr) < 0)
-	HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to reset chunk index info")
+    /* Fill the DXPL cache values for later use */
+    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D_chunk_idx_reset() */
+    /* Discard all the cached chunks (none can be dirty) */
+    for(ent = rdcc->head; ent; ent = next) {
+	next = ent->next;
+	if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, ent, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFREE, FAIL, "unable to evict chunk")
+    } /* end for */
 
-
-/*-------------------------------------------------------------------------
- * Function:	H5D__chunk_cinfo_cache_reset
+    /* Forget the last chunk looked up */
+    H5D__chunk_cinfo_cache_reset(&(rdcc->last));
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.dxpl_id = dxpl_id;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
+
+    /* Free any index structures */
+    if(sc->ops->dest && (sc->ops->dest)(&idx_info) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk index info")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_index_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_index_reopen
+ *
+ * Purpose:	Set up the chunk index of a dataset again after
+ *		H5D__chunk_index_close, using the dataset's current
+ *		dimensions and index address.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_index_reopen(const H5D_t *dset, hid_t dxpl_id)
+{
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(dset);
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+
+    /* Recompute scaled dimension info, if dataset dims > 1 */
+    if(dset->shared->ndims > 1) {
+        unsigned u;                         /* Local index value */
+
+        for(u = 0; u < dset->shared->ndims; u++) {
+            rdcc->scaled_dims[u] = dset->shared->curr_dims[u] / dset->shared->layout.u.chunk.dim[u];
+            rdcc->scaled_power2up[u] = H5VM_power2up(rdcc->scaled_dims[u]);
+            rdcc->scaled_encode_bits[u] = H5VM_log2_gen(rdcc->scaled_power2up[u]);
+        } /* end for */
+    } /* end if */
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.dxpl_id = dxpl_id;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = sc;
+
+    /* Set up the indexing structures again */
+    if(sc->ops->init && (sc->ops->init)(&idx_info, dset->shared->space, dset->oloc.addr) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize indexing information")
+
+    /* Set the number of chunks in dataset, etc. */
+    if(H5D__chunk_set_info(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set # of chunks for dataset")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_index_reopen() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D_chunk_idx_reset
+ *
+ * Purpose:	Reset index information
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Quincey Koziol
+ *              Thursday, January 15, 2009
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(storage);
+    HDassert(storage->ops);
+    H5D_CHUNK_STORAGE_INDEX_CHK(storage);
+
+    /* Reset index structures */
+    if((storage->ops->reset)(storage, reset_addr) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to reset chunk index info")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D_chunk_idx_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cinfo_cache_reset
  *
  * Purpose:	Reset the cached chunk info
  *
@@ -2709,7 +3563,7 @@ done:
  */
 static herr_t
 H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t *dxpl_cache,
-    H5D_rdcc_ent_t *ent, hbool_t reset)
+    H5D_rdcc_ent_t *ent, hbool_t reset, H5D_chunk_filt_ent_t *filt_ent)
 {
     void	*buf = NULL;	        /* Temporary buffer		*/
     hbool_t	point_of_no_return = FALSE;
@@ -2724,6 +3578,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     HDassert(dxpl_cache);
     HDassert(ent);
     HDassert(!ent->locked);
+    HDassert(!filt_ent || !reset);
 
     buf = ent->chunk;
     if(ent->dirty) {
@@ -2746,31 +3601,41 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
             size_t alloc = udata.chunk_block.length;        /* Bytes allocated for BUF	*/
             size_t nbytes;                      /* Chunk size (in bytes) */
 
-            if(!reset) {
-                /*
-                 * Copy the chunk to a new buffer before running it through
-                 * the pipeline because we'll want to save the original buffer
-                 * for later.
-                 */
-                if(NULL == (buf = H5MM_malloc(alloc)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
-                HDmemcpy(buf, ent->chunk, alloc);
+            if(filt_ent) {
+                /* The chunk was already copied & run through the pipeline,
+                 * take over the encoded copy */
+                buf = filt_ent->buf;
+                filt_ent->buf = NULL;
+                nbytes = filt_ent->nbytes;
+                udata.filter_mask = filt_ent->udata.filter_mask;
             } /* end if */
             else {
-                /*
-                 * If we are reseting and something goes wrong after this
-                 * point then it's too late to recover because we may have
-                 * destroyed the original data by calling H5Z_pipeline().
-                 * The only safe option is to continue with the reset
-                 * even if we can't write the data to disk.
-                 */
-                point_of_no_return = TRUE;
-                ent->chunk = NULL;
+                if(!reset) {
+                    /*
+                     * Copy the chunk to a new buffer before running it through
+                     * the pipeline because we'll want to save the original buffer
+                     * for later.
+                     */
+                    if(NULL == (buf = H5MM_malloc(alloc)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                    HDmemcpy(buf, ent->chunk, alloc);
+                } /* end if */
+                else {
+                    /*
+                     * If we are reseting and something goes wrong after this
+                     * point then it's too late to recover because we may have
+                     * destroyed the original data by calling H5Z_pipeline().
+                     * The only safe option is to continue with the reset
+                     * even if we can't write the data to disk.
+                     */
+                    point_of_no_return = TRUE;
+                    ent->chunk = NULL;
+                } /* end else */
+                H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+                if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), dxpl_cache->err_detect,
+                         dxpl_cache->filter_cb, &nbytes, &alloc, &buf) < 0)
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
             } /* end else */
-            H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
-            if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), dxpl_cache->err_detect,
-                     dxpl_cache->filter_cb, &nbytes, &alloc, &buf) < 0)
-                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
             if(nbytes > ((size_t)0xffffffff))
@@ -2824,8 +3689,9 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
         /* Mark cache entry as clean */
         ent->dirty = FALSE;
 
-        /* Increment # of flushed entries */
+        /* Increment # of flushed entries and bytes */
         dset->shared->cache.chunk.stats.nflushes++;
+        dset->shared->cache.chunk.stats.nbytes_written += udata.chunk_block.length;
     } /* end if */
 
     /* Reset, but do not free or removed from list */
@@ -2886,7 +3752,7 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
 
     if(flush) {
 	/* Flush */
-	if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, TRUE) < 0)
+	if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, TRUE, NULL) < 0)
 	    HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
     } /* end if */
     else {
@@ -2921,6 +3787,10 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
          */
         rdcc->slot[ent->idx] = NULL;
 
+    /* Let the replacement policy forget the chunk */
+    if(rdcc->cls->remove)
+        (rdcc->cls->remove)(rdcc, ent);
+
     /* Remove from cache */
     HDassert(rdcc->slot[ent->idx] != ent);
     ent->idx = UINT_MAX;
@@ -2930,116 +3800,659 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     /* Free */
     ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
 
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cache_evict() */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_evict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_prune
+ *
+ * Purpose:	Prune the cache by preempting some things until the cache has
+ *		room for something which is SIZE bytes.  Only unlocked
+ *		entries are considered for preemption.  This is the prune
+ *		method of the default (H5D_CHUNK_CACHE_POLICY_W0) policy.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Robb Matzke
+ *              Thursday, May 21, 1998
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size)
+{
+    const H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);
+    size_t		total = rdcc->nbytes_max;
+    const int		nmeth = 2;	/*number of methods		*/
+    int		        w[1];		/*weighting as an interval	*/
+    H5D_rdcc_ent_t	*p[2], *cur;	/*list pointers			*/
+    H5D_rdcc_ent_t	*n[2];		/*list next pointers		*/
+    int		nerrors = 0;            /* Accumulated error count during preemptions */
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /*
+     * Preemption is accomplished by having multiple pointers (currently two)
+     * slide down the list beginning at the head. Pointer p(N+1) will start
+     * traversing the list when pointer pN reaches wN percent of the original
+     * list.  In other words, preemption method N gets to consider entries in
+     * approximate least recently used order w0 percent before method N+1
+     * where 100% means tha method N will run to completion before method N+1
+     * begins.  The pointers participating in the list traversal are each
+     * given a chance at preemption before any of the pointers are advanced.
+     */
+    w[0] = (int)(rdcc->nused * rdcc->w0);
+    p[0] = rdcc->head;
+    p[1] = NULL;
+
+    while((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
+        int i;          /* Local index variable */
+
+	/* Introduce new pointers */
+	for(i = 0; i < nmeth - 1; i++)
+            if(0 == w[i])
+                p[i + 1] = rdcc->head;
+
+	/* Compute next value for each pointer */
+	for(i = 0; i < nmeth; i++)
+            n[i] = p[i] ? p[i]->next : NULL;
+
+	/* Give each method a chance */
+	for(i = 0; i < nmeth && (rdcc->nbytes_used + size) > total; i++) {
+	    if(0 == i && p[0] && !p[0]->locked &&
+                    ((0 == p[0]->rd_count && 0 == p[0]->wr_count) ||
+                     (0 == p[0]->rd_count && dset->shared->layout.u.chunk.size == p[0]->wr_count) ||
+                     (dset->shared->layout.u.chunk.size == p[0]->rd_count && 0 == p[0]->wr_count))) {
+		/*
+		 * Method 0: Preempt entries that have been completely written
+		 * and/or completely read but not entries that are partially
+		 * written or partially read.
+		 */
+		cur = p[0];
+	    } else if(1 == i && p[1] && !p[1]->locked) {
+		/*
+		 * Method 1: Preempt the entry without regard to
+		 * considerations other than being locked.  This is the last
+		 * resort preemption.
+		 */
+		cur = p[1];
+	    } else {
+		/* Nothing to preempt at this point */
+		cur = NULL;
+	    }
+
+	    if(cur) {
+                int j;          /* Local index variable */
+
+		for(j = 0; j < nmeth; j++) {
+		    if(p[j] == cur)
+                        p[j] = NULL;
+		    if(n[j] == cur)
+                        n[j] = cur->next;
+		} /* end for */
+		if(H5D__chunk_cache_preempt(dset, dxpl_id, dxpl_cache, cur) < 0)
+                    nerrors++;
+	    } /* end if */
+	} /* end for */
+
+	/* Advance pointers */
+	for(i = 0; i < nmeth; i++)
+            p[i] = n[i];
+	for(i = 0; i < nmeth - 1; i++)
+            w[i] -= 1;
+    } /* end while */
+
+    if(nerrors)
+	HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_prune() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_preempt
+ *
+ * Purpose:	Preempts an entry to make room in the cache, flushing it to
+ *		disk if necessary.  Unlike H5D__chunk_cache_evict(), this
+ *		counts the eviction and lets the replacement policy remember
+ *		the chunk.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_preempt(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent)
+{
+    H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(ent);
+    HDassert(!ent->locked);
+
+    /* Increment # of preempted entries */
+    rdcc->stats.nevictions++;
+
+    /* Let the replacement policy remember the chunk */
+    if(rdcc->cls->preempt && (rdcc->cls->preempt)(rdcc, dset->shared->ndims, ent) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't remember preempted chunk")
+
+    if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, ent, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_preempt() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_w0_hit
+ *
+ * Purpose:	Moves a chunk which was used again backward in the list by
+ *		one slot, if the chunk is not at the end of the list already.
+ *		Together with H5D__chunk_cache_prune() this is the default
+ *		(H5D_CHUNK_CACHE_POLICY_W0) policy.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_w0_hit(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ent);
+
+    if(ent->next) {
+        if(ent->next->next)
+            ent->next->next->prev = ent;
+        else
+            rdcc->tail = ent;
+        ent->next->prev = ent->prev;
+        if(ent->prev)
+            ent->prev->next = ent->next;
+        else
+            rdcc->head = ent->next;
+        ent->prev = ent->next;
+        ent->next = ent->next->next;
+        ent->prev->next = ent;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_w0_hit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_lru_hit
+ *
+ * Purpose:	Moves a chunk which was used again to the end of the list,
+ *		so the head of the list is always the least recently used
+ *		chunk.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_lru_hit(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ent);
+
+    if(ent->next) {
+        /* Unlink */
+        ent->next->prev = ent->prev;
+        if(ent->prev)
+            ent->prev->next = ent->next;
+        else
+            rdcc->head = ent->next;
+
+        /* Append */
+        ent->prev = rdcc->tail;
+        ent->next = NULL;
+        rdcc->tail->next = ent;
+        rdcc->tail = ent;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_lru_hit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_lru_prune
+ *
+ * Purpose:	Preempts the least recently used unlocked chunks until the
+ *		cache has room for something which is SIZE bytes.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_lru_prune(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size)
+{
+    const H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);
+    H5D_rdcc_ent_t	*ent, *next;    /* Current & next cache entries */
+    int		nerrors = 0;            /* Accumulated error count during preemptions */
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for(ent = rdcc->head; ent && (rdcc->nbytes_used + size) > rdcc->nbytes_max; ent = next) {
+        next = ent->next;
+        if(!ent->locked)
+            if(H5D__chunk_cache_preempt(dset, dxpl_id, dxpl_cache, ent) < 0)
+                nerrors++;
+    } /* end for */
+
+    if(nerrors)
+	HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_lru_prune() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_arc_hit
+ *
+ * Purpose:	Marks a chunk which was used again as frequently used and
+ *		moves it to the end of the list.
+ *
+ *		The adaptive (H5D_CHUNK_CACHE_POLICY_ARC) policy follows
+ *		Megiddo and Modha's Adaptive Replacement Cache, counted in
+ *		chunks.  Rather than keeping two lists of cached chunks, the
+ *		cache's single list stays in least recently used order and
+ *		each entry records whether it has been used more than once.
+ *		Chunks recently preempted are remembered on two "ghost"
+ *		lists, and a later miss on a ghost moves the target split
+ *		between chunks used once and chunks used often.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_arc_hit(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ent);
+
+    if(!ent->freq) {
+        HDassert(rdcc->arc.nonce > 0);
+        ent->freq = TRUE;
+        rdcc->arc.nonce--;
+    } /* end if */
+
+    H5D__chunk_cache_lru_hit(rdcc, ent);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_arc_hit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_arc_admit
+ *
+ * Purpose:	Looks for the chunk about to be added among the recently
+ *		preempted chunks.  A chunk preempted after one use means the
+ *		share of chunks used once was too small and a chunk
+ *		preempted after several uses means it was too large, so the
+ *		target is moved accordingly.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_arc_admit(H5D_rdcc_t *rdcc, unsigned ndims,
+    const hsize_t *scaled)
+{
+    H5D_rdcc_ghost_t key;               /* Search key */
+    H5D_rdcc_ghost_t *ghost;            /* Ghost found */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(rdcc->arc.ghosts);
+    HDassert(scaled);
+
+    key.ndims = ndims;
+    HDmemcpy(key.scaled, scaled, ndims * sizeof(hsize_t));
+
+    rdcc->arc.admit = H5D_RDCC_ARC_NONE;
+    if(NULL != (ghost = (H5D_rdcc_ghost_t *)H5SL_search(rdcc->arc.ghosts, &key))) {
+        size_t nb1 = rdcc->arc.nghosts[0];
+        size_t nb2 = rdcc->arc.nghosts[1];
+        size_t delta;
+
+        if(H5D_RDCC_ARC_B1 == ghost->list) {
+            delta = MAX(nb2 / nb1, 1);
+            rdcc->arc.target = MIN(rdcc->arc.target + delta, rdcc->arc.capacity);
+        } /* end if */
+        else {
+            delta = MAX(nb1 / MAX(nb2, 1), 1);
+            rdcc->arc.target -= MIN(rdcc->arc.target, delta);
+        } /* end else */
+        rdcc->arc.admit = ghost->list;
+
+        H5D__chunk_cache_ghost_remove(rdcc, ghost);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_arc_admit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_arc_prune
+ *
+ * Purpose:	Preempts unlocked chunks until the cache has room for
+ *		something which is SIZE bytes.  The least recently used
+ *		chunk used only once is preempted while there are more of
+ *		those than the target, otherwise the least recently used
+ *		chunk used often.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_arc_prune(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size)
+{
+    const H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while((rdcc->nbytes_used + size) > rdcc->nbytes_max) {
+        H5D_rdcc_ent_t *ent;            /* Current cache entry */
+        H5D_rdcc_ent_t *victim = NULL;  /* Entry to preempt */
+        H5D_rdcc_ent_t *fallback = NULL; /* Entry to preempt when the preferred list is empty */
+        hbool_t want_freq;              /* Whether to preempt a frequently used chunk */
+
+        want_freq = !(rdcc->arc.nonce > 0 && (rdcc->arc.nonce > rdcc->arc.target ||
+                (H5D_RDCC_ARC_B2 == rdcc->arc.admit && rdcc->arc.nonce == rdcc->arc.target)));
+
+        for(ent = rdcc->head; ent && !victim; ent = ent->next)
+            if(!ent->locked) {
+                if(ent->freq == want_freq)
+                    victim = ent;
+                else if(!fallback)
+                    fallback = ent;
+            } /* end if */
+        if(!victim)
+            victim = fallback;
+
+        /* Nothing left to preempt */
+        if(!victim)
+            break;
+
+        if(H5D__chunk_cache_preempt(dset, dxpl_id, dxpl_cache, victim) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt raw data cache entry")
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_arc_prune() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_arc_insert
+ *
+ * Purpose:	Marks a chunk added to the cache as frequently used if it
+ *		was found on a ghost list, and as used once otherwise.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_arc_insert(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ent);
+
+    ent->freq = (hbool_t)(H5D_RDCC_ARC_NONE != rdcc->arc.admit);
+    if(!ent->freq)
+        rdcc->arc.nonce++;
+    rdcc->arc.admit = H5D_RDCC_ARC_NONE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_arc_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_arc_preempt
+ *
+ * Purpose:	Remembers a chunk about to be preempted on the ghost list
+ *		matching how often it was used, then trims the ghost lists
+ *		so they cover at most the cache's capacity again.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_arc_preempt(H5D_rdcc_t *rdcc, unsigned ndims,
+    const H5D_rdcc_ent_t *ent)
+{
+    H5D_rdcc_ghost_t *ghost = NULL;     /* New ghost */
+    unsigned    u;                      /* Index of the ghost's list */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(rdcc);
+    HDassert(rdcc->arc.ghosts);
+    HDassert(ent);
+
+    /* Create the ghost */
+    if(NULL == (ghost = H5FL_MALLOC(H5D_rdcc_ghost_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate preempted chunk info")
+    ghost->ndims = ndims;
+    HDmemcpy(ghost->scaled, ent->scaled, ndims * sizeof(hsize_t));
+    ghost->list = ent->freq ? H5D_RDCC_ARC_B2 : H5D_RDCC_ARC_B1;
+    ghost->next = NULL;
+
+    if(H5SL_search(rdcc->arc.ghosts, ghost))
+        ghost = H5FL_FREE(H5D_rdcc_ghost_t, ghost);
+    else {
+        if(H5SL_insert(rdcc->arc.ghosts, ghost, ghost) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't insert preempted chunk into skip list")
+
+        /* Append to the newest end of its list */
+        u = ghost->list - 1;
+        ghost->prev = rdcc->arc.tail[u];
+        if(rdcc->arc.tail[u])
+            rdcc->arc.tail[u]->next = ghost;
+        else
+            rdcc->arc.head[u] = ghost;
+        rdcc->arc.tail[u] = ghost;
+        rdcc->arc.nghosts[u]++;
+        ghost = NULL;
+    } /* end else */
+
+    /* Trim the ghost lists.  ENT is still counted among the cached chunks. */
+    while(rdcc->arc.nghosts[0] > 0 &&
+            (rdcc->arc.nonce - (ent->freq ? 0 : 1)) + rdcc->arc.nghosts[0] > rdcc->arc.capacity)
+        H5D__chunk_cache_ghost_remove(rdcc, rdcc->arc.head[0]);
+    while(rdcc->arc.nghosts[1] > 0 &&
+            ((size_t)rdcc->nused - 1) + rdcc->arc.nghosts[0] + rdcc->arc.nghosts[1] > 2 * rdcc->arc.capacity)
+        H5D__chunk_cache_ghost_remove(rdcc, rdcc->arc.head[1]);
+
+done:
+    if(ghost)
+        ghost = H5FL_FREE(H5D_rdcc_ghost_t, ghost);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_arc_preempt() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_arc_remove
+ *
+ * Purpose:	Accounts for a chunk leaving the cache.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_arc_remove(H5D_rdcc_t *rdcc, const H5D_rdcc_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ent);
+
+    if(!ent->freq) {
+        HDassert(rdcc->arc.nonce > 0);
+        rdcc->arc.nonce--;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_arc_remove() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_cache_prune
+ * Function:	H5D__chunk_cache_arc_dest
  *
- * Purpose:	Prune the cache by preempting some things until the cache has
- *		room for something which is SIZE bytes.  Only unlocked
- *		entries are considered for preemption.
+ * Purpose:	Releases the ghost lists.
  *
  * Return:	Non-negative on success/Negative on failure
  *
- * Programmer:	Robb Matzke
- *              Thursday, May 21, 1998
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
-    const H5D_dxpl_cache_t *dxpl_cache, size_t size)
+H5D__chunk_cache_arc_dest(H5D_rdcc_t *rdcc)
 {
-    const H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);
-    size_t		total = rdcc->nbytes_max;
-    const int		nmeth = 2;	/*number of methods		*/
-    int		        w[1];		/*weighting as an interval	*/
-    H5D_rdcc_ent_t	*p[2], *cur;	/*list pointers			*/
-    H5D_rdcc_ent_t	*n[2];		/*list next pointers		*/
-    int		nerrors = 0;            /* Accumulated error count during preemptions */
-    herr_t      ret_value = SUCCEED;       /* Return value */
+    herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /*
-     * Preemption is accomplished by having multiple pointers (currently two)
-     * slide down the list beginning at the head. Pointer p(N+1) will start
-     * traversing the list when pointer pN reaches wN percent of the original
-     * list.  In other words, preemption method N gets to consider entries in
-     * approximate least recently used order w0 percent before method N+1
-     * where 100% means tha method N will run to completion before method N+1
-     * begins.  The pointers participating in the list traversal are each
-     * given a chance at preemption before any of the pointers are advanced.
-     */
-    w[0] = (int)(rdcc->nused * rdcc->w0);
-    p[0] = rdcc->head;
-    p[1] = NULL;
-
-    while((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
-        int i;          /* Local index variable */
-
-	/* Introduce new pointers */
-	for(i = 0; i < nmeth - 1; i++)
-            if(0 == w[i])
-                p[i + 1] = rdcc->head;
+    HDassert(rdcc);
 
-	/* Compute next value for each pointer */
-	for(i = 0; i < nmeth; i++)
-            n[i] = p[i] ? p[i]->next : NULL;
+    if(rdcc->arc.ghosts) {
+        if(H5SL_destroy(rdcc->arc.ghosts, H5D__chunk_cache_ghost_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't destroy skip list of preempted chunks")
+        rdcc->arc.ghosts = NULL;
+    } /* end if */
+    rdcc->arc.head[0] = rdcc->arc.head[1] = NULL;
+    rdcc->arc.tail[0] = rdcc->arc.tail[1] = NULL;
+    rdcc->arc.nghosts[0] = rdcc->arc.nghosts[1] = 0;
 
-	/* Give each method a chance */
-	for(i = 0; i < nmeth && (rdcc->nbytes_used + size) > total; i++) {
-	    if(0 == i && p[0] && !p[0]->locked &&
-                    ((0 == p[0]->rd_count && 0 == p[0]->wr_count) ||
-                     (0 == p[0]->rd_count && dset->shared->layout.u.chunk.size == p[0]->wr_count) ||
-                     (dset->shared->layout.u.chunk.size == p[0]->rd_count && 0 == p[0]->wr_count))) {
-		/*
-		 * Method 0: Preempt entries that have been completely written
-		 * and/or completely read but not entries that are partially
-		 * written or partially read.
-		 */
-		cur = p[0];
-	    } else if(1 == i && p[1] && !p[1]->locked) {
-		/*
-		 * Method 1: Preempt the entry without regard to
-		 * considerations other than being locked.  This is the last
-		 * resort preemption.
-		 */
-		cur = p[1];
-	    } else {
-		/* Nothing to preempt at this point */
-		cur = NULL;
-	    }
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_arc_dest() */
 
-	    if(cur) {
-                int j;          /* Local index variable */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_ghost_cmp
+ *
+ * Purpose:	Skip list comparison callback for ghosts, ordering them by
+ *		their scaled coordinates.
+ *
+ * Return:	<0, 0 or >0, like memcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_cache_ghost_cmp(const void *_g1, const void *_g2)
+{
+    const H5D_rdcc_ghost_t *g1 = (const H5D_rdcc_ghost_t *)_g1;
+    const H5D_rdcc_ghost_t *g2 = (const H5D_rdcc_ghost_t *)_g2;
+    unsigned    u;                      /* Local index variable */
+    int         ret_value = 0;          /* Return value */
 
-		for(j = 0; j < nmeth; j++) {
-		    if(p[j] == cur)
-                        p[j] = NULL;
-		    if(n[j] == cur)
-                        n[j] = cur->next;
-		} /* end for */
-		if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, cur, TRUE) < 0)
-                    nerrors++;
-	    } /* end if */
-	} /* end for */
+    FUNC_ENTER_STATIC_NOERR
 
-	/* Advance pointers */
-	for(i = 0; i < nmeth; i++)
-            p[i] = n[i];
-	for(i = 0; i < nmeth - 1; i++)
-            w[i] -= 1;
-    } /* end while */
+    HDassert(g1->ndims == g2->ndims);
 
-    if(nerrors)
-	HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+    for(u = 0; u < g1->ndims; u++)
+        if(g1->scaled[u] != g2->scaled[u])
+            HGOTO_DONE(g1->scaled[u] < g2->scaled[u] ? -1 : 1)
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cache_prune() */
+} /* end H5D__chunk_cache_ghost_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_ghost_remove
+ *
+ * Purpose:	Unlinks a ghost from its list and the skip list and frees it.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_ghost_remove(H5D_rdcc_t *rdcc, H5D_rdcc_ghost_t *ghost)
+{
+    unsigned    u;                      /* Index of the ghost's list */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ghost);
+
+    u = ghost->list - 1;
+    if(ghost->prev)
+        ghost->prev->next = ghost->next;
+    else
+        rdcc->arc.head[u] = ghost->next;
+    if(ghost->next)
+        ghost->next->prev = ghost->prev;
+    else
+        rdcc->arc.tail[u] = ghost->prev;
+    HDassert(rdcc->arc.nghosts[u] > 0);
+    rdcc->arc.nghosts[u]--;
+
+    H5SL_remove(rdcc->arc.ghosts, ghost);
+    ghost = H5FL_FREE(H5D_rdcc_ghost_t, ghost);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_ghost_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_ghost_free_cb
+ *
+ * Purpose:	Skip list callback to free a ghost when the ghost lists are
+ *		released.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_ghost_free_cb(void *item, void H5_ATTR_UNUSED *key,
+    void H5_ATTR_UNUSED *op_data)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(item);
+
+    item = H5FL_FREE(H5D_rdcc_ghost_t, item);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5D__chunk_cache_ghost_free_cb() */
 
 
 /*-------------------------------------------------------------------------
@@ -3071,7 +4484,7 @@ done:
  */
 static void *
 H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
-    hbool_t relax)
+    hbool_t relax, void *prefetch)
 {
     const H5D_t         *dset = io_info->dset;  /* Local pointer to the dataset info */
     const H5O_pline_t   *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info - always equal to the pline passed to H5D__chunk_mem_alloc */
@@ -3120,29 +4533,11 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 #endif /* NDEBUG */
 
         /*
-         * Already in the cache.  Count a hit.
+         * Already in the cache.  Count a hit and let the replacement policy
+         * move the chunk away from the head of the list.
          */
         rdcc->stats.nhits++;
-
-        /*
-         * If the chunk is not at the beginning of the cache; move it backward
-         * by one slot.  This is how we implement the LRU preemption
-         * algorithm.
-         */
-        if(ent->next) {
-            if(ent->next->next)
-                ent->next->next->prev = ent;
-            else
-                rdcc->tail = ent;
-            ent->next->prev = ent->prev;
-            if(ent->prev)
-                ent->prev->next = ent->next;
-            else
-                rdcc->head = ent->next;
-            ent->prev = ent->next;
-            ent->next = ent->next->next;
-            ent->prev->next = ent;
-        } /* end if */
+        (rdcc->cls->hit)(rdcc, ent);
     } /* end if */
     else {
         haddr_t             chunk_addr;         /* Address of chunk on disk */
@@ -3176,23 +4571,31 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
             /* Check if the chunk exists on disk */
             if(H5F_addr_defined(chunk_addr)) {
-                size_t my_chunk_alloc = chunk_alloc;	/* Allocated buffer size */
-                size_t buf_alloc = chunk_alloc;	        /* [Re-]allocated buffer size */
-
-                /* Chunk size on disk isn't [likely] the same size as the final chunk
-                 * size in memory, so allocate memory big enough. */
-                if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, pline)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
-                if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, io_info->raw_dxpl_id, chunk) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
-
-                if(pline->nused)
-                    if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &(udata->filter_mask), io_info->dxpl_cache->err_detect,
-                            io_info->dxpl_cache->filter_cb, &my_chunk_alloc, &buf_alloc, &chunk) < 0)
-                        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
+                if(prefetch) {
+                    /* The chunk was already read & run through the filter pipeline */
+                    chunk = prefetch;
+                    prefetch = NULL;
+                } /* end if */
+                else {
+                    size_t my_chunk_alloc = chunk_alloc;	/* Allocated buffer size */
+                    size_t buf_alloc = chunk_alloc;	        /* [Re-]allocated buffer size */
+
+                    /* Chunk size on disk isn't [likely] the same size as the final chunk
+                     * size in memory, so allocate memory big enough. */
+                    if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, pline)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
+                    if(H5F_block_read_concurrent(dset->oloc.file, chunk_addr, my_chunk_alloc, io_info->raw_dxpl_id, chunk) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
+
+                    if(pline->nused)
+                        if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &(udata->filter_mask), io_info->dxpl_cache->err_detect,
+                                io_info->dxpl_cache->filter_cb, &my_chunk_alloc, &buf_alloc, &chunk) < 0)
+                            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
+                } /* end else */
 
-                /* Increment # of cache misses */
+                /* Increment # of cache misses and bytes read for them */
                 rdcc->stats.nmisses++;
+                rdcc->stats.nbytes_read += chunk_alloc;
             } /* end if */
             else {
                 H5D_fill_value_t	fill_status;
@@ -3247,12 +4650,16 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
             /* Add the chunk to the cache only if the slot is not already locked */
             ent = rdcc->slot[udata->idx_hint];
             if(!ent || !ent->locked) {
+                /* Tell the replacement policy which chunk is coming */
+                if(rdcc->cls->admit)
+                    (rdcc->cls->admit)(rdcc, layout->u.chunk.ndims - 1, udata->common.scaled);
+
                 /* Preempt enough things from the cache to make room */
                 if(ent) {
-                    if(H5D__chunk_cache_evict(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, ent, TRUE) < 0)
+                    if(H5D__chunk_cache_preempt(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, ent) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
                 } /* end if */
-                if(H5D__chunk_cache_prune(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, chunk_size) < 0)
+                if((rdcc->cls->prune)(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, chunk_size) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
 
                 /* Create a new entry */
@@ -3286,6 +4693,10 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 		ent->tmp_next = NULL;
 		ent->tmp_prev = NULL;
 
+                /* Let the replacement policy account for the new chunk */
+                if(rdcc->cls->insert)
+                    (rdcc->cls->insert)(rdcc, ent);
+
             } /* end if */
             else
                 /* We did not add the chunk to cache */
@@ -3322,6 +4733,10 @@ done:
         if(chunk)
             chunk = H5D__chunk_mem_xfree(chunk, pline);
 
+    /* Release a prefetched chunk that wasn't needed */
+    if(prefetch)
+        prefetch = H5D__chunk_mem_xfree(prefetch, pline);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_lock() */
 
@@ -3380,7 +4795,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
             fake_ent.chunk_block.length = udata->chunk_block.length;
             fake_ent.chunk = (uint8_t *)chunk;
 
-            if(H5D__chunk_flush_entry(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, &fake_ent, TRUE) < 0)
+            if(H5D__chunk_flush_entry(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, &fake_ent, TRUE, NULL) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
         } /* end if */
         else {
@@ -3480,7 +4895,7 @@ H5D__chunk_allocated(H5D_t *dset, hid_t dxpl_id, hsize_t *nbytes)
     /* Search for cached chunks that haven't been written out */
     for(ent = rdcc->head; ent; ent = ent->next) {
         /* Flush the chunk out to disk, to make certain the size is correct later */
-        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE) < 0)
+        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
     } /* end for */
 
@@ -3912,6 +5327,12 @@ H5D__chunk_collective_fill(const H5D_t *dset, hid_t dxpl_id,
     if((data_dxpl_id = H5P_copy_plist((H5P_genplist_t *)H5I_object(dxpl_id), TRUE)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, FAIL, "can't copy property list")
 
+    /* The file types' displacements must be increasing, but chunks may have
+     * been allocated out of order (e.g. in space freed by filtered chunks
+     * that were rewritten) */
+    if(chunk_info->num_io > 1)
+        HDqsort(chunk_info->addr, chunk_info->num_io, sizeof(haddr_t), H5D__chunk_cmp_addr);
+
     /* Distribute evenly the number of blocks between processes. */
     num_blocks = chunk_info->num_io / mpi_size; /* value should be the same on all procs */
 
@@ -4013,6 +5434,136 @@ done:
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_collective_fill() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cmp_addr
+ *
+ * Purpose:     Compare the file addresses of two chunks, for qsort()
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_cmp_addr(const void *addr1, const void *addr2)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(*(const haddr_t *)addr1, *(const haddr_t *)addr2))
+} /* end H5D__chunk_cmp_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_collective_realloc
+ *
+ * Purpose:     Allocate file space for filtered chunks rewritten by a
+ *              collective write and record their new locations in the
+ *              chunk index.
+ *
+ *              All processes must call this routine with the same list of
+ *              chunks, sorted by chunk index, so that they all make the
+ *              same file space allocations.  The index is updated in one
+ *              pass, after all the chunks have been allocated.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_collective_realloc(const H5D_io_info_t *io_info, size_t nchunks,
+    H5D_chunk_realloc_t chunks[])
+{
+    const H5D_t *dset = io_info->dset;  /* Dataset being written */
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    const H5D_chunk_ops_t *ops = layout->storage.u.chunk.ops;  /* Chunk index operations */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    hsize_t     scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of current chunk */
+    hbool_t     *need_insert = NULL;    /* Whether each chunk needs to be inserted into the index */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(dset->shared->dcpl_cache.pline.nused > 0);
+    HDassert(chunks || nchunks == 0);
+
+    /* Check for no chunks written */
+    if(nchunks == 0)
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (need_insert = (hbool_t *)H5MM_calloc(nchunks * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk insertion flags")
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.dxpl_id = io_info->md_dxpl_id;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    /* Allocate file space for all the chunks */
+    scaled[dset->shared->ndims] = 0;
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_ud_t udata;           /* User data for querying chunk info */
+        H5F_block_t old_chunk;          /* Offset/length of old chunk */
+
+        HDassert(u == 0 || chunks[u].index > chunks[u - 1].index);
+
+        /* Compute the chunk's coordinates from its index */
+        if(H5VM_array_calc_pre(chunks[u].index, dset->shared->ndims, layout->u.chunk.down_chunks, scaled) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't compute chunk coordinates")
+
+        /* Find out where the chunk is now (if anywhere) */
+        if(H5D__chunk_lookup(dset, io_info->md_dxpl_id, scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        old_chunk.offset = udata.chunk_block.offset;
+        old_chunk.length = udata.chunk_block.length;
+
+        /* Create the chunk if it doesn't exist, or reallocate the chunk
+         *  if its size changed.
+         */
+        chunks[u].chunk_block.offset = HADDR_UNDEF;
+        if(H5D__chunk_file_alloc(&idx_info, &old_chunk, &chunks[u].chunk_block, &need_insert[u], scaled) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+
+        /* A chunk that stayed in place must still have its index record
+         *  updated if a different set of filters was applied to it.
+         */
+        if(H5F_addr_defined(old_chunk.offset) && udata.filter_mask != chunks[u].filter_mask)
+            need_insert[u] = TRUE;
+    } /* end for */
+
+    /* Insert the records for the new & moved chunks into the index */
+    if(ops->insert)
+        for(u = 0; u < nchunks; u++)
+            if(need_insert[u]) {
+                H5D_chunk_ud_t udata;           /* User data for inserting chunk info */
+
+                if(H5VM_array_calc_pre(chunks[u].index, dset->shared->ndims, layout->u.chunk.down_chunks, scaled) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't compute chunk coordinates")
+
+                udata.common.layout = &layout->u.chunk;
+                udata.common.storage = &layout->storage.u.chunk;
+                udata.common.scaled = scaled;
+                udata.chunk_block = chunks[u].chunk_block;
+                udata.filter_mask = chunks[u].filter_mask;
+
+                if((ops->insert)(&idx_info, &udata, dset) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+            } /* end if */
+
+    /* Reset any cached chunk info for this dataset */
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+
+done:
+    H5MM_xfree(need_insert);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_collective_realloc() */
 #endif /* H5_HAVE_PARALLEL */
 
 
@@ -4088,7 +5639,7 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to select hyperslab")
 
     /* Lock the chunk into the cache, to get a pointer to the chunk buffer */
-    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE)))
+    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, NULL)))
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
 
@@ -5070,6 +6621,10 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
         /* Set the source layout chunk information */
         if(H5D__chunk_set_info_real(layout_src, ndims, curr_dims, max_dims) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set layout's chunk info")
+
+        /* Call the index's "resize" callback */
+        if(storage_src->ops->resize && (storage_src->ops->resize)(layout_src) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to resize chunk index information")
     } /* end block */
 
     /* Compose source & dest chunked index info structs */
@@ -5433,6 +6988,68 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_dump_index() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_stats
+ *
+ * Purpose:	Retrieves the raw data chunk cache statistics and
+ *		configuration of a chunked dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_cache_stats(const H5D_t *dset, H5D_chunk_cache_stats_t *stats)
+{
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(stats);
+
+    stats->nhits = rdcc->stats.nhits;
+    stats->nmisses = rdcc->stats.nmisses;
+    stats->ninits = rdcc->stats.ninits;
+    stats->nevictions = rdcc->stats.nevictions;
+    stats->nflushes = rdcc->stats.nflushes;
+    stats->nbytes_read = rdcc->stats.nbytes_read;
+    stats->nbytes_written = rdcc->stats.nbytes_written;
+    stats->nused = (size_t)rdcc->nused;
+    stats->nbytes_used = rdcc->nbytes_used;
+    stats->nslots = rdcc->nslots;
+    stats->nbytes_max = rdcc->nbytes_max;
+    stats->policy = rdcc->policy;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_cache_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_reset_stats
+ *
+ * Purpose:	Resets the raw data chunk cache statistics of a chunked
+ *		dataset to zero.  The cached chunks are left alone.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_cache_reset_stats(const H5D_t *dset)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+
+    HDmemset(&dset->shared->cache.chunk.stats, 0, sizeof(dset->shared->cache.chunk.stats));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_cache_reset_stats() */
+
 #ifdef H5D_CHUNK_DEBUG
 
 /*-------------------------------------------------------------------------
@@ -5475,9 +7092,9 @@ H5D__chunk_stats(const H5D_t *dset, hbool_t headers)
 #endif
 
     if (headers) {
-        if (rdcc->nhits>0 || rdcc->nmisses>0) {
-            miss_rate = 100.0 * rdcc->nmisses /
-                    (rdcc->nhits + rdcc->nmisses);
+        if (rdcc->stats.nhits>0 || rdcc->stats.nmisses>0) {
+            miss_rate = 100.0 * (double)rdcc->stats.nmisses /
+                    (double)(rdcc->stats.nhits + rdcc->stats.nmisses);
         } else {
             miss_rate = 0.0;
         }
@@ -5487,9 +7104,9 @@ H5D__chunk_stats(const H5D_t *dset, hbool_t headers)
             sprintf(ascii, "%7.2f%%", miss_rate);
         }
 
-        fprintf(H5DEBUG(AC), "   %-18s %8u %8u %7s %8d+%-9ld\n",
-            "raw data chunks", rdcc->nhits, rdcc->nmisses, ascii,
-            rdcc->ninits, (long)(rdcc->nflushes)-(long)(rdcc->ninits));
+        HDfprintf(H5DEBUG(AC), "   %-18s %8Hu %8Hu %7s %8Hu+%-9ld\n",
+            "raw data chunks", rdcc->stats.nhits, rdcc->stats.nmisses, ascii,
+            rdcc->stats.ninits, (long)(rdcc->stats.nflushes)-(long)(rdcc->stats.ninits));
     }
 
 done:
@@ -5690,6 +7307,8 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
     /* Actually allocate space for the chunk in the file */
     if(alloc_chunk) {
 	switch(idx_info->storage->idx_type) {
+	    case H5D_CHUNK_IDX_FARRAY:
+	    case H5D_CHUNK_IDX_EARRAY:
 	    case H5D_CHUNK_IDX_BTREE:
                 HDassert(new_chunk->length > 0);
 		H5_CHECK_OVERFLOW(new_chunk->length, /*From: */uint32_t, /*To: */hsize_t);
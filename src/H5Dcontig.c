@@ -41,6 +41,7 @@
 #include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5MFprivate.h"	/* File memory management		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Oprivate.h"		/* Object headers		  	*/
 #include "H5Pprivate.h"		/* Property lists			*/
 #include "H5VMprivate.h"		/* Vector and array functions		*/
@@ -89,6 +90,14 @@ typedef struct H5D_contig_writevv_ud_t {
     hid_t dxpl_id;              /* DXPL for operation */
 } H5D_contig_writevv_ud_t;
 
+/* One block of a list being sorted by H5D__contig_vector_flush() */
+typedef struct H5D_contig_vector_blk_t {
+    haddr_t addr;               /* File address of block */
+    size_t size;                /* Size of block */
+    const unsigned char *buf;   /* Memory location of block */
+    size_t idx;                 /* Position of block in the unsorted list */
+} H5D_contig_vector_blk_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -112,6 +121,14 @@ static herr_t H5D__contig_flush(H5D_t *dset, hid_t dxpl_id);
 /* Helper routines */
 static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset,
     size_t size);
+static int H5D__contig_vector_cmp_blk(const void *_blk1, const void *_blk2);
+static herr_t H5D__contig_vector_cb(hsize_t dst_off, hsize_t src_off,
+    size_t len, void *_udata);
+static ssize_t H5D__contig_vector_build(const H5D_io_info_t *io_info,
+    hbool_t is_write,
+    size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_offset_arr[],
+    size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_offset_arr[],
+    H5D_contig_vector_ud_t *udata);
 
 
 /*********************/
@@ -602,14 +619,325 @@ H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     HDassert(mem_space);
     HDassert(file_space);
 
+    /* Read data straight into the application's buffer with one vector
+     * read when no conversion is needed and the driver takes lists of
+     * blocks.  In a multi-dataset read, the blocks are only queued, to
+     * be read along with those of the other datasets. */
+    if(io_info->io_ops.single_read == H5D__select_read
+            && io_info->layout_ops.readvv == H5D__contig_readvv
+            && type_info->is_conv_noop && type_info->is_xform_noop
+            && H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_VECTOR_IO)) {
+        H5D_contig_vector_ud_t vec;     /* Blocks to read */
+
+        HDmemset(&vec, 0, sizeof(vec));
+        H5_CHECK_OVERFLOW(nelmts, hsize_t, size_t);
+        if(H5D__contig_vector_add(io_info, type_info->src_type_size, (size_t)nelmts, file_space, mem_space,
+                io_info->multi ? &io_info->multi->vec : &vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't build block list")
+        if(NULL == io_info->multi && H5D__contig_vector_read(io_info, &vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "contiguous read failed")
+    } /* end if */
     /* Read data */
-    if((io_info->io_ops.single_read)(io_info, type_info, nelmts, file_space, mem_space) < 0)
+    else if((io_info->io_ops.single_read)(io_info, type_info, nelmts, file_space, mem_space) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "contiguous read failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_add
+ *
+ * Purpose:	Adds the blocks of a read or write of a selection of a
+ *		contiguous dataset (or of a chunk, through a contiguous I/O
+ *		info) to or from the application's buffer to a block list,
+ *		for a later H5D__contig_vector_read() or
+ *		H5D__contig_vector_flush().  The arrays in VEC grow as
+ *		needed; VEC must be zeroed before the first call, and all
+ *		calls for one list must be for the same kind of operation.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_vector_add(const H5D_io_info_t *io_info, size_t elmt_size,
+    size_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
+    H5D_contig_vector_ud_t *vec)
+{
+    H5S_sel_iter_t file_iter;           /* File selection iteration info */
+    hbool_t file_iter_init = FALSE;     /* File selection iteration info has been initialized */
+    H5S_sel_iter_t mem_iter;            /* Memory selection iteration info */
+    hbool_t mem_iter_init = FALSE;      /* Memory selection iteration info has been initialized */
+    hsize_t *file_off = NULL;           /* Sequence offsets in the file */
+    size_t *file_len = NULL;            /* Sequence lengths in the file */
+    hsize_t *mem_off = NULL;            /* Sequence offsets in memory */
+    size_t *mem_len = NULL;             /* Sequence lengths in memory */
+    size_t vec_size;                    /* Number of sequences to get at a time */
+    size_t curr_file_seq = 0, file_nseq = 0;    /* Current & number of file sequences */
+    size_t curr_mem_seq = 0, mem_nseq = 0;      /* Current & number of memory sequences */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(io_info);
+    HDassert(io_info->u.rbuf);
+    HDassert(elmt_size > 0);
+    HDassert(file_space);
+    HDassert(mem_space);
+    HDassert(vec);
+
+    HDassert(vec->nblocks == 0 || vec->is_write == (io_info->op_type == H5D_IO_OP_WRITE));
+
+    vec->dset_addr = io_info->store->contig.dset_addr;
+    vec->is_write = (hbool_t)(io_info->op_type == H5D_IO_OP_WRITE);
+    vec->rbuf = vec->is_write ? NULL : (unsigned char *)io_info->u.rbuf;
+    vec->wbuf = vec->is_write ? (const unsigned char *)io_info->u.wbuf : NULL;
+
+    /* Allocate the sequence arrays */
+    vec_size = MAX(io_info->dxpl_cache->vec_size, H5D_IO_VECTOR_SIZE);
+    if(NULL == (file_off = (hsize_t *)H5MM_malloc(vec_size * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate I/O offset vector array")
+    if(NULL == (file_len = (size_t *)H5MM_malloc(vec_size * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate I/O length vector array")
+    if(NULL == (mem_off = (hsize_t *)H5MM_malloc(vec_size * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate I/O offset vector array")
+    if(NULL == (mem_len = (size_t *)H5MM_malloc(vec_size * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate I/O length vector array")
+
+    /* Initialize the selection iterators */
+    if(H5S_select_iter_init(&file_iter, file_space, elmt_size) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+    file_iter_init = TRUE;
+    if(H5S_select_iter_init(&mem_iter, mem_space, elmt_size) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+    mem_iter_init = TRUE;
+
+    /* Pair up the file and memory sequences of the whole selection */
+    while(nelmts > 0) {
+        size_t nelem;                   /* Number of elements used in sequences */
+        size_t max_new;                 /* Most blocks the sequences can add */
+        ssize_t nbytes;                 /* Bytes added to the list */
+
+        /* Get more sequences when the current ones are used up */
+        if(curr_file_seq >= file_nseq) {
+            if(H5S_SELECT_GET_SEQ_LIST(file_space, H5S_GET_SEQ_LIST_SORTED, &file_iter, vec_size, nelmts, &file_nseq, &nelem, file_off, file_len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+            curr_file_seq = 0;
+        } /* end if */
+        if(curr_mem_seq >= mem_nseq) {
+            if(H5S_SELECT_GET_SEQ_LIST(mem_space, 0, &mem_iter, vec_size, nelmts, &mem_nseq, &nelem, mem_off, mem_len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+            curr_mem_seq = 0;
+        } /* end if */
+
+        /* Make room for the new blocks */
+        max_new = (file_nseq - curr_file_seq) + (mem_nseq - curr_mem_seq);
+        if(vec->nblocks + max_new > vec->max_nblocks) {
+            size_t new_max = MAX(2 * vec->max_nblocks, vec->nblocks + max_new);
+            haddr_t *new_addrs;
+            size_t *new_sizes;
+
+            if(NULL == (new_addrs = (haddr_t *)H5MM_realloc(vec->addrs, new_max * sizeof(haddr_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block address list")
+            vec->addrs = new_addrs;
+            if(NULL == (new_sizes = (size_t *)H5MM_realloc(vec->sizes, new_max * sizeof(size_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block size list")
+            vec->sizes = new_sizes;
+            if(vec->is_write) {
+                const void **new_bufs;
+
+                if(NULL == (new_bufs = (const void **)H5MM_realloc(vec->wbufs, new_max * sizeof(const void *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block buffer list")
+                vec->wbufs = new_bufs;
+            } /* end if */
+            else {
+                void **new_bufs;
+
+                if(NULL == (new_bufs = (void **)H5MM_realloc(vec->rbufs, new_max * sizeof(void *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block buffer list")
+                vec->rbufs = new_bufs;
+            } /* end else */
+            vec->max_nblocks = new_max;
+        } /* end if */
+
+        /* Add the blocks */
+        if((nbytes = H5VM_opvv(file_nseq, &curr_file_seq, file_len, file_off,
+                mem_nseq, &curr_mem_seq, mem_len, mem_off,
+                H5D__contig_vector_cb, vec)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't build block list")
+        HDassert(((size_t)nbytes % elmt_size) == 0);
+        nelmts -= (size_t)nbytes / elmt_size;
+    } /* end while */
+
+done:
+    /* Release selection iterators */
+    if(file_iter_init && H5S_SELECT_ITER_RELEASE(&file_iter) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+    if(mem_iter_init && H5S_SELECT_ITER_RELEASE(&mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+
+    H5MM_xfree(file_off);
+    H5MM_xfree(file_len);
+    H5MM_xfree(mem_off);
+    H5MM_xfree(mem_len);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_vector_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_read
+ *
+ * Purpose:	Reads all the blocks in a list built by
+ *		H5D__contig_vector_add() with one call to
+ *		H5F_block_read_vector(), then releases the list, whether
+ *		the read succeeded or not.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_vector_read(const H5D_io_info_t *io_info, H5D_contig_vector_ud_t *vec)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(io_info);
+    HDassert(vec);
+
+    /* Read them all at once */
+    if(vec->nblocks > 0 && H5F_block_read_vector(io_info->dset->oloc.file, vec->nblocks, vec->addrs, vec->sizes, io_info->raw_dxpl_id, vec->rbufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+
+done:
+    vec->addrs = (haddr_t *)H5MM_xfree(vec->addrs);
+    vec->sizes = (size_t *)H5MM_xfree(vec->sizes);
+    vec->rbufs = (void **)H5MM_xfree(vec->rbufs);
+    vec->nblocks = vec->max_nblocks = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_vector_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_cmp_blk
+ *
+ * Purpose:	Compares two blocks by file address, then by their position
+ *		in the list they came from, for H5D__contig_vector_flush().
+ *
+ * Return:	-1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__contig_vector_cmp_blk(const void *_blk1, const void *_blk2)
+{
+    const H5D_contig_vector_blk_t *blk1 = (const H5D_contig_vector_blk_t *)_blk1;
+    const H5D_contig_vector_blk_t *blk2 = (const H5D_contig_vector_blk_t *)_blk2;
+    int ret_value;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_ne(blk1->addr, blk2->addr))
+        ret_value = H5F_addr_cmp(blk1->addr, blk2->addr);
+    else
+        ret_value = (blk1->idx > blk2->idx) - (blk1->idx < blk2->idx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_vector_cmp_blk() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_flush
+ *
+ * Purpose:	Sorts the blocks in a list built by H5D__contig_vector_add()
+ *		(possibly for several datasets in file F) by file address,
+ *		merges blocks that are adjacent both in the file and in
+ *		memory, and reads or writes them all with one call to
+ *		H5F_block_read_vector() or H5F_block_write_vector().  The
+ *		list is released, whether the I/O succeeded or not.
+ *
+ *		Blocks at the same address keep the order they were added
+ *		in, so the later of two overlapping writes is queued last.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_vector_flush(const H5F_t *f, hid_t dxpl_id, H5D_contig_vector_ud_t *vec)
+{
+    H5D_contig_vector_blk_t *blks = NULL;      /* Blocks to sort */
+    size_t nblocks;                     /* # of blocks after merging */
+    size_t first = 0;                   /* First sorted block in the current merged block */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(f);
+    HDassert(vec);
+
+    if(vec->nblocks == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Sort the blocks by address */
+    if(NULL == (blks = (H5D_contig_vector_blk_t *)H5MM_malloc(vec->nblocks * sizeof(H5D_contig_vector_blk_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block list")
+    for(u = 0; u < vec->nblocks; u++) {
+        blks[u].addr = vec->addrs[u];
+        blks[u].size = vec->sizes[u];
+        blks[u].buf = vec->is_write ? (const unsigned char *)vec->wbufs[u] : (const unsigned char *)vec->rbufs[u];
+        blks[u].idx = u;
+    } /* end for */
+    HDqsort(blks, vec->nblocks, sizeof(H5D_contig_vector_blk_t), H5D__contig_vector_cmp_blk);
+
+    /* Merge blocks that continue each other in the file and in memory */
+    nblocks = 0;
+    for(u = 0; u < vec->nblocks; u++) {
+        if(nblocks > 0 && H5F_addr_eq(vec->addrs[nblocks - 1] + vec->sizes[nblocks - 1], blks[u].addr)
+                && blks[first].buf + vec->sizes[nblocks - 1] == blks[u].buf)
+            vec->sizes[nblocks - 1] += blks[u].size;
+        else {
+            first = u;
+            vec->addrs[nblocks] = blks[u].addr;
+            vec->sizes[nblocks] = blks[u].size;
+            if(vec->is_write)
+                vec->wbufs[nblocks] = blks[u].buf;
+            else
+                vec->rbufs[nblocks] = (void *)blks[u].buf;
+            nblocks++;
+        } /* end else */
+    } /* end for */
+    vec->nblocks = nblocks;
+
+    /* Access them all at once */
+    if(vec->is_write) {
+        if(H5F_block_write_vector(f, vec->nblocks, vec->addrs, vec->sizes, dxpl_id, vec->wbufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
+    else
+        if(H5F_block_read_vector(f, vec->nblocks, vec->addrs, vec->sizes, dxpl_id, vec->rbufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+
+done:
+    H5MM_xfree(blks);
+    vec->addrs = (haddr_t *)H5MM_xfree(vec->addrs);
+    vec->sizes = (size_t *)H5MM_xfree(vec->sizes);
+    vec->rbufs = (void **)H5MM_xfree(vec->rbufs);
+    vec->wbufs = (const void **)H5MM_xfree(vec->wbufs);
+    vec->nblocks = vec->max_nblocks = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_vector_flush() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_write
@@ -639,8 +967,19 @@ H5D__contig_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     HDassert(mem_space);
     HDassert(file_space);
 
+    /* In a multi-dataset write, queue the blocks to be written along with
+     * those of the other datasets, when no conversion is needed and the
+     * driver takes lists of blocks */
+    if(io_info->multi && io_info->io_ops.single_write == H5D__select_write
+            && io_info->layout_ops.writevv == H5D__contig_writevv
+            && type_info->is_conv_noop && type_info->is_xform_noop
+            && H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_VECTOR_IO)) {
+        H5_CHECK_OVERFLOW(nelmts, hsize_t, size_t);
+        if(H5D__contig_vector_add(io_info, type_info->src_type_size, (size_t)nelmts, file_space, mem_space, &io_info->multi->vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't build block list")
+    } /* end if */
     /* Write data */
-    if((io_info->io_ops.single_write)(io_info, type_info, nelmts, file_space, mem_space) < 0)
+    else if((io_info->io_ops.single_write)(io_info, type_info, nelmts, file_space, mem_space) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "contiguous write failed")
 
 done:
@@ -685,6 +1024,107 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__contig_write_one() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_vector_build(), adds one
+ *		block to the list.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vector_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+{
+    H5D_contig_vector_ud_t *udata = (H5D_contig_vector_ud_t *)_udata; /* User data for H5VM_opvv() operator */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(udata->nblocks < udata->max_nblocks);
+
+    /* Add the block */
+    udata->addrs[udata->nblocks] = udata->dset_addr + dst_off;
+    udata->sizes[udata->nblocks] = len;
+    if(udata->is_write)
+        udata->wbufs[udata->nblocks] = udata->wbuf + src_off;
+    else
+        udata->rbufs[udata->nblocks] = udata->rbuf + src_off;
+    udata->nblocks++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+}   /* end H5D__contig_vector_cb() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_build
+ *
+ * Purpose:	Turns the dataset and memory sequences of a readvv or
+ *		writevv operation into a list of file blocks, for drivers
+ *		that set H5FD_FEAT_VECTOR_IO.  On success the block arrays
+ *		in UDATA must be freed by the caller.
+ *
+ * Return:	Success:	Number of bytes in the blocks
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static ssize_t
+H5D__contig_vector_build(const H5D_io_info_t *io_info, hbool_t is_write,
+    size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
+    size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[],
+    H5D_contig_vector_ud_t *udata)
+{
+    ssize_t ret_value = -1;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Each operation consumes at least one dataset or memory sequence */
+    udata->dset_addr = io_info->store->contig.dset_addr;
+    udata->is_write = is_write;
+    udata->rbuf = is_write ? NULL : (unsigned char *)io_info->u.rbuf;
+    udata->wbuf = is_write ? (const unsigned char *)io_info->u.wbuf : NULL;
+    udata->max_nblocks = (dset_max_nseq - *dset_curr_seq) + (mem_max_nseq - *mem_curr_seq);
+    HDassert(udata->max_nblocks > 0);
+    udata->nblocks = 0;
+    udata->addrs = NULL;
+    udata->sizes = NULL;
+    udata->rbufs = NULL;
+    udata->wbufs = NULL;
+
+    /* Allocate the block list */
+    if(NULL == (udata->addrs = (haddr_t *)H5MM_malloc(udata->max_nblocks * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block address list")
+    if(NULL == (udata->sizes = (size_t *)H5MM_malloc(udata->max_nblocks * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block size list")
+    if(is_write) {
+        if(NULL == (udata->wbufs = (const void **)H5MM_malloc(udata->max_nblocks * sizeof(const void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block buffer list")
+    } /* end if */
+    else
+        if(NULL == (udata->rbufs = (void **)H5MM_malloc(udata->max_nblocks * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block buffer list")
+
+    /* Call generic sequence operation routine */
+    if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+            mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+            H5D__contig_vector_cb, udata)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't build block list")
+
+done:
+    if(ret_value < 0) {
+        udata->addrs = (haddr_t *)H5MM_xfree(udata->addrs);
+        udata->sizes = (size_t *)H5MM_xfree(udata->sizes);
+        udata->rbufs = (void **)H5MM_xfree(udata->rbufs);
+        udata->wbufs = (const void **)H5MM_xfree(udata->wbufs);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_vector_build() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
@@ -735,7 +1175,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
     if(NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if(len > dset_contig->sieve_buf_size) {
-            if(H5F_block_read(file, H5FD_MEM_DRAW, addr, len, udata->dxpl_id, buf) < 0)
+            if(H5F_block_read_concurrent(file, addr, len, udata->dxpl_id, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
         } /* end if */
         else {
@@ -803,7 +1243,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
                 } /* end if */
 
                 /* Read directly into the user's buffer */
-                if(H5F_block_read(file, H5FD_MEM_DRAW, addr, len, udata->dxpl_id, buf) < 0)
+                if(H5F_block_read_concurrent(file, addr, len, udata->dxpl_id, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
             } /* end if */
             /* Element size fits within the buffer size */
@@ -880,7 +1320,7 @@ H5D__contig_readvv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata
     FUNC_ENTER_STATIC
 
     /* Write data */
-    if(H5F_block_read(udata->file, H5FD_MEM_DRAW, (udata->dset_addr + dst_off),
+    if(H5F_block_read_concurrent(udata->file, (udata->dset_addr + dst_off),
             len, udata->dxpl_id, (udata->rbuf + src_off)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
@@ -925,8 +1365,28 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check if the driver takes lists of blocks (which replaces data sieving) */
+    if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_VECTOR_IO)) {
+        H5D_contig_vector_ud_t udata;           /* User data for H5VM_opvv() operator */
+        herr_t status;                          /* Status from I/O operation */
+
+        /* Gather the blocks to read */
+        if((ret_value = H5D__contig_vector_build(io_info, FALSE,
+                dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr, &udata)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
+
+        /* Read them all at once */
+        status = H5F_block_read_vector(io_info->dset->oloc.file, udata.nblocks, udata.addrs,
+                udata.sizes, io_info->raw_dxpl_id, udata.rbufs);
+        H5MM_xfree(udata.addrs);
+        H5MM_xfree(udata.sizes);
+        H5MM_xfree(udata.rbufs);
+        if(status < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
+    else if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata;     /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -1251,8 +1711,28 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check if the driver takes lists of blocks (which replaces data sieving) */
+    if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_VECTOR_IO)) {
+        H5D_contig_vector_ud_t udata;           /* User data for H5VM_opvv() operator */
+        herr_t status;                          /* Status from I/O operation */
+
+        /* Gather the blocks to write */
+        if((ret_value = H5D__contig_vector_build(io_info, TRUE,
+                dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr, &udata)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized write")
+
+        /* Write them all at once */
+        status = H5F_block_write_vector(io_info->dset->oloc.file, udata.nblocks, udata.addrs,
+                udata.sizes, io_info->raw_dxpl_id, udata.wbufs);
+        H5MM_xfree(udata.addrs);
+        H5MM_xfree(udata.sizes);
+        H5MM_xfree(udata.wbufs);
+        if(status < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
+    else if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_writevv_sieve_ud_t udata;    /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
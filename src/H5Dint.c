@@ -392,6 +392,10 @@ H5D__get_dxpl_cache_real(hid_t dxpl_id, H5D_dxpl_cache_t *cache)
     if(H5P_peek(dx_plist, H5D_XFER_XFORM_NAME, &cache->data_xform_prop) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "Can't retrieve data transform info")
 
+    /* Get the number of threads for the chunk filter pipeline */
+    if(H5P_get(dx_plist, H5D_XFER_FILTER_NTHREADS_NAME, &cache->filter_nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "Can't retrieve filter thread count")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__get_dxpl_cache_real() */
@@ -1201,10 +1205,6 @@ H5D__create(H5F_t *file, hid_t type_id, const H5S_t *space, hid_t dcpl_id,
         /* Don't allow compact datasets to allocate space later */
         if(layout->type == H5D_COMPACT && fill->alloc_time != H5D_ALLOC_TIME_EARLY)
             HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, NULL, "compact dataset must have early space allocation")
-
-        /* If MPI VFD is used, no filter support yet. */
-        if(H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI) && pline->nused > 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "Parallel I/O does not support filters yet")
     } /* end if */
 
     /* Set the latest version of the layout, pline & fill messages, if requested */
@@ -2404,7 +2404,7 @@ H5D__vlen_get_buf_size(void H5_ATTR_UNUSED *elem, hid_t type_id, unsigned H5_ATT
         HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't select point")
 
     /* Read in the point (with the custom VL memory allocator) */
-    if(H5D__read(vlen_bufsize->dset, type_id, vlen_bufsize->mspace, vlen_bufsize->fspace, vlen_bufsize->xfer_pid, vlen_bufsize->fl_tbuf) < 0)
+    if(H5D__read(vlen_bufsize->dset, type_id, vlen_bufsize->mspace, vlen_bufsize->fspace, vlen_bufsize->xfer_pid, vlen_bufsize->fl_tbuf, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read point")
 
 done:
@@ -2503,6 +2503,12 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size, hid_t dxpl_id)
     if(H5D_CONTIGUOUS == dset->shared->layout.type && 0 == dset->shared->dcpl_cache.efl.nused)
         HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "dataset has contiguous storage")
 
+    /* A SWMR writer can only grow datasets whose chunk index is flushed in
+     *  dependency order (not the v1 B-tree) */
+    if((H5F_INTENT(dset->oloc.file) & H5F_ACC_SWMR_WRITE) && H5D_CHUNKED == dset->shared->layout.type
+            && H5D_CHUNK_IDX_BTREE == dset->shared->layout.storage.u.chunk.idx_type)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "can't extend a dataset with a v1 B-tree chunk index during SWMR writing")
+
     /* Check if the filters in the DCPL will need to encode, and if so, can they? */
     if(H5D__check_filters(dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't apply filters")
@@ -2640,6 +2646,113 @@ done:
 } /* end H5D__set_extent() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__refresh
+ *
+ * Purpose:     Bring a dataset opened by a reader up to date with
+ *              changes made by a SWMR writer: evict the dataset's object
+ *              header and index metadata from the cache and re-read the
+ *              dataspace and storage location, without reopening the
+ *              dataset or the file.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__refresh(H5D_t *dset, hid_t dxpl_id)
+{
+    H5S_t *space = NULL;                /* Dataspace re-read from the file */
+    H5O_layout_t layout;                /* Layout message re-read from the file */
+    hbool_t layout_read = FALSE;        /* Whether the layout message was read */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
+
+    /* Check args */
+    HDassert(dset);
+
+    /* The writer's view of the dataset is always current */
+    if(H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR)
+        HGOTO_DONE(SUCCEED)
+
+    /* Release cached raw data and the open chunk index, so that the index
+     * metadata can be evicted below.
+     */
+    if(H5D_CHUNKED == dset->shared->layout.type) {
+        if(H5D__chunk_index_close(dset, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release chunk index")
+    } /* end if */
+    else if(H5D_CONTIGUOUS == dset->shared->layout.type) {
+        if(dset->shared->cache.contig.sieve_buf)
+            dset->shared->cache.contig.sieve_buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, dset->shared->cache.contig.sieve_buf);
+        dset->shared->cache.contig.sieve_loc = HADDR_UNDEF;
+        dset->shared->cache.contig.sieve_size = 0;
+    } /* end if */
+
+    /* Evict the object header and all other metadata tagged with it */
+    if(H5AC_evict_tagged_metadata(dset->oloc.file, dset->oloc.addr, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTEXPUNGE, FAIL, "unable to evict dataset metadata")
+
+    /* Re-read the dataspace, which the writer may have extended */
+    if(NULL == (space = H5S_read(&(dset->oloc), dxpl_id)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to load dataspace info from dataset header")
+    if(H5S_close(dset->shared->space) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataspace")
+    dset->shared->space = space;
+    space = NULL;
+    if(H5D__cache_dataspace_info(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't cache dataspace info")
+
+    /* Pick up the current storage location from the layout message */
+    if(H5D_VIRTUAL != dset->shared->layout.type) {
+        if(NULL == H5O_msg_read(&(dset->oloc), H5O_LAYOUT_ID, &layout, dxpl_id))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to read data layout message")
+        layout_read = TRUE;
+        HDassert(layout.type == dset->shared->layout.type);
+
+        switch(dset->shared->layout.type) {
+            case H5D_CHUNKED:
+                dset->shared->layout.storage.u.chunk.idx_addr = layout.storage.u.chunk.idx_addr;
+                break;
+
+            case H5D_CONTIGUOUS:
+                dset->shared->layout.storage.u.contig.addr = layout.storage.u.contig.addr;
+                dset->shared->layout.storage.u.contig.size = layout.storage.u.contig.size;
+                break;
+
+            case H5D_COMPACT:
+                /* Take over the newly read raw data buffer */
+                HDassert(layout.storage.u.compact.size == dset->shared->layout.storage.u.compact.size);
+                H5MM_xfree(dset->shared->layout.storage.u.compact.buf);
+                dset->shared->layout.storage.u.compact.buf = layout.storage.u.compact.buf;
+                layout.storage.u.compact.buf = NULL;
+                break;
+
+            case H5D_VIRTUAL:
+            case H5D_LAYOUT_ERROR:
+            case H5D_NLAYOUTS:
+            default:
+                HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unsupported storage layout")
+        } /* end switch */
+    } /* end if */
+
+    /* Set up the chunk index again, for the new dimensions */
+    if(H5D_CHUNKED == dset->shared->layout.type)
+        if(H5D__chunk_index_reopen(dset, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up chunk index")
+
+done:
+    if(space && H5S_close(space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataspace")
+    if(layout_read && H5O_msg_reset(H5O_LAYOUT_ID, &layout) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "unable to reset layout message")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__refresh() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__flush_sieve_buf
  *
@@ -2929,6 +3042,10 @@ H5D_get_create_plist(H5D_t *dset)
 
             /* Reset chunk index ops */
             copied_layout.storage.u.chunk.ops = NULL;
+
+            /* Reset chunk index type (chosen again when a dataset is created) */
+            copied_layout.version = H5O_LAYOUT_VERSION_DEFAULT;
+            copied_layout.storage.u.chunk.idx_type = H5D_CHUNK_IDX_BTREE;
             break;
 
         case H5D_VIRTUAL:
@@ -3080,6 +3197,8 @@ H5D_get_access_plist(H5D_t *dset)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache byte size")
         if (H5P_set(new_plist, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &(dset->shared->cache.chunk.w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set preempt read chunks")
+        if (H5P_set(new_plist, H5D_ACS_CHUNK_CACHE_POLICY_NAME, &(dset->shared->cache.chunk.policy)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk cache policy")
     } /* end if */
 
     /* Set the return value */
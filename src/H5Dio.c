@@ -54,6 +54,15 @@
 /* Internal I/O routines */
 static herr_t H5D__pre_write(H5D_t *dset, hbool_t direct_write, hid_t mem_type_id, 
     const H5S_t *mem_space, const H5S_t *file_space, hid_t dxpl_id, const void *buf);
+static herr_t H5D__multi_args(size_t count, const hid_t dset_id[],
+    const hid_t mem_space_id[], const hid_t file_space_id[], H5D_t *dsets[],
+    const H5S_t *mem_spaces[], const H5S_t *file_spaces[]);
+static herr_t H5D__read_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[],
+    const H5S_t *mem_spaces[], const H5S_t *file_spaces[], hid_t dxpl_id,
+    void *bufs[]);
+static herr_t H5D__write_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[],
+    const H5S_t *mem_spaces[], const H5S_t *file_spaces[], hid_t dxpl_id,
+    const void *bufs[]);
 
 /* Setup/teardown routines */
 static herr_t H5D__ioinfo_init(H5D_t *dset,
@@ -126,6 +135,7 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     H5D_t		   *dset = NULL;
     const H5S_t		   *mem_space = NULL;
     const H5S_t		   *file_space = NULL;
+    H5D_read_hold_t         hold = {-1, -1};      /* IDs kept open during the read */
     herr_t                  ret_value = SUCCEED;  /* Return value */
 
     FUNC_ENTER_API(FAIL)
@@ -165,11 +175,18 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
         if(TRUE != H5P_isa_class(plist_id, H5P_DATASET_XFER))
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
 
+    /* Keep the dataset open, if other threads may run during the read */
+    if(H5D__read_hold(dset, dset_id, &hold) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't hold dataset open")
+
     /* read raw data */
-    if(H5D__read(dset, mem_type_id, mem_space, file_space, plist_id, buf/*out*/) < 0)
+    if(H5D__read(dset, mem_type_id, mem_space, file_space, plist_id, buf/*out*/, NULL) < 0)
 	HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
+    if(H5D__read_release(&hold) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset")
+
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread() */
 
@@ -271,6 +288,228 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dread_multi
+ *
+ * Purpose:	Reads (part of) COUNT datasets from the file into
+ *		application memory, in one operation.  Entry U of each
+ *		array holds the arguments H5Dread() would take for the U'th
+ *		dataset; all the datasets are read with the transfer
+ *		properties in DXPL_ID.
+ *
+ *		When the datasets are in the same file, the parts of the
+ *		file that can be read straight into the application's
+ *		buffers (contiguous datasets and chunks that bypass the
+ *		chunk cache, needing no type conversion) are read together:
+ *		with one sorted vector request on drivers that take lists
+ *		of blocks, or with one collective MPI-IO call for
+ *		contiguous datasets under collective I/O with the MPI-IO
+ *		driver.  Everything else is read as by H5Dread().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+    void *buf[]/*out*/)
+{
+    H5D_t	          **dsets = NULL;       /* Datasets to read */
+    const H5S_t           **mem_spaces = NULL;  /* Memory dataspaces */
+    const H5S_t           **file_spaces = NULL; /* File dataspaces */
+    H5D_read_hold_t        *holds = NULL;       /* IDs kept open during the read */
+    size_t                  nholds = 0;         /* # of datasets held */
+    size_t                  u;                  /* Local index variable */
+    herr_t                  ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* check arguments */
+    if(count == 0)
+        HGOTO_DONE(SUCCEED)
+    if(!dset_id || !mem_type_id || !mem_space_id || !file_space_id || !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "argument arrays can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Look up the datasets and dataspaces */
+    if(NULL == (dsets = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset array")
+    if(NULL == (mem_spaces = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataspace array")
+    if(NULL == (file_spaces = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataspace array")
+    if(H5D__multi_args(count, dset_id, mem_space_id, file_space_id, dsets, mem_spaces, file_spaces) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid dataset or dataspace")
+
+    /* Keep the datasets open, if other threads may run during the read */
+    if(NULL == (holds = (H5D_read_hold_t *)H5MM_malloc(count * sizeof(H5D_read_hold_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate hold array")
+    for(u = 0; u < count; u++) {
+        if(H5D__read_hold(dsets[u], dset_id[u], &holds[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't hold dataset open")
+        nholds++;
+    } /* end for */
+
+    /* read raw data */
+    if(H5D__read_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, dxpl_id, buf/*out*/) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    for(u = 0; u < nholds; u++)
+        if(H5D__read_release(&holds[u]) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset")
+    H5MM_xfree(holds);
+    H5MM_xfree(dsets);
+    H5MM_xfree(mem_spaces);
+    H5MM_xfree(file_spaces);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dwrite_multi
+ *
+ * Purpose:	Writes (part of) COUNT datasets from application memory to
+ *		the file, in one operation.  Entry U of each array holds
+ *		the arguments H5Dwrite() would take for the U'th dataset;
+ *		all the datasets are written with the transfer properties
+ *		in DXPL_ID, which can't ask for a direct chunk write.
+ *
+ *		The parts of the file that can be written straight from the
+ *		application's buffers are written together, as in
+ *		H5Dread_multi().  The selections of a dataset listed more
+ *		than once must not overlap.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+    const void *buf[])
+{
+    H5D_t	          **dsets = NULL;       /* Datasets to write */
+    const H5S_t           **mem_spaces = NULL;  /* Memory dataspaces */
+    const H5S_t           **file_spaces = NULL; /* File dataspaces */
+    H5P_genplist_t 	   *plist;              /* Property list pointer */
+    hbool_t                 direct_write = FALSE;
+    herr_t                  ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* check arguments */
+    if(count == 0)
+        HGOTO_DONE(SUCCEED)
+    if(!dset_id || !mem_type_id || !mem_space_id || !file_space_id || !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "argument arrays can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Direct chunk writes take one chunk of one dataset */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+    if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_WRITE_FLAG_NAME, &direct_write) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting flag for direct chunk write")
+    if(direct_write)
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "direct chunk write not supported for multiple datasets")
+
+    /* Look up the datasets and dataspaces */
+    if(NULL == (dsets = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset array")
+    if(NULL == (mem_spaces = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataspace array")
+    if(NULL == (file_spaces = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataspace array")
+    if(H5D__multi_args(count, dset_id, mem_space_id, file_space_id, dsets, mem_spaces, file_spaces) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid dataset or dataspace")
+
+    /* write raw data */
+    if(H5D__write_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, dxpl_id, buf) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(dsets);
+    H5MM_xfree(mem_spaces);
+    H5MM_xfree(file_spaces);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_args
+ *
+ * Purpose:	Looks up and checks the datasets and dataspaces passed to
+ *		H5Dread_multi() or H5Dwrite_multi().  Entries of MEM_SPACES
+ *		and FILE_SPACES for H5S_ALL are set to NULL.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_args(size_t count, const hid_t dset_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], H5D_t *dsets[], const H5S_t *mem_spaces[],
+    const H5S_t *file_spaces[])
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for(u = 0; u < count; u++) {
+        if(NULL == (dsets[u] = (H5D_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+        if(NULL == dsets[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+
+        if(mem_space_id[u] < 0 || file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+        mem_spaces[u] = NULL;
+        if(H5S_ALL != mem_space_id[u]) {
+            if(NULL == (mem_spaces[u] = (const H5S_t *)H5I_object_verify(mem_space_id[u], H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(mem_spaces[u]) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "memory selection+offset not within extent")
+        } /* end if */
+        file_spaces[u] = NULL;
+        if(H5S_ALL != file_space_id[u]) {
+            if(NULL == (file_spaces[u] = (const H5S_t *)H5I_object_verify(file_space_id[u], H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(file_spaces[u]) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "file selection+offset not within extent")
+        } /* end if */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_args() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__pre_write
@@ -340,7 +579,7 @@ H5D__pre_write(H5D_t *dset, hbool_t direct_write, hid_t mem_type_id,
     } /* end if */
     else {     /* Normal write */
         /* write raw data */
-        if(H5D__write(dset, mem_type_id, mem_space, file_space, dxpl_id, buf) < 0)
+        if(H5D__write(dset, mem_type_id, mem_space, file_space, dxpl_id, buf, NULL) < 0)
 	    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
     } /* end else */
 
@@ -349,12 +588,116 @@ done:
 } /* end H5D__pre_write() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_hold
+ *
+ * Purpose:	Keep a dataset, and the file it is in, from being closed by
+ *		another thread while a read of the dataset has given up the
+ *		API lock (see H5F_block_read_concurrent).  A reference is
+ *		taken on the dataset's ID and, when the file's close degree
+ *		is "strong" (closing the file closes every object in it), on
+ *		the file's ID.  H5D__read_release drops them again.
+ *
+ *		Nothing is held in builds without thread-safety, or for
+ *		files open for writing, which never give up the lock.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_hold(const H5D_t
+#ifndef H5_HAVE_THREADSAFE
+    H5_ATTR_UNUSED
+#endif /* H5_HAVE_THREADSAFE */
+    *dataset, hid_t
+#ifndef H5_HAVE_THREADSAFE
+    H5_ATTR_UNUSED
+#endif /* H5_HAVE_THREADSAFE */
+    dset_id, H5D_read_hold_t *hold)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(hold);
+
+    hold->dset_id = -1;
+    hold->file_id = -1;
+
+#ifdef H5_HAVE_THREADSAFE
+    HDassert(dataset);
+
+    if(!(H5F_INTENT(dataset->oloc.file) & H5F_ACC_RDWR)) {
+        H5F_t *file = dataset->oloc.file;       /* Dataset's file */
+
+        if(H5I_inc_ref(dset_id, FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataset ID")
+        hold->dset_id = dset_id;
+
+        if(H5F_CLOSE_STRONG == H5F_GET_FC_DEGREE(file) && H5F_FILE_ID(file) > 0) {
+            if(H5I_inc_ref(H5F_FILE_ID(file), FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment file ID")
+            hold->file_id = H5F_FILE_ID(file);
+        } /* end if */
+    } /* end if */
+
+done:
+    if(ret_value < 0)
+        if(H5D__read_release(hold) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset")
+#endif /* H5_HAVE_THREADSAFE */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_hold() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_release
+ *
+ * Purpose:	Drop the references taken by H5D__read_hold.  This may
+ *		close the dataset and its file, if another thread closed
+ *		them during the read.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_release(H5D_read_hold_t *hold)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(hold);
+
+    /* Release the dataset before the file it's in */
+    if(hold->dset_id > 0) {
+        if(H5I_dec_ref(hold->dset_id) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataset ID")
+        hold->dset_id = -1;
+    } /* end if */
+    if(hold->file_id > 0) {
+        if(H5I_dec_ref(hold->file_id) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement file ID")
+        hold->file_id = -1;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_release() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__read
  *
  * Purpose:	Reads (part of) a DATASET into application memory BUF. See
  *		H5Dread() for complete details.
  *
+ *		When MULTI is not NULL, reads that can be merged with those
+ *		of other datasets are only queued in it; see
+ *		H5D__read_multi().
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -364,7 +707,8 @@ done:
  */
 herr_t
 H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
-	 const H5S_t *file_space, hid_t dxpl_id, void *buf/*out*/)
+	 const H5S_t *file_space, hid_t dxpl_id, void *buf/*out*/,
+         H5D_multi_io_t *multi)
 {
     H5D_chunk_map_t fm;                 /* Chunk file<->memory mapping */
     H5D_io_info_t io_info;              /* Dataset I/O info     */
@@ -513,6 +857,7 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     /* Set up I/O operation */
     io_info.op_type = H5D_IO_OP_READ;
     io_info.u.rbuf = buf;
+    io_info.multi = multi;
     if(H5D__ioinfo_init(dataset, dxpl_cache, dxpl_id, &type_info, &store, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to set up I/O operation")
     io_info_init = TRUE;
@@ -576,6 +921,10 @@ done:
  * Purpose:	Writes (part of) a DATASET to a file from application memory
  *		BUF. See H5Dwrite() for complete details.
  *
+ *		When MULTI is not NULL, writes that can be merged with those
+ *		of other datasets are only queued in it; see
+ *		H5D__write_multi().
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -585,7 +934,8 @@ done:
  */
 herr_t
 H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
-	  const H5S_t *file_space, hid_t dxpl_id, const void *buf)
+	  const H5S_t *file_space, hid_t dxpl_id, const void *buf,
+          H5D_multi_io_t *multi)
 {
     H5D_chunk_map_t fm;                 /* Chunk file<->memory mapping */
     H5D_io_info_t io_info;              /* Dataset I/O info     */
@@ -659,10 +1009,13 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
                 H5T_get_ref_type(type_info.mem_type) == H5R_DATASET_REGION)
             HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "Parallel IO does not support writing region reference datatypes yet")
 
-        /* Can't write to chunked datasets with filters, in parallel */
+        /* Chunked datasets with filters can only be written collectively
+         * in parallel, since every process must agree on the new size and
+         * location of each chunk */
         if(dataset->shared->layout.type == H5D_CHUNKED &&
-                dataset->shared->dcpl_cache.pline.nused > 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot write to chunked storage with filters in parallel")
+                dataset->shared->dcpl_cache.pline.nused > 0 &&
+                dxpl_cache->xfer_mode != H5FD_MPIO_COLLECTIVE)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot write to chunked storage with filters in parallel without collective I/O")
     } /* end if */
     else {
         /* Collective access is not permissible without a MPI based VFD */
@@ -740,6 +1093,7 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     /* Set up I/O operation */
     io_info.op_type = H5D_IO_OP_WRITE;
     io_info.u.wbuf = buf;
+    io_info.multi = multi;
     if(H5D__ioinfo_init(dataset, dxpl_cache, dxpl_id, &type_info, &store, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up I/O operation")
     io_info_init = TRUE;
@@ -829,6 +1183,127 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* end H5D__write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_multi
+ *
+ * Purpose:	Reads (part of) COUNT datasets into application memory.
+ *		See H5Dread_multi() for complete details.
+ *
+ *		Each dataset is read by H5D__read(), which only queues the
+ *		accesses that can be merged; those of the datasets in the
+ *		first dataset's file are issued together at the end.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__read_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[],
+    const H5S_t *mem_spaces[], const H5S_t *file_spaces[], hid_t dxpl_id,
+    void *bufs[])
+{
+    H5D_multi_io_t multi;               /* Accesses gathered from all the datasets */
+    H5F_t *file;                        /* File whose accesses are gathered */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(count > 0);
+    HDassert(dsets && mem_type_ids && mem_spaces && file_spaces && bufs);
+
+    HDmemset(&multi, 0, sizeof(multi));
+    file = dsets[0]->oloc.file;
+
+    /* Set up and queue the read of each dataset */
+    for(u = 0; u < count; u++)
+        if(H5D__read(dsets[u], mem_type_ids[u], mem_spaces[u], file_spaces[u], dxpl_id, bufs[u],
+                H5F_SAME_SHARED(dsets[u]->oloc.file, file) ? &multi : NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+    /* Issue the gathered reads */
+    if(H5D__contig_vector_flush(file, dxpl_id, &multi.vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+#ifdef H5_HAVE_PARALLEL
+    if(H5D__mpio_multi_io(dsets[0], dxpl_id, H5D_IO_OP_READ, &multi) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+#endif /* H5_HAVE_PARALLEL */
+
+done:
+    /* Release the gathered accesses, after a failure */
+    H5MM_xfree(multi.vec.addrs);
+    H5MM_xfree(multi.vec.sizes);
+    H5MM_xfree(multi.vec.rbufs);
+    H5MM_xfree(multi.vec.wbufs);
+#ifdef H5_HAVE_PARALLEL
+    if(H5D__mpio_multi_reset(&multi) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release collective accesses")
+#endif /* H5_HAVE_PARALLEL */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_multi
+ *
+ * Purpose:	Writes (part of) COUNT datasets from application memory.
+ *		See H5Dwrite_multi() for complete details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__write_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[],
+    const H5S_t *mem_spaces[], const H5S_t *file_spaces[], hid_t dxpl_id,
+    const void *bufs[])
+{
+    H5D_multi_io_t multi;               /* Accesses gathered from all the datasets */
+    H5F_t *file;                        /* File whose accesses are gathered */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(count > 0);
+    HDassert(dsets && mem_type_ids && mem_spaces && file_spaces && bufs);
+
+    HDmemset(&multi, 0, sizeof(multi));
+    file = dsets[0]->oloc.file;
+
+    /* Set up and queue the write of each dataset */
+    for(u = 0; u < count; u++)
+        if(H5D__write(dsets[u], mem_type_ids[u], mem_spaces[u], file_spaces[u], dxpl_id, bufs[u],
+                H5F_SAME_SHARED(dsets[u]->oloc.file, file) ? &multi : NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+    /* Issue the gathered writes */
+    if(H5D__contig_vector_flush(file, dxpl_id, &multi.vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+#ifdef H5_HAVE_PARALLEL
+    if(H5D__mpio_multi_io(dsets[0], dxpl_id, H5D_IO_OP_WRITE, &multi) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+#endif /* H5_HAVE_PARALLEL */
+
+done:
+    /* Release the gathered accesses, after a failure */
+    H5MM_xfree(multi.vec.addrs);
+    H5MM_xfree(multi.vec.sizes);
+    H5MM_xfree(multi.vec.rbufs);
+    H5MM_xfree(multi.vec.wbufs);
+#ifdef H5_HAVE_PARALLEL
+    if(H5D__mpio_multi_reset(&multi) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release collective accesses")
+#endif /* H5_HAVE_PARALLEL */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_multi() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__ioinfo_init
@@ -1142,6 +1617,12 @@ H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset, hid_t dxpl_id,
             io_info->io_ops.single_write = H5D__mpio_select_write;
         } /* end if */
         else {
+            /* Writes to filtered chunks can't fall back to independent I/O */
+            if(io_info->op_type == H5D_IO_OP_WRITE &&
+                    dset->shared->layout.type == H5D_CHUNKED &&
+                    dset->shared->dcpl_cache.pline.nused > 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot write to chunked storage with filters in parallel without collective I/O")
+
             /* If we won't be doing collective I/O, but the user asked for
              * collective I/O, change the request to use independent I/O, but
              * mark it so that we remember to revert the change.
@@ -96,8 +96,24 @@ H5D__layout_set_io_ops(const H5D_t *dataset)
             dataset->shared->layout.ops = H5D_LOPS_CHUNK;
 
             /* Set the chunk operations */
-            /* (Only "B-tree" indexing type currently supported) */
-            dataset->shared->layout.storage.u.chunk.ops = H5D_COPS_BTREE;
+            switch(dataset->shared->layout.storage.u.chunk.idx_type) {
+                case H5D_CHUNK_IDX_BTREE:
+                    dataset->shared->layout.storage.u.chunk.ops = H5D_COPS_BTREE;
+                    break;
+
+                case H5D_CHUNK_IDX_FARRAY:
+                    dataset->shared->layout.storage.u.chunk.ops = H5D_COPS_FARRAY;
+                    break;
+
+                case H5D_CHUNK_IDX_EARRAY:
+                    dataset->shared->layout.storage.u.chunk.ops = H5D_COPS_EARRAY;
+                    break;
+
+                case H5D_CHUNK_IDX_NTYPES:
+                default:
+                    HDassert(0 && "Unknown chunk index method!");
+                    HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unknown chunk index method")
+            } /* end switch */
             break;
 
         case H5D_COMPACT:
@@ -164,15 +180,55 @@ H5D__layout_meta_size(const H5F_t *f, const H5O_layout_t *layout, hbool_t includ
             break;
 
         case H5D_CHUNKED:
-            /* Number of dimensions (1 byte) */
-            HDassert(layout->u.chunk.ndims > 0 && layout->u.chunk.ndims <= H5O_LAYOUT_NDIMS);
-            ret_value++;
+            if(layout->version < H5O_LAYOUT_VERSION_4) {
+                /* Number of dimensions (1 byte) */
+                HDassert(layout->u.chunk.ndims > 0 && layout->u.chunk.ndims <= H5O_LAYOUT_NDIMS);
+                ret_value++;
 
-            /* Dimension sizes */
-            ret_value += layout->u.chunk.ndims * 4;
+                /* Dimension sizes */
+                ret_value += layout->u.chunk.ndims * 4;
 
-            /* B-tree address */
-            ret_value += H5F_SIZEOF_ADDR(f);    /* Address of data */
+                /* B-tree address */
+                ret_value += H5F_SIZEOF_ADDR(f);    /* Address of data */
+            } /* end if */
+            else {
+                /* Chunked layout feature flags */
+                ret_value++;
+
+                /* Number of dimensions (1 byte) */
+                HDassert(layout->u.chunk.ndims > 0 && layout->u.chunk.ndims <= H5O_LAYOUT_NDIMS);
+                ret_value++;
+
+                /* Encoded # of bytes for each chunk dimension */
+                HDassert(layout->u.chunk.enc_bytes_per_dim > 0 && layout->u.chunk.enc_bytes_per_dim <= 8);
+                ret_value++;
+
+                /* Dimension sizes */
+                ret_value += layout->u.chunk.ndims * layout->u.chunk.enc_bytes_per_dim;
+
+                /* Type of chunk index */
+                ret_value++;
+
+                switch(layout->storage.u.chunk.idx_type) {
+                    case H5D_CHUNK_IDX_FARRAY:
+                        /* Fixed array creation parameters */
+                        ret_value += H5D_FARRAY_CREATE_PARAM_SIZE;
+                        break;
+
+                    case H5D_CHUNK_IDX_EARRAY:
+                        /* Extensible array creation parameters */
+                        ret_value += H5D_EARRAY_CREATE_PARAM_SIZE;
+                        break;
+
+                    case H5D_CHUNK_IDX_BTREE:
+                    case H5D_CHUNK_IDX_NTYPES:
+                    default:
+                        HGOTO_ERROR(H5E_OHDR, H5E_CANTENCODE, 0, "Invalid chunk index type")
+                } /* end switch */
+
+                /* Chunk index address */
+                ret_value += H5F_SIZEOF_ADDR(f);
+            } /* end else */
             break;
 
         case H5D_VIRTUAL:
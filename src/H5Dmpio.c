@@ -44,6 +44,7 @@
 #include "H5Pprivate.h"       /* Property lists    */
 #include "H5Sprivate.h"       /* Dataspaces        */
 #include "H5VMprivate.h"       /* Vector            */
+#include "H5Zprivate.h"       /* Data filters      */
 
 #ifdef H5_HAVE_PARALLEL
 
@@ -86,6 +87,10 @@
 #define H5D_CHUNK_SELECT_IRREG        2
 #define H5D_CHUNK_SELECT_NONE         0
 
+/* Tag for the messages that carry one process's changes to a filtered chunk
+ * to the process that owns the chunk */
+#define H5D_FILTERED_CHUNK_MOD_TAG    0x5d0f
+
 
 /******************/
 /* Local Typedefs */
@@ -96,6 +101,41 @@ typedef struct H5D_chunk_addr_info_t {
   H5D_chunk_info_t chunk_info;
 } H5D_chunk_addr_info_t;
 
+/* A chunk selected by one process during collective I/O on a filtered
+ * dataset.  The processes exchange lists of these to decide which of them
+ * owns each chunk. */
+typedef struct H5D_filtered_chunk_sel_t {
+    hsize_t index;              /* "Index" of chunk in dataset */
+    hsize_t npoints;            /* Number of elements selected in chunk */
+    int rank;                   /* Process that selected the elements */
+} H5D_filtered_chunk_sel_t;
+
+/* A filtered chunk read by this process, or owned by it during a write */
+typedef struct H5D_filtered_chunk_t {
+    H5D_chunk_info_t *chunk_info;       /* This process's selection in the chunk */
+    const H5D_filtered_chunk_sel_t *sel; /* All processes' selections in the chunk (writes only) */
+    size_t nsel;                        /* Number of selections in 'sel' */
+    H5F_block_t chunk_block;            /* Offset/length of chunk in file */
+    unsigned filter_mask;               /* Excluded filters */
+    size_t nbytes;                      /* Size of chunk data in buffer */
+    size_t buf_size;                    /* Size of buffer allocated */
+    void *buf;                          /* Chunk data */
+} H5D_filtered_chunk_t;
+
+/* A contiguous dataset's part of a multi-dataset collective read or write */
+typedef struct H5D_mpio_multi_ent_t {
+    haddr_t addr;               /* Address of dataset */
+    hsize_t size;               /* Size of dataset's storage */
+    size_t idx;                 /* Position of dataset in the operation */
+    const void *buf;            /* Application buffer */
+    MPI_Datatype ftype;         /* MPI type of the selection in the file */
+    int fcount;                 /* # of 'ftype's */
+    hbool_t ft_is_derived;      /* Whether 'ftype' was derived */
+    MPI_Datatype mtype;         /* MPI type of the selection in memory */
+    int mcount;                 /* # of 'mtype's */
+    hbool_t mt_is_derived;      /* Whether 'mtype' was derived */
+} H5D_mpio_multi_ent_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -108,14 +148,38 @@ static herr_t H5D__multi_chunk_collective_io(H5D_io_info_t *io_info,
 static herr_t H5D__link_chunk_collective_io(H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, H5D_chunk_map_t *fm, int sum_chunk,
     H5P_genplist_t *dx_plist);
+static herr_t H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, H5D_chunk_map_t *fm,
+    H5P_genplist_t *dx_plist);
+static herr_t H5D__filtered_collective_read(H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, H5D_chunk_map_t *fm);
+static herr_t H5D__filtered_collective_write(H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, H5D_chunk_map_t *fm);
+static herr_t H5D__mpio_allgather_bytes(MPI_Comm comm, int mpi_size,
+    const void *local, size_t nlocal, size_t rec_size, void **all,
+    size_t *nall, int counts[], int displs[]);
+static herr_t H5D__filtered_collective_chunk_io(H5D_io_info_t *io_info,
+    H5D_io_op_type_t op_type, size_t nchunks, H5D_filtered_chunk_t *chunks[]);
+static herr_t H5D__filtered_chunk_fill(const H5D_io_info_t *io_info,
+    void *buf, size_t buf_size);
+static herr_t H5D__filtered_chunk_copy(const H5D_io_info_t *io_info,
+    size_t elmt_size, size_t nelmts, const void *src_buf, const H5S_t *src_space,
+    void *dst_buf, const H5S_t *dst_space, void *tmp_buf);
 static herr_t H5D__inter_collective_io(H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, const H5S_t *file_space,
     const H5S_t *mem_space);
+static herr_t H5D__mpio_multi_add(const H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, const H5S_t *file_space,
+    const H5S_t *mem_space);
+static int H5D__mpio_cmp_multi_ent(const void *ent1, const void *ent2);
 static herr_t H5D__final_collective_io(H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, hsize_t nelmts, MPI_Datatype *mpi_file_type,
     MPI_Datatype *mpi_buf_type);
 static herr_t H5D__sort_chunk(H5D_io_info_t *io_info, const H5D_chunk_map_t *fm,
     H5D_chunk_addr_info_t chunk_addr_info_array[], int many_chunk_opt);
+static int H5D__cmp_filtered_chunk_sel(const void *sel1, const void *sel2);
+static int H5D__cmp_filtered_chunk_addr(const void *chunk1, const void *chunk2);
+static int H5D__cmp_chunk_realloc(const void *chunk1, const void *chunk2);
 static herr_t H5D__obtain_mpio_mode(H5D_io_info_t *io_info, H5D_chunk_map_t *fm,
     H5P_genplist_t *dx_plist, uint8_t assign_io_mode[], haddr_t chunk_addr[]);
 static herr_t H5D__ioinfo_xfer_mode(H5D_io_info_t *io_info, H5P_genplist_t *dx_plist,
@@ -208,11 +272,6 @@ H5D__mpio_opt_possible(const H5D_io_info_t *io_info, const H5S_t *file_space,
      *  use collective IO will defer until each chunk IO is reached.
      */
 
-    /* Don't allow collective operations if filters need to be applied */
-    if(io_info->dset->shared->layout.type == H5D_CHUNKED &&
-            io_info->dset->shared->dcpl_cache.pline.nused > 0)
-        local_cause |= H5D_MPIO_FILTERS;
-
     /* Check for independent I/O */
     if(local_cause & H5D_MPIO_SET_INDEPENDENT)
         global_cause = local_cause;
@@ -477,8 +536,13 @@ H5D__contig_collective_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_
     HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
     HDassert(TRUE == H5P_isa_class(io_info->raw_dxpl_id, H5P_DATASET_XFER));
 
+    /* In a multi-dataset operation, leave the I/O to H5D__mpio_multi_io() */
+    if(io_info->multi) {
+        if(H5D__mpio_multi_add(io_info, type_info, file_space, mem_space) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "couldn't queue collective MPI-IO")
+    } /* end if */
     /* Call generic internal collective I/O routine */
-    if(H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
+    else if(H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
         HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "couldn't finish shared collective MPI-IO")
 
     /* Obtain the data transfer properties */
@@ -524,8 +588,13 @@ H5D__contig_collective_write(H5D_io_info_t *io_info, const H5D_type_info_t *type
     HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
     HDassert(TRUE == H5P_isa_class(io_info->raw_dxpl_id, H5P_DATASET_XFER));
 
+    /* In a multi-dataset operation, leave the I/O to H5D__mpio_multi_io() */
+    if(io_info->multi) {
+        if(H5D__mpio_multi_add(io_info, type_info, file_space, mem_space) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "couldn't queue collective MPI-IO")
+    } /* end if */
     /* Call generic internal collective I/O routine */
-    if(H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
+    else if(H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
         HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "couldn't finish shared collective MPI-IO")
 
     /* Obtain the data transfer properties */
@@ -604,6 +673,14 @@ H5D__chunk_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     if(NULL == (dx_plist = H5I_object(io_info->raw_dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+    /* Filtered chunks must be read & written whole and run through the I/O
+     * pipeline, so they always take their own path */
+    if(io_info->dset->shared->dcpl_cache.pline.nused > 0) {
+        if(H5D__link_chunk_filtered_collective_io(io_info, type_info, fm, dx_plist) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish filtered linked chunk MPI-IO")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Check the optional property list on what to do with collective chunk IO. */
     if(H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME, &chunk_opt_mode) < 0)
         HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't get chunk optimization option")
@@ -1093,6 +1170,768 @@ if(H5DEBUG(D))
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__link_chunk_collective_io */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__link_chunk_filtered_collective_io
+ *
+ * Purpose:     Routine for one collective I/O operation on all the selected
+ *              chunks of a dataset with filters.
+ *
+ *              Filtered chunks must be transferred whole and run through
+ *              the I/O pipeline, so the chunks' data can't be described
+ *              with MPI datatypes over the file directly.  Instead, each
+ *              process transfers the (filtered) chunks it needs with one
+ *              collective read or write, and does the filtering itself.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, H5D_chunk_map_t *fm,
+    H5P_genplist_t *dx_plist)
+{
+    H5D_mpio_actual_chunk_opt_mode_t actual_chunk_opt_mode = H5D_MPIO_LINK_CHUNK;
+    H5D_mpio_actual_io_mode_t actual_io_mode = H5D_MPIO_CHUNK_COLLECTIVE;
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(io_info);
+    HDassert(io_info->dset->shared->dcpl_cache.pline.nused > 0);
+    HDassert(type_info);
+    HDassert(fm);
+
+    /* Set the actual-chunk-opt-mode property. */
+    if(H5P_set(dx_plist, H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_NAME, &actual_chunk_opt_mode) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "couldn't set actual chunk opt mode property")
+
+    /* Set the actual-io-mode property.
+     * Filtered chunk I/O does not break to independent, so can set right away */
+    if(H5P_set(dx_plist, H5D_MPIO_ACTUAL_IO_MODE_NAME, &actual_io_mode) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "couldn't set actual io mode property")
+
+    if(io_info->op_type == H5D_IO_OP_WRITE) {
+        if(H5D__filtered_collective_write(io_info, type_info, fm) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't write filtered chunks")
+    } /* end if */
+    else {
+        if(H5D__filtered_collective_read(io_info, type_info, fm) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "couldn't read filtered chunks")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__link_chunk_filtered_collective_io */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_read
+ *
+ * Purpose:     Reads the selection from a dataset with filters:
+ *
+ *                      1. Look up each chunk this process selected
+ *                      2. Read all of them with one collective read
+ *                      3. Unfilter each chunk and copy the selected
+ *                         elements to the application's buffer
+ *
+ *              Chunks selected by several processes are read by each of
+ *              them.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_read(H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, H5D_chunk_map_t *fm)
+{
+    const H5D_t *dset = io_info->dset;  /* Dataset being read */
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline);    /* I/O pipeline info */
+    H5D_filtered_chunk_t *chunks = NULL;        /* Chunks selected by this process */
+    H5D_filtered_chunk_t **read_chunks = NULL;  /* Chunks to read from the file */
+    size_t      chunk_size;             /* Size of an unfiltered chunk */
+    size_t      elmt_size = type_info->src_type_size;   /* Size of each element */
+    size_t      max_points = 0;         /* Largest selection in a chunk */
+    size_t      num_chunk;              /* Number of chunks selected by this process */
+    size_t      num_read = 0;           /* Number of chunks to read from the file */
+    void        *tmp_buf = NULL;        /* Buffer for gathering selected elements */
+    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+
+    /* Look up all the chunks this process selected */
+    if((num_chunk = H5SL_count(fm->sel_chunks)) > 0) {
+        if(NULL == (chunks = (H5D_filtered_chunk_t *)H5MM_calloc(num_chunk * sizeof(H5D_filtered_chunk_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate filtered chunk array")
+        if(NULL == (read_chunks = (H5D_filtered_chunk_t **)H5MM_malloc(num_chunk * sizeof(H5D_filtered_chunk_t *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate filtered chunk array")
+
+        for(u = 0, chunk_node = H5SL_first(fm->sel_chunks); chunk_node; u++, chunk_node = H5SL_next(chunk_node)) {
+            H5D_chunk_ud_t udata;           /* User data for querying chunk info */
+
+            chunks[u].chunk_info = (H5D_chunk_info_t *)H5SL_item(chunk_node);
+            max_points = MAX(max_points, chunks[u].chunk_info->chunk_points);
+
+            if(H5D__chunk_lookup(dset, io_info->md_dxpl_id, chunks[u].chunk_info->scaled, &udata) < 0)
+                HGOTO_ERROR(H5E_STORAGE, H5E_CANTGET, FAIL, "couldn't get chunk address")
+            chunks[u].chunk_block = udata.chunk_block;
+            chunks[u].filter_mask = udata.filter_mask;
+
+            /* Set up buffer for chunks that exist in the file */
+            if(H5F_addr_defined(udata.chunk_block.offset)) {
+                H5_CHECKED_ASSIGN(chunks[u].nbytes, size_t, udata.chunk_block.length, hsize_t);
+                chunks[u].buf_size = chunks[u].nbytes;
+                if(NULL == (chunks[u].buf = H5MM_malloc(chunks[u].buf_size)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+                read_chunks[num_read++] = &chunks[u];
+            } /* end if */
+        } /* end for */
+    } /* end if */
+
+    /* Read the chunks (all processes must participate) */
+    if(H5D__filtered_collective_chunk_io(io_info, H5D_IO_OP_READ, num_read, read_chunks) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "couldn't read filtered chunks")
+
+    if(num_chunk > 0)
+        if(NULL == (tmp_buf = H5MM_malloc(max_points * elmt_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for selection buffer")
+
+    /* Unfilter the chunks & copy out the selected elements */
+    for(u = 0; u < num_chunk; u++) {
+        H5D_chunk_info_t *chunk_info = chunks[u].chunk_info;
+
+        if(chunks[u].buf) {
+            if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &(chunks[u].filter_mask), io_info->dxpl_cache->err_detect,
+                    io_info->dxpl_cache->filter_cb, &(chunks[u].nbytes), &(chunks[u].buf_size), &(chunks[u].buf)) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+        } /* end if */
+        else {
+            /* The chunk doesn't exist in the file, use fill values */
+            chunks[u].buf_size = chunk_size;
+            if(NULL == (chunks[u].buf = H5MM_malloc(chunks[u].buf_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+            if(H5D__filtered_chunk_fill(io_info, chunks[u].buf, chunk_size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't fill chunk")
+        } /* end else */
+
+        if(H5D__filtered_chunk_copy(io_info, elmt_size, (size_t)chunk_info->chunk_points, chunks[u].buf, chunk_info->fspace,
+                io_info->u.rbuf, chunk_info->mspace, tmp_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "couldn't copy chunk data to memory")
+    } /* end for */
+
+done:
+    if(chunks) {
+        for(u = 0; u < num_chunk; u++)
+            H5MM_xfree(chunks[u].buf);
+        H5MM_xfree(chunks);
+    } /* end if */
+    H5MM_xfree(read_chunks);
+    H5MM_xfree(tmp_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_read */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_write
+ *
+ * Purpose:     Writes the selection to a dataset with filters:
+ *
+ *                      1. Exchange the lists of chunks each process
+ *                         selected and choose an owner for each chunk:
+ *                         the process with the most elements selected in
+ *                         it (the lowest rank wins ties)
+ *                      2. Send the selections & data for chunks owned by
+ *                         other processes to their owners
+ *                      3. Read the owned chunks that are only partially
+ *                         overwritten with one collective read, then
+ *                         unfilter them, apply this and the other
+ *                         processes' changes and filter them again
+ *                      4. Exchange the new chunk sizes so every process
+ *                         makes the same file space allocations and
+ *                         chunk index updates
+ *                      5. Write the owned chunks with one collective write
+ *
+ *              Each chunk is thus filtered by exactly one process and the
+ *              work is spread over all of them.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_write(H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, H5D_chunk_map_t *fm)
+{
+    const H5D_t *dset = io_info->dset;  /* Dataset being written */
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline);    /* I/O pipeline info */
+    H5D_filtered_chunk_sel_t *local_sel = NULL;  /* Chunks selected by this process */
+    H5D_filtered_chunk_sel_t *all_sel = NULL;    /* Chunks selected by all processes */
+    H5D_filtered_chunk_t *chunks = NULL;        /* Chunks owned by this process */
+    H5D_filtered_chunk_t **io_chunks = NULL;    /* Chunks to read or write */
+    H5D_chunk_realloc_t *local_realloc = NULL;  /* New sizes of chunks owned by this process */
+    H5D_chunk_realloc_t *all_realloc = NULL;    /* New sizes of chunks owned by all processes */
+    MPI_Request *send_reqs = NULL;      /* Requests for messages sent to chunk owners */
+    unsigned char **send_bufs = NULL;   /* Buffers for messages sent to chunk owners */
+    unsigned char *recv_buf = NULL;     /* Buffer for message received from another process */
+    size_t      recv_buf_size = 0;      /* Size of receive buffer */
+    int         *counts = NULL;         /* Bytes contributed by each process */
+    int         *displs = NULL;         /* Displacements of each process's contribution */
+    int         mpi_rank, mpi_size;     /* This process's rank & number of processes */
+    int         mpi_code;               /* MPI return code */
+    size_t      chunk_size;             /* Size of an unfiltered chunk */
+    size_t      chunk_nelmts;           /* Number of elements in a chunk */
+    size_t      elmt_size = type_info->src_type_size;   /* Size of each element */
+    size_t      max_points = 0;         /* Largest selection in an owned chunk */
+    size_t      num_local;              /* Number of chunks selected by this process */
+    size_t      num_all;                /* Number of chunk selections by all processes */
+    size_t      num_owned = 0;          /* Number of chunks owned by this process */
+    size_t      num_read = 0;           /* Number of owned chunks to read from the file */
+    size_t      num_realloc;            /* Number of chunks rewritten by all processes */
+    int         num_send = 0;           /* Number of messages sent to chunk owners */
+    void        *tmp_buf = NULL;        /* Buffer for gathering selected elements */
+    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    size_t      u, v;                   /* Local index variables */
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+    chunk_nelmts = chunk_size / elmt_size;
+
+    if((mpi_rank = H5F_mpi_get_rank(dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
+    if((mpi_size = H5F_mpi_get_size(dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
+
+    if(NULL == (counts = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive counts buffer")
+    if(NULL == (displs = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive displacements buffer")
+
+    /* Describe the chunks this process selected */
+    if((num_local = H5SL_count(fm->sel_chunks)) > 0) {
+        if(NULL == (local_sel = (H5D_filtered_chunk_sel_t *)H5MM_calloc(num_local * sizeof(H5D_filtered_chunk_sel_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk selection buffer")
+        if(NULL == (send_reqs = (MPI_Request *)H5MM_malloc(num_local * sizeof(MPI_Request))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate send request buffer")
+        if(NULL == (send_bufs = (unsigned char **)H5MM_calloc(num_local * sizeof(unsigned char *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate send buffer array")
+
+        for(u = 0, chunk_node = H5SL_first(fm->sel_chunks); chunk_node; u++, chunk_node = H5SL_next(chunk_node)) {
+            H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)H5SL_item(chunk_node);
+
+            local_sel[u].index = chunk_info->index;
+            local_sel[u].npoints = chunk_info->chunk_points;
+            local_sel[u].rank = mpi_rank;
+        } /* end for */
+    } /* end if */
+
+    /* Gather all the processes' selections, everywhere */
+    if(H5D__mpio_allgather_bytes(io_info->comm, mpi_size, local_sel, num_local, sizeof(H5D_filtered_chunk_sel_t), (void **)&all_sel, &num_all, counts, displs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTRECV, FAIL, "couldn't gather chunk selections")
+    if(num_all > 1)
+        HDqsort(all_sel, num_all, sizeof(H5D_filtered_chunk_sel_t), H5D__cmp_filtered_chunk_sel);
+
+    if(num_local > 0) {
+        if(NULL == (chunks = (H5D_filtered_chunk_t *)H5MM_calloc(num_local * sizeof(H5D_filtered_chunk_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate filtered chunk array")
+        if(NULL == (io_chunks = (H5D_filtered_chunk_t **)H5MM_malloc(num_local * sizeof(H5D_filtered_chunk_t *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate filtered chunk array")
+    } /* end if */
+
+    /* Choose an owner for each chunk this process selected.  Send the changes
+     * for chunks owned by other processes and set up the ones owned here.
+     * (Both lists are sorted by chunk index.)
+     */
+    for(u = 0, v = 0, chunk_node = H5SL_first(fm->sel_chunks); chunk_node; chunk_node = H5SL_next(chunk_node)) {
+        H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)H5SL_item(chunk_node);
+        size_t first, owner;            /* First & owning selection of chunk */
+        hsize_t total_points = 0;       /* Number of elements selected by all processes */
+
+        /* Find the selections in the chunk */
+        while(all_sel[v].index < chunk_info->index)
+            v++;
+        HDassert(all_sel[v].index == chunk_info->index);
+        for(first = owner = v; v < num_all && all_sel[v].index == chunk_info->index; v++) {
+            if(all_sel[v].npoints > all_sel[owner].npoints)
+                owner = v;
+            total_points += all_sel[v].npoints;
+        } /* end for */
+
+        if(all_sel[owner].rank == mpi_rank) {
+            H5D_filtered_chunk_t *chunk = &chunks[num_owned++];
+            H5D_chunk_ud_t udata;           /* User data for querying chunk info */
+
+            chunk->chunk_info = chunk_info;
+            chunk->sel = &all_sel[first];
+            chunk->nsel = v - first;
+            max_points = MAX(max_points, chunk_info->chunk_points);
+
+            if(H5D__chunk_lookup(dset, io_info->md_dxpl_id, chunk_info->scaled, &udata) < 0)
+                HGOTO_ERROR(H5E_STORAGE, H5E_CANTGET, FAIL, "couldn't get chunk address")
+            chunk->chunk_block = udata.chunk_block;
+            chunk->filter_mask = udata.filter_mask;
+
+            /* Only read chunks that exist and won't be overwritten entirely */
+            if(H5F_addr_defined(udata.chunk_block.offset) && total_points < (hsize_t)chunk_nelmts) {
+                H5_CHECKED_ASSIGN(chunk->nbytes, size_t, udata.chunk_block.length, hsize_t);
+                chunk->buf_size = chunk->nbytes;
+                if(NULL == (chunk->buf = H5MM_malloc(chunk->buf_size)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+                io_chunks[num_read++] = chunk;
+            } /* end if */
+        } /* end if */
+        else {
+            unsigned char *p;               /* Pointer into message */
+            size_t enc_size = 0;            /* Size of encoded selection */
+            size_t msg_size;                /* Size of message */
+            int msg_count;                  /* Size of message, for MPI */
+
+            /* Message is the encoded selection in the chunk, followed by the
+             * selected elements */
+            p = NULL;
+            if(H5S_encode(chunk_info->fspace, &p, &enc_size) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTENCODE, FAIL, "can't get encoded selection size")
+            msg_size = enc_size + (size_t)chunk_info->chunk_points * elmt_size;
+            H5_CHECKED_ASSIGN(msg_count, int, msg_size, size_t);
+            if(NULL == (send_bufs[num_send] = (unsigned char *)H5MM_malloc(msg_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk message")
+            p = send_bufs[num_send];
+            if(H5S_encode(chunk_info->fspace, &p, &enc_size) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTENCODE, FAIL, "can't encode selection")
+            if(H5D__filtered_chunk_copy(io_info, elmt_size, (size_t)chunk_info->chunk_points, io_info->u.wbuf, chunk_info->mspace,
+                    send_bufs[num_send] + enc_size, NULL, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "couldn't gather chunk data")
+
+            if(MPI_SUCCESS != (mpi_code = MPI_Isend(send_bufs[num_send], msg_count, MPI_BYTE, all_sel[owner].rank, H5D_FILTERED_CHUNK_MOD_TAG, io_info->comm, &send_reqs[num_send])))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Isend failed", mpi_code)
+            num_send++;
+        } /* end else */
+    } /* end for */
+
+    /* Read the owned chunks (all processes must participate) */
+    if(H5D__filtered_collective_chunk_io(io_info, H5D_IO_OP_READ, num_read, io_chunks) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "couldn't read filtered chunks")
+
+    if(num_owned > 0)
+        if(NULL == (tmp_buf = H5MM_malloc(max_points * elmt_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for selection buffer")
+
+    /* Update the owned chunks */
+    for(u = 0; u < num_owned; u++) {
+        H5D_filtered_chunk_t *chunk = &chunks[u];
+
+        /* Get the chunk's current data */
+        if(chunk->buf) {
+            if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &(chunk->filter_mask), io_info->dxpl_cache->err_detect,
+                    io_info->dxpl_cache->filter_cb, &(chunk->nbytes), &(chunk->buf_size), &(chunk->buf)) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+        } /* end if */
+        else {
+            chunk->buf_size = chunk_size;
+            if(NULL == (chunk->buf = H5MM_malloc(chunk->buf_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+            if(H5D__filtered_chunk_fill(io_info, chunk->buf, chunk_size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't fill chunk")
+        } /* end else */
+
+        /* Apply this process's changes */
+        if(H5D__filtered_chunk_copy(io_info, elmt_size, (size_t)chunk->chunk_info->chunk_points, io_info->u.wbuf, chunk->chunk_info->mspace,
+                chunk->buf, chunk->chunk_info->fspace, tmp_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "couldn't copy memory data to chunk")
+
+        /* Apply the other processes' changes (messages from each process
+         * arrive in the order they were sent, which is chunk index order) */
+        for(v = 0; v < chunk->nsel; v++)
+            if(chunk->sel[v].rank != mpi_rank) {
+                MPI_Status status;              /* Status of probe */
+                const unsigned char *p;         /* Pointer into message */
+                H5S_t *space;                   /* Other process's selection in chunk */
+                int msg_count;                  /* Size of message */
+                herr_t status_copy;             /* Status of copying the changes */
+
+                if(MPI_SUCCESS != (mpi_code = MPI_Probe(chunk->sel[v].rank, H5D_FILTERED_CHUNK_MOD_TAG, io_info->comm, &status)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Probe failed", mpi_code)
+                if(MPI_SUCCESS != (mpi_code = MPI_Get_count(&status, MPI_BYTE, &msg_count)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
+                if((size_t)msg_count > recv_buf_size) {
+                    H5MM_xfree(recv_buf);
+                    recv_buf_size = (size_t)msg_count;
+                    if(NULL == (recv_buf = (unsigned char *)H5MM_malloc(recv_buf_size)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk message")
+                } /* end if */
+                if(MPI_SUCCESS != (mpi_code = MPI_Recv(recv_buf, msg_count, MPI_BYTE, chunk->sel[v].rank, H5D_FILTERED_CHUNK_MOD_TAG, io_info->comm, MPI_STATUS_IGNORE)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Recv failed", mpi_code)
+
+                p = recv_buf;
+                if(NULL == (space = H5S_decode(&p)))
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDECODE, FAIL, "can't decode selection")
+                HDassert((size_t)(p - recv_buf) + (size_t)chunk->sel[v].npoints * elmt_size == (size_t)msg_count);
+                status_copy = H5D__filtered_chunk_copy(io_info, elmt_size, (size_t)chunk->sel[v].npoints, p, NULL, chunk->buf, space, NULL);
+                if(H5S_close(space) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release selection")
+                if(status_copy < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "couldn't copy received data to chunk")
+            } /* end if */
+
+        /* Filter the chunk again */
+        chunk->nbytes = chunk_size;
+        chunk->filter_mask = 0;
+        if(H5Z_pipeline(pline, 0, &(chunk->filter_mask), io_info->dxpl_cache->err_detect,
+                io_info->dxpl_cache->filter_cb, &(chunk->nbytes), &(chunk->buf_size), &(chunk->buf)) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
+#if H5_SIZEOF_SIZE_T > 4
+        /* Check for the chunk expanding too much to encode in a 32-bit value */
+        if(chunk->nbytes > ((size_t)0xffffffff))
+            HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
+#endif /* H5_SIZEOF_SIZE_T > 4 */
+    } /* end for */
+
+    /* Make sure the messages this process sent were delivered */
+    if(num_send > 0) {
+        if(MPI_SUCCESS != (mpi_code = MPI_Waitall(num_send, send_reqs, MPI_STATUSES_IGNORE)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+        for(u = 0; u < (size_t)num_send; u++)
+            send_bufs[u] = (unsigned char *)H5MM_xfree(send_bufs[u]);
+        num_send = 0;
+    } /* end if */
+
+    /* Tell every process the new sizes of the chunks owned here */
+    if(num_owned > 0) {
+        if(NULL == (local_realloc = (H5D_chunk_realloc_t *)H5MM_calloc(num_owned * sizeof(H5D_chunk_realloc_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk size buffer")
+        for(u = 0; u < num_owned; u++) {
+            local_realloc[u].index = chunks[u].chunk_info->index;
+            local_realloc[u].chunk_block.offset = HADDR_UNDEF;
+            local_realloc[u].chunk_block.length = (hsize_t)chunks[u].nbytes;
+            local_realloc[u].filter_mask = chunks[u].filter_mask;
+        } /* end for */
+    } /* end if */
+    if(H5D__mpio_allgather_bytes(io_info->comm, mpi_size, local_realloc, num_owned, sizeof(H5D_chunk_realloc_t), (void **)&all_realloc, &num_realloc, counts, displs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTRECV, FAIL, "couldn't gather chunk sizes")
+    if(num_realloc > 1)
+        HDqsort(all_realloc, num_realloc, sizeof(H5D_chunk_realloc_t), H5D__cmp_chunk_realloc);
+
+    /* Allocate file space for the chunks & update the chunk index, in the
+     * same order on all processes */
+    if(H5D__chunk_collective_realloc(io_info, num_realloc, all_realloc) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate filtered chunks")
+
+    /* Pick up the new locations of the chunks owned here */
+    for(u = 0, v = 0; u < num_owned; u++) {
+        while(all_realloc[v].index < chunks[u].chunk_info->index)
+            v++;
+        HDassert(all_realloc[v].index == chunks[u].chunk_info->index);
+        chunks[u].chunk_block = all_realloc[v].chunk_block;
+        io_chunks[u] = &chunks[u];
+    } /* end for */
+
+    /* Write the owned chunks (all processes must participate) */
+    if(H5D__filtered_collective_chunk_io(io_info, H5D_IO_OP_WRITE, num_owned, io_chunks) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "couldn't write filtered chunks")
+
+done:
+    /* Don't release the buffers of messages still being sent */
+    if(num_send > 0)
+        if(MPI_SUCCESS != (mpi_code = MPI_Waitall(num_send, send_reqs, MPI_STATUSES_IGNORE)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+    if(send_bufs) {
+        for(u = 0; u < num_local; u++)
+            H5MM_xfree(send_bufs[u]);
+        H5MM_xfree(send_bufs);
+    } /* end if */
+    if(chunks) {
+        for(u = 0; u < num_owned; u++)
+            H5MM_xfree(chunks[u].buf);
+        H5MM_xfree(chunks);
+    } /* end if */
+    H5MM_xfree(send_reqs);
+    H5MM_xfree(recv_buf);
+    H5MM_xfree(io_chunks);
+    H5MM_xfree(local_sel);
+    H5MM_xfree(all_sel);
+    H5MM_xfree(local_realloc);
+    H5MM_xfree(all_realloc);
+    H5MM_xfree(counts);
+    H5MM_xfree(displs);
+    H5MM_xfree(tmp_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_write */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_allgather_bytes
+ *
+ * Purpose:     Gathers arrays of fixed-size records from all processes and
+ *              concatenates them, in rank order, on every process.
+ *
+ *              COUNTS and DISPLS must hold one int per process.  The
+ *              gathered array is allocated by this routine and must be
+ *              released with H5MM_xfree.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_allgather_bytes(MPI_Comm comm, int mpi_size, const void *local,
+    size_t nlocal, size_t rec_size, void **all, size_t *nall, int counts[],
+    int displs[])
+{
+    int         local_bytes;            /* Bytes contributed by this process */
+    size_t      total_bytes = 0;        /* Bytes contributed by all processes */
+    int         mpi_code;               /* MPI return code */
+    int         i;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5_CHECKED_ASSIGN(local_bytes, int, nlocal * rec_size, size_t);
+    if(MPI_SUCCESS != (mpi_code = MPI_Allgather(&local_bytes, 1, MPI_INT, counts, 1, MPI_INT, comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+    for(i = 0; i < mpi_size; i++) {
+        H5_CHECKED_ASSIGN(displs[i], int, total_bytes, size_t);
+        total_bytes += (size_t)counts[i];
+    } /* end for */
+
+    /* (Allocate at least one byte, so every process has a valid buffer) */
+    if(NULL == (*all = H5MM_malloc(MAX(total_bytes, 1))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for gathered records")
+    if(MPI_SUCCESS != (mpi_code = MPI_Allgatherv((void *)local, local_bytes, MPI_BYTE, *all, counts, displs, MPI_BYTE, comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgatherv failed", mpi_code)
+    *nall = total_bytes / rec_size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_allgather_bytes */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_chunk_io
+ *
+ * Purpose:     Reads or writes (according to OP_TYPE) whole filtered
+ *              chunks with one collective operation, using MPI datatypes
+ *              to describe where the chunks are in the file and in memory.
+ *
+ *              All processes must call this routine, even if they have no
+ *              chunks to transfer.  The array of chunks is sorted by file
+ *              address.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_chunk_io(H5D_io_info_t *io_info,
+    H5D_io_op_type_t op_type, size_t nchunks, H5D_filtered_chunk_t *chunks[])
+{
+    MPI_Datatype file_type = MPI_BYTE;  /* Chunks' locations in the file */
+    MPI_Datatype mem_type = MPI_BYTE;   /* Chunks' locations in memory */
+    hbool_t     file_type_is_derived = FALSE;
+    hbool_t     mem_type_is_derived = FALSE;
+    MPI_Aint    *file_disps = NULL;     /* File displacements of chunks */
+    MPI_Aint    *mem_disps = NULL;      /* Memory displacements of chunks */
+    int         *block_lens = NULL;     /* Lengths of chunks */
+    int         num_blocks;             /* Number of chunks, for MPI */
+    haddr_t     base_addr = 0;          /* File address of first chunk */
+    void        *base_buf;              /* Buffer of first chunk */
+    char        fake_char;              /* Buffer for processes with no chunks */
+    size_t      mpi_buf_count = 0;      /* Number of memory datatypes to transfer */
+    int         mpi_code;               /* MPI return code */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    base_buf = &fake_char;
+    if(nchunks > 0) {
+        MPI_Aint base_mem_addr;         /* Memory address of first chunk */
+
+        /* The file view must be in increasing file address order */
+        if(nchunks > 1)
+            HDqsort(chunks, nchunks, sizeof(H5D_filtered_chunk_t *), H5D__cmp_filtered_chunk_addr);
+
+        H5_CHECKED_ASSIGN(num_blocks, int, nchunks, size_t);
+        if(NULL == (file_disps = (MPI_Aint *)H5MM_malloc(nchunks * sizeof(MPI_Aint))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk file displacement buffer")
+        if(NULL == (mem_disps = (MPI_Aint *)H5MM_malloc(nchunks * sizeof(MPI_Aint))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk memory displacement buffer")
+        if(NULL == (block_lens = (int *)H5MM_malloc(nchunks * sizeof(int))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk lengths buffer")
+
+        base_addr = chunks[0]->chunk_block.offset;
+        base_buf = chunks[0]->buf;
+        if(MPI_SUCCESS != (mpi_code = MPI_Get_address(base_buf, &base_mem_addr)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+        for(u = 0; u < nchunks; u++) {
+            MPI_Aint mem_addr;          /* Memory address of chunk */
+
+            HDassert(H5F_addr_defined(chunks[u]->chunk_block.offset));
+            HDassert(u == 0 || H5F_addr_gt(chunks[u]->chunk_block.offset, chunks[u - 1]->chunk_block.offset));
+            if(MPI_SUCCESS != (mpi_code = MPI_Get_address(chunks[u]->buf, &mem_addr)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+            file_disps[u] = (MPI_Aint)(chunks[u]->chunk_block.offset - base_addr);
+            mem_disps[u] = mem_addr - base_mem_addr;
+            H5_CHECKED_ASSIGN(block_lens[u], int, chunks[u]->nbytes, size_t);
+        } /* end for */
+
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed(num_blocks, block_lens, file_disps, MPI_BYTE, &file_type)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
+        file_type_is_derived = TRUE;
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&file_type)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed(num_blocks, block_lens, mem_disps, MPI_BYTE, &mem_type)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
+        mem_type_is_derived = TRUE;
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&mem_type)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+        mpi_buf_count = 1;
+    } /* end if */
+
+    /* Pass buf type, file type to the file driver.  */
+    if(H5FD_mpi_setup_collective(io_info->raw_dxpl_id, &mem_type, &file_type) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set MPI-I/O properties")
+
+    if(op_type == H5D_IO_OP_WRITE) {
+        if(H5F_block_write(io_info->dset->oloc.file, H5FD_MEM_DRAW, base_addr, mpi_buf_count, io_info->raw_dxpl_id, base_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't finish collective parallel write")
+    } /* end if */
+    else {
+        if(H5F_block_read(io_info->dset->oloc.file, H5FD_MEM_DRAW, base_addr, mpi_buf_count, io_info->raw_dxpl_id, base_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't finish collective parallel read")
+    } /* end else */
+
+done:
+    if(mem_type_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&mem_type)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    if(file_type_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&file_type)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    H5MM_xfree(file_disps);
+    H5MM_xfree(mem_disps);
+    H5MM_xfree(block_lens);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_chunk_io */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_chunk_fill
+ *
+ * Purpose:     Initializes the buffer for a chunk that doesn't exist in
+ *              the file with the dataset's fill value, or zeros if the
+ *              fill value isn't written.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_chunk_fill(const H5D_io_info_t *io_info, void *buf,
+    size_t buf_size)
+{
+    const H5D_t *dset = io_info->dset;  /* Dataset */
+    const H5O_fill_t *fill = &(dset->shared->dcpl_cache.fill); /* Fill value info */
+    H5D_fill_value_t fill_status;       /* Fill value status */
+    H5D_fill_buf_info_t fb_info;        /* Dataset's fill buffer info */
+    hbool_t     fb_info_init = FALSE;   /* Whether the fill value buffer has been initialized */
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5P_is_fill_value_defined(fill, &fill_status) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+
+    if(fill->fill_time == H5D_FILL_TIME_ALLOC ||
+            (fill->fill_time == H5D_FILL_TIME_IFSET &&
+             (fill_status == H5D_FILL_VALUE_USER_DEFINED ||
+              fill_status == H5D_FILL_VALUE_DEFAULT))) {
+        /* Replicate the fill value throughout the chunk */
+        if(H5D__fill_init(&fb_info, buf, NULL, NULL, NULL, NULL,
+                fill, dset->shared->type, dset->shared->type_id, (size_t)0,
+                buf_size, io_info->md_dxpl_id) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize fill buffer info")
+        fb_info_init = TRUE;
+    } /* end if */
+    else
+        HDmemset(buf, 0, buf_size);
+
+done:
+    if(fb_info_init && H5D__fill_term(&fb_info) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release fill buffer info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_chunk_fill */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_chunk_copy
+ *
+ * Purpose:     Copies NELMTS elements selected by SRC_SPACE in SRC_BUF to
+ *              the elements selected by DST_SPACE in DST_BUF, through
+ *              TMP_BUF.  A NULL dataspace means its buffer holds the
+ *              elements packed together, and then TMP_BUF isn't needed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_chunk_copy(const H5D_io_info_t *io_info, size_t elmt_size,
+    size_t nelmts, const void *src_buf, const H5S_t *src_space, void *dst_buf,
+    const H5S_t *dst_space, void *tmp_buf)
+{
+    H5S_sel_iter_t iter;                /* Selection iterator */
+    hbool_t     iter_init = FALSE;      /* Whether the iterator has been initialized */
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(src_space || dst_space);
+
+    /* Gather the elements together */
+    if(src_space) {
+        if(!dst_space)
+            tmp_buf = dst_buf;
+        HDassert(tmp_buf);
+
+        if(H5S_select_iter_init(&iter, src_space, elmt_size) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+        iter_init = TRUE;
+        if(nelmts != H5D__gather_mem(src_buf, src_space, &iter, nelmts, io_info->dxpl_cache, tmp_buf))
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "gather failed")
+        if(H5S_SELECT_ITER_RELEASE(&iter) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "Can't release selection iterator")
+        iter_init = FALSE;
+
+        src_buf = tmp_buf;
+    } /* end if */
+
+    /* Scatter them to their destination */
+    if(dst_space) {
+        if(H5S_select_iter_init(&iter, dst_space, elmt_size) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+        iter_init = TRUE;
+        if(H5D__scatter_mem(src_buf, dst_space, &iter, nelmts, io_info->dxpl_cache, dst_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "scatter failed")
+    } /* end if */
+
+done:
+    if(iter_init && H5S_SELECT_ITER_RELEASE(&iter) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "Can't release selection iterator")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_chunk_copy */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__multi_chunk_collective_io
@@ -1414,6 +2253,303 @@ if(H5DEBUG(D))
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__inter_collective_io() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_multi_add
+ *
+ * Purpose:     Builds the MPI types for a collective access to a
+ *              contiguous dataset and queues them in the I/O info's
+ *              multi-dataset operation, for H5D__mpio_multi_io().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_multi_add(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    const H5S_t *file_space, const H5S_t *mem_space)
+{
+    H5D_multi_io_t *multi = io_info->multi;     /* Multi-dataset operation */
+    H5D_mpio_multi_ent_t *ent = NULL;   /* New entry */
+    hsize_t *permute_map = NULL;        /* Map of out-of-order points in the file selection */
+    hbool_t is_permuted = FALSE;        /* Whether the file selection was permuted */
+    int mpi_code;                       /* MPI return code */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(multi);
+    HDassert(file_space);
+    HDassert(mem_space);
+
+    /* Make room for the new entry */
+    if(multi->ncoll == multi->max_ncoll) {
+        size_t new_max = MAX(2 * multi->max_ncoll, 8);
+        H5D_mpio_multi_ent_t *new_coll;
+
+        if(NULL == (new_coll = (H5D_mpio_multi_ent_t *)H5MM_realloc(multi->coll, new_max * sizeof(H5D_mpio_multi_ent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate collective access list")
+        multi->coll = new_coll;
+        multi->max_ncoll = new_max;
+    } /* end if */
+    ent = &multi->coll[multi->ncoll];
+    ent->addr = io_info->store->contig.dset_addr;
+    ent->size = io_info->store->contig.dset_size;
+    ent->idx = multi->ncoll;
+    ent->buf = (io_info->op_type == H5D_IO_OP_WRITE) ? io_info->u.wbuf : (const void *)io_info->u.rbuf;
+    ent->ft_is_derived = FALSE;
+    ent->mt_is_derived = FALSE;
+
+    /* Obtain disk and memory MPI derived datatype, as in
+     * H5D__inter_collective_io() */
+    if(H5S_mpio_space_type(file_space, type_info->src_type_size, &ent->ftype,
+            &ent->fcount, &ent->ft_is_derived, TRUE, &permute_map, &is_permuted) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "couldn't create MPI file type")
+    /* Sanity check */
+    if(is_permuted)
+        HDassert(permute_map);
+    if(H5S_mpio_space_type(mem_space, type_info->src_type_size, &ent->mtype,
+            &ent->mcount, &ent->mt_is_derived, FALSE, &permute_map, &is_permuted) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "couldn't create MPI buffer type")
+    /* Sanity check */
+    if(is_permuted)
+        HDassert(!permute_map);
+
+    multi->ncoll++;
+
+done:
+    if(ret_value < 0 && ent) {
+        if(ent->ft_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&ent->ftype)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+        if(ent->mt_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&ent->mtype)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_multi_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_cmp_multi_ent
+ *
+ * Purpose:     Compares two entries of a multi-dataset collective access,
+ *              by dataset address, then by position in the operation
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__mpio_cmp_multi_ent(const void *_ent1, const void *_ent2)
+{
+    const H5D_mpio_multi_ent_t *ent1 = (const H5D_mpio_multi_ent_t *)_ent1;
+    const H5D_mpio_multi_ent_t *ent2 = (const H5D_mpio_multi_ent_t *)_ent2;
+    int ret_value;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_ne(ent1->addr, ent2->addr))
+        ret_value = H5F_addr_cmp(ent1->addr, ent2->addr);
+    else
+        ret_value = (ent1->idx > ent2->idx) - (ent1->idx < ent2->idx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_cmp_multi_ent() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_multi_io
+ *
+ * Purpose:     Reads or writes all the contiguous datasets queued in a
+ *              multi-dataset operation with one collective MPI-IO call.
+ *
+ *              The file and memory types of the datasets are combined
+ *              into one struct type each, with the datasets sorted by
+ *              address so the file type's displacements increase, and
+ *              handed to H5D__final_collective_io().  Every process
+ *              queues the same datasets, since the choice of collective
+ *              I/O for each one is made by all of them together.
+ *
+ *              If datasets overlap in the file (a dataset was listed more
+ *              than once), one collective call is made per dataset.
+ *
+ *              DSET is used for its file; the queued entries are
+ *              released, whether the I/O succeeded or not.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__mpio_multi_io(const H5D_t *dset, hid_t dxpl_id, H5D_io_op_type_t op_type,
+    H5D_multi_io_t *multi)
+{
+    H5D_io_info_t io_info;              /* I/O info for the combined operation */
+    H5D_storage_t store;                /* Base address of the combined operation */
+    H5D_mpio_multi_ent_t *coll;         /* Queued entries */
+    int *fcounts = NULL;                /* # of file types for each dataset */
+    int *mcounts = NULL;                /* # of memory types for each dataset */
+    MPI_Aint *fdisps = NULL;            /* File displacements of the datasets */
+    MPI_Aint *mdisps = NULL;            /* Memory displacements of the buffers */
+    MPI_Datatype *ftypes = NULL;        /* File types of the datasets */
+    MPI_Datatype *mtypes = NULL;        /* Memory types of the datasets */
+    MPI_Datatype final_ftype;           /* Combined file type */
+    MPI_Datatype final_mtype;           /* Combined memory type */
+    hbool_t final_ft_is_derived = FALSE;
+    hbool_t final_mt_is_derived = FALSE;
+    hbool_t overlap = FALSE;            /* Whether datasets overlap in the file */
+    size_t u;                           /* Local index variable */
+    int mpi_code;                       /* MPI return code */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(multi);
+
+    if(multi->ncoll == 0)
+        HGOTO_DONE(SUCCEED)
+    coll = multi->coll;
+
+    /* Sort the datasets by address */
+    HDqsort(coll, multi->ncoll, sizeof(H5D_mpio_multi_ent_t), H5D__mpio_cmp_multi_ent);
+    for(u = 1; u < multi->ncoll; u++)
+        if(H5F_addr_lt(coll[u].addr, coll[u - 1].addr + coll[u - 1].size))
+            overlap = TRUE;
+
+    /* Set up I/O info for the direct MPI-IO routines */
+    HDmemset(&io_info, 0, sizeof(io_info));
+    io_info.dset = dset;
+    io_info.raw_dxpl_id = dxpl_id;
+    io_info.md_dxpl_id = dxpl_id;
+    io_info.store = &store;
+    io_info.io_ops.single_read = H5D__mpio_select_read;
+    io_info.io_ops.single_write = H5D__mpio_select_write;
+    io_info.op_type = op_type;
+    io_info.multi = NULL;
+
+    if(overlap) {
+        /* One collective operation per dataset, in address order */
+        for(u = 0; u < multi->ncoll; u++) {
+            store.contig.dset_addr = coll[u].addr;
+            store.contig.dset_size = coll[u].size;
+            io_info.u.rbuf = (void *)coll[u].buf;
+            if(H5D__final_collective_io(&io_info, NULL, (hsize_t)coll[u].mcount, &coll[u].ftype, &coll[u].mtype) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish collective MPI-IO")
+        } /* end for */
+    } /* end if */
+    else {
+        size_t base_buf = 0;            /* Entry with the lowest buffer address */
+
+        /* Allocate the arrays for the combined types */
+        if(NULL == (fcounts = (int *)H5MM_malloc(multi->ncoll * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate file counts buffer")
+        if(NULL == (mcounts = (int *)H5MM_malloc(multi->ncoll * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate memory counts buffer")
+        if(NULL == (fdisps = (MPI_Aint *)H5MM_malloc(multi->ncoll * sizeof(MPI_Aint))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate file displacement buffer")
+        if(NULL == (mdisps = (MPI_Aint *)H5MM_malloc(multi->ncoll * sizeof(MPI_Aint))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate memory displacement buffer")
+        if(NULL == (ftypes = (MPI_Datatype *)H5MM_malloc(multi->ncoll * sizeof(MPI_Datatype))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate file type buffer")
+        if(NULL == (mtypes = (MPI_Datatype *)H5MM_malloc(multi->ncoll * sizeof(MPI_Datatype))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate memory type buffer")
+
+        /* Place the datasets relative to the first one in the file, and
+         * the buffers relative to the lowest one in memory */
+        for(u = 0; u < multi->ncoll; u++) {
+            if(MPI_SUCCESS != (mpi_code = MPI_Get_address((void *)coll[u].buf, &mdisps[u])))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+            if(mdisps[u] < mdisps[base_buf])
+                base_buf = u;
+        } /* end for */
+        for(u = 0; u < multi->ncoll; u++) {
+            fcounts[u] = coll[u].fcount;
+            fdisps[u] = (MPI_Aint)(coll[u].addr - coll[0].addr);
+            ftypes[u] = coll[u].ftype;
+            mcounts[u] = coll[u].mcount;
+            mtypes[u] = coll[u].mtype;
+        } /* end for */
+        for(u = 0; u < multi->ncoll; u++)
+            if(u != base_buf)
+                mdisps[u] -= mdisps[base_buf];
+        mdisps[base_buf] = 0;
+
+        /* Create final MPI derived datatype for the file */
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_create_struct((int)multi->ncoll, fcounts, fdisps, ftypes, &final_ftype)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_struct failed", mpi_code)
+        final_ft_is_derived = TRUE;
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&final_ftype)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+        /* Create final MPI derived datatype for memory */
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_create_struct((int)multi->ncoll, mcounts, mdisps, mtypes, &final_mtype)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_struct failed", mpi_code)
+        final_mt_is_derived = TRUE;
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&final_mtype)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+        /* Perform final collective I/O operation */
+        store.contig.dset_addr = coll[0].addr;
+        store.contig.dset_size = (coll[multi->ncoll - 1].addr + coll[multi->ncoll - 1].size) - coll[0].addr;
+        io_info.u.rbuf = (void *)coll[base_buf].buf;
+        if(H5D__final_collective_io(&io_info, NULL, (hsize_t)1, &final_ftype, &final_mtype) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish collective MPI-IO")
+    } /* end else */
+
+done:
+    if(final_ft_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&final_ftype)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    if(final_mt_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&final_mtype)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    H5MM_xfree(fcounts);
+    H5MM_xfree(mcounts);
+    H5MM_xfree(fdisps);
+    H5MM_xfree(mdisps);
+    H5MM_xfree(ftypes);
+    H5MM_xfree(mtypes);
+
+    if(H5D__mpio_multi_reset(multi) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release collective accesses")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_multi_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_multi_reset
+ *
+ * Purpose:     Releases the collective accesses queued in a multi-dataset
+ *              operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__mpio_multi_reset(H5D_multi_io_t *multi)
+{
+    size_t u;                           /* Local index variable */
+    int mpi_code;                       /* MPI return code */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(multi);
+
+    for(u = 0; u < multi->ncoll; u++) {
+        if(multi->coll[u].ft_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&multi->coll[u].ftype)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+        if(multi->coll[u].mt_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&multi->coll[u].mtype)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    } /* end for */
+    multi->coll = (H5D_mpio_multi_ent_t *)H5MM_xfree(multi->coll);
+    multi->ncoll = multi->max_ncoll = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_multi_reset() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__final_collective_io
@@ -1484,6 +2620,81 @@ H5D__cmp_chunk_addr(const void *chunk_addr_info1, const void *chunk_addr_info2)
    FUNC_LEAVE_NOAPI(H5F_addr_cmp(addr1, addr2))
 } /* end H5D__cmp_chunk_addr() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_filtered_chunk_sel
+ *
+ * Purpose:     Routine to compare selections in filtered chunks, by chunk
+ *              index and then by the rank of the selecting process
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_filtered_chunk_sel(const void *sel1, const void *sel2)
+{
+   const H5D_filtered_chunk_sel_t *s1 = (const H5D_filtered_chunk_sel_t *)sel1;
+   const H5D_filtered_chunk_sel_t *s2 = (const H5D_filtered_chunk_sel_t *)sel2;
+   int ret_value;
+
+   FUNC_ENTER_STATIC_NOERR
+
+   if(s1->index != s2->index)
+       ret_value = (s1->index < s2->index) ? -1 : 1;
+   else
+       ret_value = (s1->rank > s2->rank) - (s1->rank < s2->rank);
+
+   FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cmp_filtered_chunk_sel() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_filtered_chunk_addr
+ *
+ * Purpose:     Routine to compare the file addresses of filtered chunks,
+ *              given pointers to them
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_filtered_chunk_addr(const void *chunk1, const void *chunk2)
+{
+   haddr_t addr1, addr2;
+
+   FUNC_ENTER_STATIC_NOERR
+
+   addr1 = (*(const H5D_filtered_chunk_t * const *)chunk1)->chunk_block.offset;
+   addr2 = (*(const H5D_filtered_chunk_t * const *)chunk2)->chunk_block.offset;
+
+   FUNC_LEAVE_NOAPI(H5F_addr_cmp(addr1, addr2))
+} /* end H5D__cmp_filtered_chunk_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_chunk_realloc
+ *
+ * Purpose:     Routine to compare chunk reallocation records by chunk index
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_chunk_realloc(const void *chunk1, const void *chunk2)
+{
+   hsize_t index1, index2;
+
+   FUNC_ENTER_STATIC_NOERR
+
+   index1 = ((const H5D_chunk_realloc_t *)chunk1)->index;
+   index2 = ((const H5D_chunk_realloc_t *)chunk2)->index;
+
+   FUNC_LEAVE_NOAPI((index1 > index2) - (index1 < index2))
+} /* end H5D__cmp_chunk_realloc() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__sort_chunk
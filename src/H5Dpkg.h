@@ -53,6 +53,7 @@
     (io_info)->md_dxpl_id = dxpl_i;                                    \
     (io_info)->store = str;                                             \
     (io_info)->op_type = H5D_IO_OP_WRITE;                               \
+    (io_info)->multi = NULL;                                            \
     (io_info)->u.wbuf = buf
 #define H5D_BUILD_IO_INFO_RD(io_info, ds, dxpl_c, dxpl_i, str, buf)     \
     (io_info)->dset = ds;                                               \
@@ -61,12 +62,29 @@
     (io_info)->md_dxpl_id = dxpl_i;                                    \
     (io_info)->store = str;                                             \
     (io_info)->op_type = H5D_IO_OP_READ;                                \
+    (io_info)->multi = NULL;                                            \
     (io_info)->u.rbuf = buf
 
 /* Flags for marking aspects of a dataset dirty */
 #define H5D_MARK_SPACE  0x01
 #define H5D_MARK_LAYOUT  0x02
 
+/* Default creation parameters for chunk index data structures */
+/* (Values are stored in the layout message, so they can change without
+ *      breaking files that have already been written) */
+
+/* Fixed array creation values */
+#define H5D_FARRAY_MAX_DBLK_PAGE_NELMTS_BITS    10      /* i.e. 1024 elements per data block page */
+#define H5D_FARRAY_CREATE_PARAM_SIZE            1       /* Size of the creation parameters in the layout message */
+
+/* Extensible array creation values */
+#define H5D_EARRAY_MAX_NELMTS_BITS              32      /* i.e. 4 giga-elements */
+#define H5D_EARRAY_IDX_BLK_ELMTS                4
+#define H5D_EARRAY_SUP_BLK_MIN_DATA_PTRS        4
+#define H5D_EARRAY_DATA_BLK_MIN_ELMTS           16
+#define H5D_EARRAY_MAX_DBLOCK_PAGE_NELMTS_BITS  10      /* i.e. 1024 elements per data block page */
+#define H5D_EARRAY_CREATE_PARAM_SIZE            5       /* Size of the creation parameters in the layout message */
+
 
 /****************************/
 /* Package Private Typedefs */
@@ -213,6 +231,7 @@ typedef struct H5D_io_info_t {
         void *rbuf;             /* Pointer to buffer for read */
         const void *wbuf;       /* Pointer to buffer to write */
     } u;
+    struct H5D_multi_io_t *multi; /* Accesses gathered for a multi-dataset read or write, or NULL */
 } H5D_io_info_t;
 
 
@@ -350,6 +369,7 @@ typedef struct H5D_chunk_map_t {
     H5S_t  *single_space;       /* Dataspace for single chunk */
     H5D_chunk_info_t *single_chunk_info;  /* Pointer to single chunk's info */
     hbool_t use_single;         /* Whether I/O is on a single element */
+    hbool_t *sel_busy;          /* Dataset's flag for its cached selection info, or NULL if the info above belongs to this operation */
 
     hsize_t last_index;         /* Index of last chunk operated on */
     H5D_chunk_info_t *last_chunk_info;  /* Pointer to last chunk's info */
@@ -371,18 +391,47 @@ typedef struct H5D_chunk_cached_t {
     unsigned	filter_mask;			/*excluded filters	*/
 } H5D_chunk_cached_t;
 
+#ifdef H5_HAVE_PARALLEL
+/* New size & location of a filtered chunk rewritten by a collective write */
+typedef struct H5D_chunk_realloc_t {
+    hsize_t     index;                  /* "Index" of chunk in dataset */
+    H5F_block_t chunk_block;            /* Offset/length of chunk in file */
+    unsigned    filter_mask;            /* Excluded filters */
+} H5D_chunk_realloc_t;
+#endif /* H5_HAVE_PARALLEL */
+
 /* The raw data chunk cache */
 struct H5D_rdcc_ent_t;  /* Forward declaration of struct used below */
+struct H5D_rdcc_ghost_t;  /* Forward declaration of struct used below */
+struct H5D_rdcc_class_t;  /* Forward declaration of struct used below */
 typedef struct H5D_rdcc_t {
     struct {
-        unsigned	ninits;	/* Number of chunk creations		*/
-        unsigned	nhits;	/* Number of cache hits			*/
-        unsigned	nmisses;/* Number of cache misses		*/
-        unsigned	nflushes;/* Number of cache flushes		*/
+        hsize_t		ninits;	/* Number of chunk creations		*/
+        hsize_t		nhits;	/* Number of cache hits			*/
+        hsize_t		nmisses;/* Number of cache misses		*/
+        hsize_t		nevictions;/* Number of chunks preempted	*/
+        hsize_t		nflushes;/* Number of cache flushes		*/
+        hsize_t		nbytes_read; /* Bytes read from the file on misses */
+        hsize_t		nbytes_written; /* Bytes written to the file	*/
     } stats;
     size_t		nbytes_max; /* Maximum cached raw data in bytes	*/
     size_t		nslots;	/* Number of chunk slots allocated	*/
     double		w0;     /* Chunk preemption policy          */
+    H5D_chunk_cache_policy_t policy; /* Replacement policy		*/
+    const struct H5D_rdcc_class_t *cls; /* Replacement policy class	*/
+
+    /* State for the adaptive replacement policy */
+    struct {
+        size_t		capacity; /* Number of chunks which fit in the cache */
+        size_t		target;	/* Target number of chunks used only once */
+        size_t		nonce;	/* Number of cached chunks used only once */
+        unsigned	admit;	/* Which ghost list the chunk being added was found on */
+        H5SL_t		*ghosts; /* Skip list of recently preempted chunks */
+        struct H5D_rdcc_ghost_t *head[2]; /* Oldest ghost on each list	*/
+        struct H5D_rdcc_ghost_t *tail[2]; /* Newest ghost on each list	*/
+        size_t		nghosts[2]; /* Number of ghosts on each list	*/
+    } arc;
+
     struct H5D_rdcc_ent_t *head; /* Head of doubly linked list		*/
     struct H5D_rdcc_ent_t *tail; /* Tail of doubly linked list		*/
     struct H5D_rdcc_ent_t *tmp_head; /* Head of temporary doubly linked list.  Chunks on this list are not in the hash table (slot).  The head entry is a sentinel (does not refer to an actual chunk). */
@@ -393,6 +442,7 @@ typedef struct H5D_rdcc_t {
     H5SL_t		*sel_chunks; /* Skip list containing information for each chunk selected */
     H5S_t		*single_space; /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t    *single_chunk_info;  /* Pointer to single chunk's info */
+    hbool_t             sel_busy;   /* Whether an I/O operation is using the selection info above */
 
     /* Cached information about scaled dataspace dimensions */
     hsize_t             scaled_dims[H5S_MAX_RANK];          /* The scaled dim sizes */
@@ -503,6 +553,39 @@ typedef struct {
     hsize_t size;       /* Accumulated number of bytes for the selection */
 } H5D_vlen_bufsize_t;
 
+/* IDs kept open while a read may give up the API lock (see H5D__read_hold) */
+typedef struct H5D_read_hold_t {
+    hid_t dset_id;      /* ID of the dataset being read, or negative */
+    hid_t file_id;      /* ID of the dataset's file, or negative */
+} H5D_read_hold_t;
+
+/* List of raw data blocks for one vector read or write, built in a readvv
+ * or writevv operation or by H5D__contig_vector_add() */
+typedef struct H5D_contig_vector_ud_t {
+    haddr_t dset_addr;          /* Address of dataset */
+    hbool_t is_write;           /* Whether the blocks are written (otherwise read) */
+    unsigned char *rbuf;        /* Pointer to memory buffer for reads */
+    const unsigned char *wbuf;  /* Pointer to memory buffer for writes */
+    size_t max_nblocks;         /* # of blocks the arrays can hold */
+    size_t nblocks;             /* # of blocks in the arrays */
+    haddr_t *addrs;             /* File addresses of blocks */
+    size_t *sizes;              /* Sizes of blocks */
+    void **rbufs;               /* Memory locations of blocks for reads */
+    const void **wbufs;         /* Memory locations of blocks for writes */
+} H5D_contig_vector_ud_t;
+
+/* Accesses gathered across the datasets of one H5Dread_multi() or
+ * H5Dwrite_multi() call, to be issued together once all the datasets
+ * have been set up */
+typedef struct H5D_multi_io_t {
+    H5D_contig_vector_ud_t vec; /* Blocks for drivers that set H5FD_FEAT_VECTOR_IO */
+#ifdef H5_HAVE_PARALLEL
+    size_t ncoll;               /* # of collective accesses */
+    size_t max_ncoll;           /* # of collective accesses the array can hold */
+    struct H5D_mpio_multi_ent_t *coll;  /* Collective accesses to contiguous datasets */
+#endif /* H5_HAVE_PARALLEL */
+} H5D_multi_io_t;
+
 
 /*****************************/
 /* Package Private Variables */
@@ -518,6 +601,8 @@ H5_DLLVAR const H5D_layout_ops_t H5D_LOPS_VIRTUAL[1];
 
 /* Chunked layout operations */
 H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_BTREE[1];
+H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_FARRAY[1];
+H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_EARRAY[1];
 
 
 /******************************/
@@ -542,6 +627,7 @@ H5_DLL herr_t H5D__vlen_get_buf_size(void *elem, hid_t type_id, unsigned ndim,
     const hsize_t *point, void *op_data);
 H5_DLL herr_t H5D__check_filters(H5D_t *dataset);
 H5_DLL herr_t H5D__set_extent(H5D_t *dataset, const hsize_t *size, hid_t dxpl_id);
+H5_DLL herr_t H5D__refresh(H5D_t *dataset, hid_t dxpl_id);
 H5_DLL herr_t H5D__get_dxpl_cache(hid_t dxpl_id, H5D_dxpl_cache_t **cache);
 H5_DLL herr_t H5D__flush_sieve_buf(H5D_t *dataset, hid_t dxpl_id);
 H5_DLL herr_t H5D__mark(const H5D_t *dataset, hid_t dxpl_id, unsigned flags);
@@ -551,12 +637,15 @@ H5_DLL herr_t H5D_set_io_info_dxpls(H5D_io_info_t *io_info, hid_t dxpl_id);
 #endif /* H5_DEBUG_BUILD */
 
 /* Internal I/O routines */
+H5_DLL herr_t H5D__read_hold(const H5D_t *dataset, hid_t dset_id,
+    H5D_read_hold_t *hold);
+H5_DLL herr_t H5D__read_release(H5D_read_hold_t *hold);
 H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id,
     const H5S_t *mem_space, const H5S_t *file_space, hid_t dset_xfer_plist,
-    void *buf/*out*/);
+    void *buf/*out*/, H5D_multi_io_t *multi);
 H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id,
     const H5S_t *mem_space, const H5S_t *file_space, hid_t dset_xfer_plist,
-    const void *buf);
+    const void *buf, H5D_multi_io_t *multi);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info,
@@ -570,6 +659,9 @@ H5_DLL herr_t H5D__select_write(const H5D_io_info_t *io_info,
 H5_DLL herr_t H5D__scatter_mem(const void *_tscat_buf,
     const H5S_t *space, H5S_sel_iter_t *iter, size_t nelmts,
     const H5D_dxpl_cache_t *dxpl_cache, void *_buf);
+H5_DLL size_t H5D__gather_mem(const void *_buf,
+    const H5S_t *space, H5S_sel_iter_t *iter, size_t nelmts,
+    const H5D_dxpl_cache_t *dxpl_cache, void *_tgath_buf/*out*/);
 H5_DLL herr_t H5D__scatgath_read(const H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info,
     hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space);
@@ -599,6 +691,13 @@ H5_DLL herr_t H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *ty
 H5_DLL herr_t H5D__contig_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
     H5D_chunk_map_t *fm);
+H5_DLL herr_t H5D__contig_vector_add(const H5D_io_info_t *io_info, size_t elmt_size,
+    size_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
+    H5D_contig_vector_ud_t *vec);
+H5_DLL herr_t H5D__contig_vector_read(const H5D_io_info_t *io_info,
+    H5D_contig_vector_ud_t *vec);
+H5_DLL herr_t H5D__contig_vector_flush(const H5F_t *f, hid_t dxpl_id,
+    H5D_contig_vector_ud_t *vec);
 H5_DLL herr_t H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src,
     H5F_t *f_dst, H5O_storage_contig_t *storage_dst, H5T_t *src_dtype,
     H5O_copy_t *cpy_info, hid_t dxpl_id);
@@ -610,6 +709,8 @@ H5_DLL htri_t H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr,
     hbool_t write_op);
 H5_DLL herr_t H5D__chunk_create(const H5D_t *dset /*in,out*/, hid_t dxpl_id);
 H5_DLL herr_t H5D__chunk_set_info(const H5D_t *dset);
+H5_DLL herr_t H5D__chunk_index_close(const H5D_t *dset, hid_t dxpl_id);
+H5_DLL herr_t H5D__chunk_index_reopen(const H5D_t *dset, hid_t dxpl_id);
 H5_DLL hbool_t H5D__chunk_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL herr_t H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id,
     const hsize_t *scaled, H5D_chunk_ud_t *udata);
@@ -619,6 +720,8 @@ H5_DLL herr_t H5D__chunk_prune_by_extent(H5D_t *dset, hid_t dxpl_id,
     const hsize_t *old_dim);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
+H5_DLL herr_t H5D__chunk_collective_realloc(const H5D_io_info_t *io_info,
+    size_t nchunks, H5D_chunk_realloc_t chunks[]);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset, hid_t dxpl_id);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
@@ -632,6 +735,9 @@ H5_DLL herr_t H5D__chunk_delete(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
     H5O_storage_t *store);
 H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters, 
          hsize_t *offset, uint32_t data_size, const void *buf);
+H5_DLL herr_t H5D__chunk_cache_stats(const H5D_t *dset,
+    H5D_chunk_cache_stats_t *stats);
+H5_DLL herr_t H5D__chunk_cache_reset_stats(const H5D_t *dset);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
@@ -694,6 +800,12 @@ H5_DLL herr_t H5D__contig_collective_write(H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, hsize_t nelmts, const H5S_t *file_space,
     const H5S_t *mem_space, H5D_chunk_map_t *fm);
 
+/* MPI-IO functions to handle the contiguous datasets of a multi-dataset
+ * read or write with one collective operation */
+H5_DLL herr_t H5D__mpio_multi_io(const H5D_t *dset, hid_t dxpl_id,
+    H5D_io_op_type_t op_type, H5D_multi_io_t *multi);
+H5_DLL herr_t H5D__mpio_multi_reset(H5D_multi_io_t *multi);
+
 /* MPI-IO functions to handle chunked collective IO */
 H5_DLL herr_t H5D__chunk_collective_read(H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, hsize_t nelmts, const H5S_t *file_space,
@@ -714,6 +826,7 @@ H5_DLL htri_t H5D__mpio_opt_possible(const H5D_io_info_t *io_info,
 /* Testing functions */
 #ifdef H5D_TESTING
 H5_DLL herr_t H5D__layout_version_test(hid_t did, unsigned *version);
+H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_contig_size_test(hid_t did, hsize_t *size);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
 #endif /* H5D_TESTING */
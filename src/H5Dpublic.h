@@ -55,9 +55,11 @@ typedef enum H5D_layout_t {
     H5D_NLAYOUTS	= 4	/*this one must be last!		     */
 } H5D_layout_t;
 
-/* Types of chunk index data structures */
+/* Types of chunk index data structures (values are stored in the file) */
 typedef enum H5D_chunk_index_t {
     H5D_CHUNK_IDX_BTREE	= 0,	/* v1 B-tree index		     	*/
+    H5D_CHUNK_IDX_FARRAY = 3,   /* Fixed array (no unlimited dimensions) */
+    H5D_CHUNK_IDX_EARRAY = 4,   /* Extensible array (one unlimited dimension) */
     H5D_CHUNK_IDX_NTYPES        /* this one must be last!		*/
 } H5D_chunk_index_t;
 
@@ -101,6 +103,31 @@ typedef enum H5D_vds_view_t {
     H5D_VDS_LAST_AVAILABLE      = 1
 } H5D_vds_view_t;
 
+/* Replacement policies for the raw data chunk cache */
+typedef enum H5D_chunk_cache_policy_t {
+    H5D_CHUNK_CACHE_POLICY_ERROR    = -1,
+    H5D_CHUNK_CACHE_POLICY_W0       = 0,    /* Least recently used, preferring fully read or written chunks as set by w0 (default) */
+    H5D_CHUNK_CACHE_POLICY_LRU      = 1,    /* Strictly least recently used */
+    H5D_CHUNK_CACHE_POLICY_ARC      = 2,    /* Adaptive: balances chunks used once against chunks used again, so scans don't evict chunks in steady use */
+    H5D_CHUNK_CACHE_POLICY_NTYPES           /* Number of policies, must be last */
+} H5D_chunk_cache_policy_t;
+
+/* Raw data chunk cache statistics of a dataset, for H5Dget_chunk_cache_stats() */
+typedef struct H5D_chunk_cache_stats_t {
+    hsize_t     nhits;          /* # of chunk accesses satisfied by the cache */
+    hsize_t     nmisses;        /* # of chunk accesses that read the chunk from the file */
+    hsize_t     ninits;         /* # of chunks created in the cache (not in the file yet) */
+    hsize_t     nevictions;     /* # of chunks preempted from the cache to make room */
+    hsize_t     nflushes;       /* # of dirty chunks written from the cache to the file */
+    hsize_t     nbytes_read;    /* # of bytes of chunks read from the file */
+    hsize_t     nbytes_written; /* # of bytes of chunks written to the file */
+    size_t      nused;          /* # of chunks in the cache now */
+    size_t      nbytes_used;    /* # of bytes of chunks in the cache now */
+    size_t      nslots;         /* # of hash table slots of the cache */
+    size_t      nbytes_max;     /* Maximum # of bytes of chunks in the cache */
+    H5D_chunk_cache_policy_t policy;    /* Replacement policy in use */
+} H5D_chunk_cache_stats_t;
+
 /********************/
 /* Public Variables */
 /********************/
@@ -142,6 +169,10 @@ H5_DLL herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			hid_t file_space_id, hid_t plist_id, void *buf/*out*/);
 H5_DLL herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			 hid_t file_space_id, hid_t plist_id, const void *buf);
+H5_DLL herr_t H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id, void *buf[]/*out*/);
+H5_DLL herr_t H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id, const void *buf[]);
 H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void *buf);
@@ -149,6 +180,9 @@ H5_DLL herr_t H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_
 H5_DLL herr_t H5Dfill(const void *fill, hid_t fill_type, void *buf,
         hid_t buf_type, hid_t space);
 H5_DLL herr_t H5Dset_extent(hid_t dset_id, const hsize_t size[]);
+H5_DLL herr_t H5Drefresh(hid_t dset_id);
+H5_DLL herr_t H5Dget_chunk_cache_stats(hid_t dset_id, H5D_chunk_cache_stats_t *stats /*out*/);
+H5_DLL herr_t H5Dreset_chunk_cache_stats(hid_t dset_id);
 H5_DLL herr_t H5Dscatter(H5D_scatter_func_t op, void *op_data, hid_t type_id,
     hid_t dst_space_id, void *dst_buf);
 H5_DLL herr_t H5Dgather(hid_t src_space_id, const void *src_buf, hid_t type_id,
@@ -100,6 +100,47 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5D__layout_version_test() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__layout_idx_type_test
+ PURPOSE
+    Determine the storage layout index type for a dataset's layout information
+ USAGE
+    herr_t H5D__layout_idx_type_test(did, idx_type)
+        hid_t did;              IN: Dataset to query
+        H5D_chunk_index_t *idx_type;    OUT: Pointer to location to place index type info
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Checks the index type of the storage layout information for a dataset.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type)
+{
+    H5D_t	*dset;          /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL, "not a dataset")
+    if(dset->shared->layout.type != H5D_CHUNKED)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL, "dataset is not chunked")
+
+    if(idx_type)
+        *idx_type = dset->shared->layout.storage.u.chunk.idx_type;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5D__layout_idx_type_test() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -88,6 +88,8 @@ hbool_t H5_PKG_INIT_VAR = FALSE;
  * client class..
  */
 const H5EA_class_t *const H5EA_client_class_g[] = {
+    H5EA_CLS_CHUNK,		/* 0 - H5EA_CLS_CHUNK_ID 		*/
+    H5EA_CLS_FILT_CHUNK,	/* 1 - H5EA_CLS_FILT_CHUNK_ID 		*/
     H5EA_CLS_TEST,		/* ? - H5EA_CLS_TEST_ID			*/
 };
 
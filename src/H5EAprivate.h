@@ -50,6 +50,9 @@
 /* Extensible array class IDs */
 typedef enum H5EA_cls_id_t {
     /* Start real class IDs at 0 -QAK */
+    H5EA_CLS_CHUNK_ID = 0,      /* Extensible array is for indexing dataset chunks w/o filters */
+    H5EA_CLS_FILT_CHUNK_ID,     /* Extensible array is for indexing dataset chunks w/filters */
+
     /* (keep these last) */
     H5EA_CLS_TEST_ID,	        /* Extensible array is for testing (do not use for actual data) */
     H5EA_NUM_CLS_ID             /* Number of Extensible Array class IDs (must be last) */
@@ -117,6 +120,10 @@ typedef struct H5EA_t H5EA_t;
 /* Library-private Variables */
 /*****************************/
 
+/* The extensible array classes for dataset chunks */
+H5_DLLVAR const H5EA_class_t H5EA_CLS_CHUNK[1];
+H5_DLLVAR const H5EA_class_t H5EA_CLS_FILT_CHUNK[1];
+
 
 /***************************************/
 /* Library-private Function Prototypes */
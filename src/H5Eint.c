@@ -701,6 +701,14 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
     HDassert(min_id > 0);
     HDassert(fmt);
 
+#ifdef H5_HAVE_THREADSAFE
+    /* Threads running outside the API lock (pool workers, or a thread in a
+     * driver read which gave the lock up) only hand back a status, and the
+     * error is reported once the lock is held again */
+    if(H5TS_api_unlocked())
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_THREADSAFE */
+
 /* Note that the variable-argument parsing for the format is identical in
  *      the H5Epush2() routine - correct errors and make changes in both
  *      places. -QAK
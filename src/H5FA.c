@@ -79,6 +79,8 @@ hbool_t H5_PKG_INIT_VAR = FALSE;
  * client class..
  */
 const H5FA_class_t *const H5FA_client_class_g[] = {
+    H5FA_CLS_CHUNK,		/* 0 - H5FA_CLS_CHUNK_ID 		*/
+    H5FA_CLS_FILT_CHUNK,	/* 1 - H5FA_CLS_FILT_CHUNK_ID 		*/
     H5FA_CLS_TEST,		/* ? - H5FA_CLS_TEST_ID 		*/
 };
 
@@ -394,7 +396,7 @@ HDfprintf(stderr, "%s: fixed array data block address not defined!\n", FUNC, idx
         /* Check if the page has been created yet */
         if(!H5VM_bit_get(dblock->dblk_page_init, page_idx)) {
             /* Create the data block page */
-            if(H5FA__dblk_page_create(hdr, dxpl_id, dblk_page_addr, dblk_page_nelmts) < 0)
+            if(H5FA__dblk_page_create(hdr, dblock, dxpl_id, dblk_page_addr, dblk_page_nelmts) < 0)
                 H5E_THROW(H5E_CANTCREATE, "unable to create data block page")
 
 	    /* Mark data block page as initialized in data block */
@@ -403,7 +405,7 @@ HDfprintf(stderr, "%s: fixed array data block address not defined!\n", FUNC, idx
 	} /* end if */
 
         /* Protect the data block page */
-	if(NULL == (dblk_page = H5FA__dblk_page_protect(hdr, dxpl_id, dblk_page_addr, dblk_page_nelmts, H5AC__NO_FLAGS_SET)))
+	if(NULL == (dblk_page = H5FA__dblk_page_protect(hdr, dblock, dxpl_id, dblk_page_addr, dblk_page_nelmts, H5AC__NO_FLAGS_SET)))
 	    H5E_THROW(H5E_CANTPROTECT, "unable to protect fixed array data block page, address = %llu", (unsigned long long)dblk_page_addr)
 
         /* Set the element in the data block page */
@@ -510,7 +512,7 @@ HDfprintf(stderr, "%s: Index %Hu\n", FUNC, idx);
                     dblk_page_nelmts = dblock->dblk_page_nelmts;
 
                 /* Protect the data block page */
-                if(NULL == (dblk_page = H5FA__dblk_page_protect(hdr, dxpl_id, dblk_page_addr, dblk_page_nelmts, H5AC__READ_ONLY_FLAG)))
+                if(NULL == (dblk_page = H5FA__dblk_page_protect(hdr, dblock, dxpl_id, dblk_page_addr, dblk_page_nelmts, H5AC__READ_ONLY_FLAG)))
                     H5E_THROW(H5E_CANTPROTECT, "unable to protect fixed array data block page, address = %llu", (unsigned long long)dblk_page_addr)
 
                 /* Retrieve element from data block */
@@ -528,6 +530,76 @@ CATCH
 END_FUNC(PRIV)  /* end H5FA_get() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FA_depend
+ *
+ * Purpose:	Make a child flush dependency between the fixed array's
+ *              header and another piece of metadata in the file.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PRIV, ERR,
+herr_t, SUCCEED, FAIL,
+H5FA_depend(H5AC_info_t *parent_entry, H5FA_t *fa))
+
+    /* Local variables */
+    H5FA_hdr_t *hdr = fa->hdr;          /* Header for FA */
+
+    /*
+     * Check arguments.
+     */
+    HDassert(fa);
+    HDassert(hdr);
+
+    /* Set the shared array header's file context for this operation */
+    hdr->f = fa->f;
+
+    /* Set up flush dependency between parent entry and fixed array header */
+    if(H5FA__create_flush_depend(parent_entry, (H5AC_info_t *)hdr) < 0)
+        H5E_THROW(H5E_CANTDEPEND, "unable to create flush dependency on file metadata")
+
+CATCH
+
+END_FUNC(PRIV)  /* end H5FA_depend() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FA_undepend
+ *
+ * Purpose:	Remove a child flush dependency between the fixed array's
+ *              header and another piece of metadata in the file.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PRIV, ERR,
+herr_t, SUCCEED, FAIL,
+H5FA_undepend(H5AC_info_t *parent_entry, H5FA_t *fa))
+
+    /* Local variables */
+    H5FA_hdr_t *hdr = fa->hdr;          /* Header for FA */
+
+    /*
+     * Check arguments.
+     */
+    HDassert(fa);
+    HDassert(hdr);
+
+    /* Set the shared array header's file context for this operation */
+    hdr->f = fa->f;
+
+    /* Remove flush dependency between parent entry and fixed array header */
+    if(H5FA__destroy_flush_depend(parent_entry, (H5AC_info_t *)hdr) < 0)
+        H5E_THROW(H5E_CANTUNDEPEND, "unable to destroy flush dependency on file metadata")
+
+CATCH
+
+END_FUNC(PRIV)  /* end H5FA_undepend() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5FA_close
  *
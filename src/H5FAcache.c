@@ -88,6 +88,7 @@ static herr_t H5FA__cache_dblock_image_len(const void *thing,
     size_t *compressed_image_len_ptr);
 static herr_t H5FA__cache_dblock_serialize(const H5F_t *f, void *image, size_t len,
     void *thing);
+static herr_t H5FA__cache_dblock_notify(H5AC_notify_action_t action, void *thing);
 static herr_t H5FA__cache_dblock_free_icr(void *thing);
 static herr_t H5FA__cache_dblock_fsf_size(const void *thing, size_t *fsf_size);
 
@@ -99,6 +100,7 @@ static herr_t H5FA__cache_dblk_page_image_len(const void *thing,
     size_t *compressed_image_len_ptr);
 static herr_t H5FA__cache_dblk_page_serialize(const H5F_t *f, void *image, size_t len,
     void *thing);
+static herr_t H5FA__cache_dblk_page_notify(H5AC_notify_action_t action, void *thing);
 static herr_t H5FA__cache_dblk_page_free_icr(void *thing);
 
 
@@ -134,7 +136,7 @@ const H5AC_class_t H5AC_FARRAY_DBLOCK[1] = {{
     H5FA__cache_dblock_image_len,       /* 'image_len' callback */
     NULL,                               /* 'pre_serialize' callback */
     H5FA__cache_dblock_serialize,       /* 'serialize' callback */
-    NULL,                               /* 'notify' callback */
+    H5FA__cache_dblock_notify,          /* 'notify' callback */
     H5FA__cache_dblock_free_icr,        /* 'free_icr' callback */
     NULL,				/* 'clear' callback */
     H5FA__cache_dblock_fsf_size,        /* 'fsf_size' callback */
@@ -151,7 +153,7 @@ const H5AC_class_t H5AC_FARRAY_DBLK_PAGE[1] = {{
     H5FA__cache_dblk_page_image_len,    /* 'image_len' callback */
     NULL,                               /* 'pre_serialize' callback */
     H5FA__cache_dblk_page_serialize,    /* 'serialize' callback */
-    NULL,                               /* 'notify' callback */
+    H5FA__cache_dblk_page_notify,       /* 'notify' callback */
     H5FA__cache_dblk_page_free_icr,     /* 'free_icr' callback */
     NULL,				/* 'clear' callback */
     NULL,                               /* 'fsf_size' callback */
@@ -711,6 +713,53 @@ CATCH
 END_FUNC(STATIC)   /* end H5FA__cache_dblock_serialize() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FA__cache_dblock_notify
+ *
+ * Purpose:	Handle cache action notifications
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(STATIC, ERR,
+herr_t, SUCCEED, FAIL,
+H5FA__cache_dblock_notify(H5AC_notify_action_t action, void *_thing))
+
+    /* Local variables */
+    H5FA_dblock_t *dblock = (H5FA_dblock_t *)_thing;      /* Pointer to the object */
+
+    /* Sanity check */
+    HDassert(dblock);
+
+    /* Determine which action to take */
+    switch(action) {
+        case H5AC_NOTIFY_ACTION_AFTER_INSERT:
+        case H5AC_NOTIFY_ACTION_AFTER_LOAD:
+            /* Create flush dependency on parent */
+            if(H5FA__create_flush_depend((H5AC_info_t *)dblock->hdr, (H5AC_info_t *)dblock) < 0)
+                H5E_THROW(H5E_CANTDEPEND, "unable to create flush dependency between data block and parent, address = %llu", (unsigned long long)dblock->addr)
+            break;
+
+	case H5AC_NOTIFY_ACTION_AFTER_FLUSH:
+	    /* do nothing */
+	    break;
+
+        case H5AC_NOTIFY_ACTION_BEFORE_EVICT:
+            /* Destroy flush dependency on parent */
+            if(H5FA__destroy_flush_depend((H5AC_info_t *)dblock->hdr, (H5AC_info_t *)dblock) < 0)
+                H5E_THROW(H5E_CANTUNDEPEND, "unable to destroy flush dependency between data block and parent, address = %llu", (unsigned long long)dblock->addr)
+            break;
+
+        default:
+            H5E_THROW(H5E_BADVALUE, "unknown action from metadata cache")
+    } /* end switch */
+
+CATCH
+
+END_FUNC(STATIC)   /* end H5FA__cache_dblock_notify() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5FA__cache_dblock_free_icr
  *
@@ -857,6 +906,7 @@ H5FA__cache_dblk_page_deserialize(const void *_image, size_t len,
 	H5E_THROW(H5E_CANTALLOC, "memory allocation failed for fixed array data block page")
 
     /* Set the fixed array data block's information */
+    dblk_page->parent = udata->parent;
     dblk_page->addr = udata->dblk_page_addr;
 
     /* Internal information */
@@ -983,6 +1033,53 @@ CATCH
 END_FUNC(STATIC)   /* end H5FA__cache_dblk_page_serialize() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5FA__cache_dblk_page_notify
+ *
+ * Purpose:	Handle cache action notifications
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(STATIC, ERR,
+herr_t, SUCCEED, FAIL,
+H5FA__cache_dblk_page_notify(H5AC_notify_action_t action, void *_thing))
+
+    /* Local variables */
+    H5FA_dblk_page_t *dblk_page = (H5FA_dblk_page_t *)_thing;      /* Pointer to the object */
+
+    /* Sanity check */
+    HDassert(dblk_page);
+
+    /* Determine which action to take */
+    switch(action) {
+        case H5AC_NOTIFY_ACTION_AFTER_INSERT:
+        case H5AC_NOTIFY_ACTION_AFTER_LOAD:
+            /* Create flush dependency on parent */
+            if(H5FA__create_flush_depend((H5AC_info_t *)dblk_page->parent, (H5AC_info_t *)dblk_page) < 0)
+                H5E_THROW(H5E_CANTDEPEND, "unable to create flush dependency between data block page and parent, address = %llu", (unsigned long long)dblk_page->addr)
+            break;
+
+	case H5AC_NOTIFY_ACTION_AFTER_FLUSH:
+	    /* do nothing */
+	    break;
+
+        case H5AC_NOTIFY_ACTION_BEFORE_EVICT:
+            /* Destroy flush dependency on parent */
+            if(H5FA__destroy_flush_depend((H5AC_info_t *)dblk_page->parent, (H5AC_info_t *)dblk_page) < 0)
+                H5E_THROW(H5E_CANTUNDEPEND, "unable to destroy flush dependency between data block page and parent, address = %llu", (unsigned long long)dblk_page->addr)
+            break;
+
+        default:
+            H5E_THROW(H5E_BADVALUE, "unknown action from metadata cache")
+    } /* end switch */
+
+CATCH
+
+END_FUNC(STATIC)   /* end H5FA__cache_dblk_page_notify() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5FA__cache_dblk_page_free_icr
  *
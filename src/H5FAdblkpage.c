@@ -149,7 +149,8 @@ END_FUNC(PKG)   /* end H5FA__dblk_page_alloc() */
  */
 BEGIN_FUNC(PKG, ERR,
 herr_t, SUCCEED, FAIL,
-H5FA__dblk_page_create(H5FA_hdr_t *hdr, hid_t dxpl_id, haddr_t addr, size_t nelmts))
+H5FA__dblk_page_create(H5FA_hdr_t *hdr, H5FA_dblock_t *parent, hid_t dxpl_id,
+    haddr_t addr, size_t nelmts))
 
     /* Local variables */
     H5FA_dblk_page_t *dblk_page = NULL;      /* Fixed array data block page */
@@ -160,12 +161,14 @@ HDfprintf(stderr, "%s: Called, addr = %a\n", FUNC, addr);
 
     /* Sanity check */
     HDassert(hdr);
+    HDassert(parent);
 
     /* Allocate the data block page */
     if(NULL == (dblk_page = H5FA__dblk_page_alloc(hdr, nelmts)))
         H5E_THROW(H5E_CANTALLOC, "memory allocation failed for fixed array data block page")
 
     /* Set info about data block page on disk */
+    dblk_page->parent = parent;
     dblk_page->addr = addr;
     dblk_page->size = H5FA_DBLK_PAGE_SIZE(hdr, nelmts);
 #ifdef H5FA_DEBUG
@@ -206,8 +209,8 @@ END_FUNC(PKG)   /* end H5FA__dblk_page_create() */
  */
 BEGIN_FUNC(PKG, ERR,
 H5FA_dblk_page_t *, NULL, NULL,
-H5FA__dblk_page_protect(H5FA_hdr_t *hdr, hid_t dxpl_id, haddr_t dblk_page_addr,
-    size_t dblk_page_nelmts, unsigned flags))
+H5FA__dblk_page_protect(H5FA_hdr_t *hdr, H5FA_dblock_t *parent, hid_t dxpl_id,
+    haddr_t dblk_page_addr, size_t dblk_page_nelmts, unsigned flags))
 
     /* Local variables */
     H5FA_dblk_page_cache_ud_t udata;      /* Information needed for loading data block page */
@@ -218,6 +221,7 @@ HDfprintf(stderr, "%s: Called\n", FUNC);
 
     /* Sanity check */
     HDassert(hdr);
+    HDassert(parent);
     HDassert(H5F_addr_defined(dblk_page_addr));
 
     /* only the H5AC__READ_ONLY_FLAG is permitted */
@@ -225,6 +229,7 @@ HDfprintf(stderr, "%s: Called\n", FUNC);
 
     /* Set up user data */
     udata.hdr = hdr;
+    udata.parent = parent;
     udata.nelmts = dblk_page_nelmts;
     udata.dblk_page_addr = dblk_page_addr;
 
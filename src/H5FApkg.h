@@ -180,6 +180,7 @@ typedef struct H5FA_dbk_page_t {
 
     /* Internal array information (not stored) */
     H5FA_hdr_t    *hdr;         /* Shared array header info                     */
+    H5FA_dblock_t *parent;      /* Parent data block (for flush dependency)     */
 
     /* Computed/cached values (not stored) */
     haddr_t     addr;           /* Address of this data block page on disk      */
@@ -212,6 +213,7 @@ typedef struct H5FA_dblock_cache_ud_t {
 /* Info needed for loading data block page */
 typedef struct H5FA_dblk_page_cache_ud_t {
     H5FA_hdr_t *hdr;            /* Shared fixed array information           */
+    H5FA_dblock_t *parent;      /* Pointer to parent data block             */
     size_t nelmts;              /* Number of elements in data block page    */
     haddr_t     dblk_page_addr; /* Address of data block page on disk */
 } H5FA_dblk_page_cache_ud_t;
@@ -241,6 +243,12 @@ H5_DLLVAR const H5FA_class_t *const H5FA_client_class_g[H5FA_NUM_CLS_ID];
 /* Package Private Prototypes */
 /******************************/
 
+/* Generic routines */
+H5_DLL herr_t H5FA__create_flush_depend(H5AC_info_t *parent_entry,
+    H5AC_info_t *child_entry);
+H5_DLL herr_t H5FA__destroy_flush_depend(H5AC_info_t *parent_entry,
+    H5AC_info_t *child_entry);
+
 /* Header routines */
 H5_DLL H5FA_hdr_t *H5FA__hdr_alloc(H5F_t *f);
 H5_DLL herr_t H5FA__hdr_init(H5FA_hdr_t *hdr, void *ctx_udata);
@@ -271,11 +279,12 @@ H5_DLL herr_t H5FA__dblock_delete(H5FA_hdr_t *hdr, hid_t dxpl_id,
 H5_DLL herr_t H5FA__dblock_dest(H5FA_dblock_t *dblock);
 
 /* Data block page routines */
-H5_DLL herr_t H5FA__dblk_page_create(H5FA_hdr_t *hdr, hid_t dxpl_id,
-    haddr_t addr, size_t nelmts);
+H5_DLL herr_t H5FA__dblk_page_create(H5FA_hdr_t *hdr, H5FA_dblock_t *parent,
+    hid_t dxpl_id, haddr_t addr, size_t nelmts);
 H5_DLL H5FA_dblk_page_t *H5FA__dblk_page_alloc(H5FA_hdr_t *hdr, size_t nelmts);
-H5_DLL H5FA_dblk_page_t *H5FA__dblk_page_protect(H5FA_hdr_t *hdr, hid_t dxpl_id,
-    haddr_t dblk_page_addr, size_t dblk_page_nelmts, unsigned flags);
+H5_DLL H5FA_dblk_page_t *H5FA__dblk_page_protect(H5FA_hdr_t *hdr,
+    H5FA_dblock_t *parent, hid_t dxpl_id, haddr_t dblk_page_addr,
+    size_t dblk_page_nelmts, unsigned flags);
 H5_DLL herr_t H5FA__dblk_page_unprotect(H5FA_dblk_page_t *dblk_page,
     hid_t dxpl_id, unsigned cache_flags);
 H5_DLL herr_t H5FA__dblk_page_dest(H5FA_dblk_page_t *dblk_page);
@@ -32,6 +32,7 @@
 #endif /* NOT_YET */
 
 /* Private headers needed by this file */
+#include "H5ACprivate.h"	/* Metadata cache			*/
 #include "H5Fprivate.h"		/* File access				*/
 
 
@@ -47,6 +48,9 @@
 /* Fixed Array class IDs */
 typedef enum H5FA_cls_id_t {
     /* Start real class IDs at 0 -QAK */
+    H5FA_CLS_CHUNK_ID = 0,      /* Fixed array is for indexing dataset chunks w/o filters */
+    H5FA_CLS_FILT_CHUNK_ID,     /* Fixed array is for indexing dataset chunks w/filters */
+
     /* (keep these last) */
     H5FA_CLS_TEST_ID,           /* Fixed array is for testing (do not use for actual data)  */
     H5FA_NUM_CLS_ID             /* Number of Fixed Array class IDs (must be last)           */
@@ -104,6 +108,10 @@ typedef int (*H5FA_operator_t)(hsize_t idx, const void *_elmt, void *_udata);
 /* Library-private Variables */
 /*****************************/
 
+/* The fixed array classes for dataset chunks */
+H5_DLLVAR const H5FA_class_t H5FA_CLS_CHUNK[1];
+H5_DLLVAR const H5FA_class_t H5FA_CLS_FILT_CHUNK[1];
+
 
 /***************************************/
 /* Library-private Function Prototypes */
@@ -117,6 +125,8 @@ H5_DLL herr_t H5FA_get_nelmts(const H5FA_t *fa, hsize_t *nelmts);
 H5_DLL herr_t H5FA_get_addr(const H5FA_t *fa, haddr_t *addr);
 H5_DLL herr_t H5FA_set(const H5FA_t *fa, hid_t dxpl_id, hsize_t idx, const void *elmt);
 H5_DLL herr_t H5FA_get(const H5FA_t *fa, hid_t dxpl_id, hsize_t idx, void *elmt);
+H5_DLL herr_t H5FA_depend(H5AC_info_t *parent_entry, H5FA_t *fa);
+H5_DLL herr_t H5FA_undepend(H5AC_info_t *parent_entry, H5FA_t *fa);
 H5_DLL herr_t H5FA_iterate(H5FA_t *fa, hid_t dxpl_id, H5FA_operator_t op, void *udata);
 H5_DLL herr_t H5FA_close(H5FA_t *fa, hid_t dxpl_id);
 H5_DLL herr_t H5FA_delete(H5F_t *f, hid_t dxpl_id, haddr_t fa_addr, void *ctx_udata);
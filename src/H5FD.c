@@ -279,6 +279,58 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5FDregister() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FDregister_vector
+ *
+ * Purpose:	Registers a new file driver with vector I/O callbacks as a
+ *		member of the virtual file driver class.  This is the same
+ *		as H5FDregister(), for drivers whose 'query' callback sets
+ *		H5FD_FEAT_VECTOR_IO.
+ *
+ * Return:	Success:	A file driver ID which is good until the
+ *				library is closed or the driver is
+ *				unregistered.
+ *
+ *		Failure:	A negative value.
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FDregister_vector(const H5FD_class_vector_t *cls)
+{
+    hid_t		ret_value;
+    H5FD_mem_t		type;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("i", "*x", cls);
+
+    /* Check arguments */
+    if(!cls)
+	HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL, "null class pointer is disallowed")
+    if(!cls->super.open || !cls->super.close)
+	HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL, "`open' and/or `close' methods are not defined")
+    if(!cls->super.get_eoa || !cls->super.set_eoa)
+	HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL, "`get_eoa' and/or `set_eoa' methods are not defined")
+    if(!cls->super.get_eof)
+	HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL, "`get_eof' method is not defined")
+    if(!cls->super.read || !cls->super.write)
+	HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL, "`read' and/or `write' method is not defined")
+    if(!cls->read_vector || !cls->write_vector)
+	HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL, "`read_vector' and/or `write_vector' method is not defined")
+    for (type=H5FD_MEM_DEFAULT; type<H5FD_MEM_NTYPES; H5_INC_ENUM(H5FD_mem_t,type))
+	if(cls->super.fl_map[type]<H5FD_MEM_NOLIST || cls->super.fl_map[type]>=H5FD_MEM_NTYPES)
+	    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid free-list mapping")
+
+    /* Create the new class ID */
+    if((ret_value=H5FD_register(cls, sizeof(H5FD_class_vector_t), TRUE)) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTREGISTER, FAIL, "unable to register file driver ID")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDregister_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_register
@@ -819,6 +871,7 @@ H5FD_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     if(H5I_inc_ref(file->driver_id, FALSE) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTINC, NULL, "unable to increment ref count on VFL driver")
     file->cls = driver;
+    file->access_flags = flags;
     file->maxaddr = maxaddr;
     if(H5P_get(plist, H5F_ACS_ALIGN_THRHD_NAME, &(file->threshold)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment threshold")
@@ -1587,6 +1640,154 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5FDwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FDread_vector
+ *
+ * Purpose:	Reads COUNT blocks from FILE according to the data transfer
+ *		property list DXPL_ID (which may be the constant
+ *		H5P_DEFAULT).  Block U is SIZES[U] bytes of memory type
+ *		TYPES[U] beginning at address ADDRS[U] and is read into
+ *		the buffer BUFS[U].
+ *
+ *		Drivers that set H5FD_FEAT_VECTOR_IO service the whole
+ *		list in one call; for the others this is the same as one
+ *		H5FDread() per block.
+ *
+ * Return:	Success:	Non-negative. The read results are written
+ *				into the BUFS buffers which should be
+ *				allocated by the caller.
+ *
+ *		Failure:	Negative. The contents of BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDread_vector(H5FD_t *file, hid_t dxpl_id, size_t count,
+    const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+    void *bufs[]/*out*/)
+{
+    H5P_genplist_t *dxpl;               /* DXPL object */
+    haddr_t     *rel_addrs = NULL;      /* Addresses relative to base address */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*xiz*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes,
+             bufs);
+
+    /* Check args */
+    if(!file || !file->cls)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file pointer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+    if(count > 0 && (!types || !addrs || !sizes || !bufs))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null block list")
+    for(u = 0; u < count; u++)
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null result buffer")
+
+    /* Get the DXPL plist object for DXPL ID */
+    if(NULL == (dxpl = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
+
+    /* Compensate for base address addition in internal routine */
+    if(file->base_addr > 0 && count > 0) {
+        if(NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address list")
+        for(u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+    } /* end if */
+
+    /* Do the real work */
+    if(H5FD_read_vector(file, dxpl, count, types, rel_addrs ? rel_addrs : addrs, sizes, bufs) < 0)
+	HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file vector read request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDread_vector() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FDwrite_vector
+ *
+ * Purpose:	Writes COUNT blocks to FILE according to the data transfer
+ *		property list DXPL_ID (which may be the constant
+ *		H5P_DEFAULT).  Block U is SIZES[U] bytes of memory type
+ *		TYPES[U] taken from the buffer BUFS[U] and written
+ *		beginning at address ADDRS[U].
+ *
+ *		Drivers that set H5FD_FEAT_VECTOR_IO service the whole
+ *		list in one call; for the others this is the same as one
+ *		H5FDwrite() per block.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, size_t count,
+    const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+    const void *bufs[])
+{
+    H5P_genplist_t *dxpl;               /* DXPL object */
+    haddr_t     *rel_addrs = NULL;      /* Addresses relative to base address */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*xiz*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes,
+             bufs);
+
+    /* Check args */
+    if(!file || !file->cls)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file pointer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+    if(count > 0 && (!types || !addrs || !sizes || !bufs))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null block list")
+    for(u = 0; u < count; u++)
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null buffer")
+
+    /* Get the DXPL plist object for DXPL ID */
+    if(NULL == (dxpl = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
+
+    /* Compensate for base address addition in internal routine */
+    if(file->base_addr > 0 && count > 0) {
+        if(NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address list")
+        for(u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+    } /* end if */
+
+    /* The real work */
+    if(H5FD_write_vector(file, dxpl, count, types, rel_addrs ? rel_addrs : addrs, sizes, bufs) < 0)
+	HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file vector write request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDwrite_vector() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FDflush
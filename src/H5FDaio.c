@@ -0,0 +1,1450 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The asynchronous POSIX file driver.  Single reads and writes
+ *          are plain pread() and pwrite() calls, as in the sec2 driver.
+ *          The blocks of a vector read or write are all queued at once
+ *          and completed in any order: through an io_uring submission
+ *          queue when the kernel supports it, otherwise by the calling
+ *          thread and threads from the library's worker pool (in
+ *          thread-safe builds) each issuing pread() or pwrite() for the
+ *          next block in the queue.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDprivate.h"    /* File drivers             */
+#include "H5FDaio.h"        /* Aio file driver          */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+#include "H5TSprivate.h"    /* Threads                  */
+
+#ifdef H5_HAVE_AIO
+
+/* Use io_uring through its system calls when the kernel headers have them */
+#if defined(H5_HAVE_LINUX_IO_URING_H) && defined(__GNUC__)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define H5FD_AIO_HAVE_URING
+#endif /* __NR_io_uring_setup && __NR_io_uring_enter */
+#endif /* H5_HAVE_LINUX_IO_URING_H && __GNUC__ */
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_AIO_g = 0;
+
+/* Largest queue depth asked of the kernel */
+#define H5FD_AIO_MAX_QUEUE_DEPTH    4096
+
+/* Driver-specific file access properties */
+typedef struct H5FD_aio_fapl_t {
+    unsigned    queue_depth;    /* Most requests in flight at once          */
+    unsigned    nthreads;       /* Threads issuing requests without io_uring */
+    unsigned    flags;          /* H5FD_AIO_* flags                         */
+} H5FD_aio_fapl_t;
+
+#ifdef H5FD_AIO_HAVE_URING
+/* An io_uring instance: the submission and completion rings shared with
+ * the kernel */
+typedef struct H5FD_aio_ring_t {
+    int         fd;             /* io_uring file descriptor                 */
+    unsigned    depth;          /* Most requests in flight at once          */
+    void        *sq_ptr;        /* Mapped submission ring                   */
+    size_t      sq_size;        /* Size of submission ring mapping          */
+    void        *cq_ptr;        /* Mapped completion ring (may be sq_ptr)   */
+    size_t      cq_size;        /* Size of completion ring mapping          */
+    struct io_uring_sqe *sqes;  /* Mapped submission queue entries          */
+    size_t      sqes_size;      /* Size of submission entries mapping       */
+    unsigned    *sq_head;       /* Submission ring head (kernel advances)   */
+    unsigned    *sq_tail;       /* Submission ring tail (we advance)        */
+    unsigned    *sq_mask;       /* Submission ring index mask               */
+    unsigned    *sq_array;      /* Submission ring of entry indices         */
+    unsigned    *cq_head;       /* Completion ring head (we advance)        */
+    unsigned    *cq_tail;       /* Completion ring tail (kernel advances)   */
+    unsigned    *cq_mask;       /* Completion ring index mask               */
+    struct io_uring_cqe *cqes;  /* Completion ring entries                  */
+} H5FD_aio_ring_t;
+#endif /* H5FD_AIO_HAVE_URING */
+
+/* The description of a file belonging to this driver.  The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).  Reads
+ * and writes give their offset to the system call, so there is no file
+ * position to track.
+ */
+typedef struct H5FD_aio_t {
+    H5FD_t          pub;        /* public stuff, must be first      */
+    int             fd;         /* the filesystem file descriptor   */
+    haddr_t         eoa;        /* end of allocated region          */
+    haddr_t         eof;        /* end of file; current file size   */
+    H5FD_aio_fapl_t fa;         /* driver-specific file access properties */
+    char            filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
+    dev_t           device;     /* file device number   */
+    ino_t           inode;      /* file i-node number   */
+#ifdef H5FD_AIO_HAVE_URING
+    hbool_t         use_ring;   /* Whether 'ring' is set up         */
+    H5FD_aio_ring_t ring;       /* io_uring for vector operations   */
+#endif /* H5FD_AIO_HAVE_URING */
+} H5FD_aio_t;
+
+/* One block of a vector operation */
+typedef struct H5FD_aio_req_t {
+    haddr_t         addr;       /* File address of the part not done yet    */
+    unsigned char   *buf;       /* Memory for the part not done yet         */
+    size_t          size;       /* # of bytes not done yet                  */
+    int             err;        /* errno of a failed request, or 0          */
+#ifdef H5FD_AIO_HAVE_URING
+    struct iovec    iov;        /* I/O vector handed to the kernel          */
+#endif /* H5FD_AIO_HAVE_URING */
+} H5FD_aio_req_t;
+
+/* The blocks of a vector operation, for the threads issuing them */
+typedef struct H5FD_aio_batch_t {
+    int             fd;         /* File descriptor                          */
+    hbool_t         is_write;   /* Whether the blocks are written           */
+    size_t          nreqs;      /* # of blocks                              */
+    H5FD_aio_req_t  *reqs;      /* Array of blocks                          */
+    size_t          next;       /* Next block for a thread to claim         */
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_simple_t lock;   /* Lock protecting "next"                   */
+#endif /* H5_HAVE_THREADSAFE */
+} H5FD_aio_batch_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR (((haddr_t)1<<(8*sizeof(HDoff_t)-1))-1)
+#define ADDR_OVERFLOW(A)    (HADDR_UNDEF==(A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z)    ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) ||    \
+                                 HADDR_UNDEF==(A)+(Z) ||                    \
+                                (HDoff_t)((A)+(Z))<(HDoff_t)(A))
+
+/* Prototypes */
+static herr_t H5FD_aio_term(void);
+static void *H5FD_aio_fapl_get(H5FD_t *file);
+static void *H5FD_aio_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD_aio_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD_aio_close(H5FD_t *_file);
+static int H5FD_aio_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_aio_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_aio_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_aio_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_aio_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_aio_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_aio_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_aio_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD_aio_read_vector(H5FD_t *_file, hid_t dxpl_id, size_t count,
+            const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+            void *bufs[]);
+static herr_t H5FD_aio_write_vector(H5FD_t *_file, hid_t dxpl_id, size_t count,
+            const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+            const void *bufs[]);
+static herr_t H5FD_aio_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_aio_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_aio_unlock(H5FD_t *_file);
+
+/* Helper routines */
+static void H5FD_aio_do_req(int fd, hbool_t is_write, H5FD_aio_req_t *req);
+static void H5FD_aio_worker(void *_batch);
+static herr_t H5FD_aio_run(H5FD_aio_t *file, hbool_t is_write, size_t count,
+            const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+#ifdef H5FD_AIO_HAVE_URING
+static herr_t H5FD_aio_ring_init(H5FD_aio_ring_t *ring, unsigned depth);
+static void H5FD_aio_ring_term(H5FD_aio_ring_t *ring);
+static herr_t H5FD_aio_ring_run(H5FD_aio_t *file, hbool_t is_write, size_t nreqs,
+            H5FD_aio_req_t reqs[]);
+#endif /* H5FD_AIO_HAVE_URING */
+
+static const H5FD_class_vector_t H5FD_aio_g = {
+    {   /* Start of superclass information */
+    "aio",                      /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD_aio_term,              /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_aio_fapl_t),    /* fapl_size            */
+    H5FD_aio_fapl_get,          /* fapl_get             */
+    H5FD_aio_fapl_copy,         /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD_aio_open,              /* open                 */
+    H5FD_aio_close,             /* close                */
+    H5FD_aio_cmp,               /* cmp                  */
+    H5FD_aio_query,             /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD_aio_get_eoa,           /* get_eoa              */
+    H5FD_aio_set_eoa,           /* set_eoa              */
+    H5FD_aio_get_eof,           /* get_eof              */
+    H5FD_aio_get_handle,        /* get_handle           */
+    H5FD_aio_read,              /* read                 */
+    H5FD_aio_write,             /* write                */
+    NULL,                       /* flush                */
+    H5FD_aio_truncate,          /* truncate             */
+    H5FD_aio_lock,              /* lock                 */
+    H5FD_aio_unlock,            /* unlock               */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    },  /* End of superclass information */
+    H5FD_aio_read_vector,       /* read_vector          */
+    H5FD_aio_write_vector       /* write_vector         */
+};
+
+/* Declare a free list to manage the H5FD_aio_t struct */
+H5FL_DEFINE_STATIC(H5FD_aio_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_aio_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize aio VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the aio driver.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_aio_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;          /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_AIO_g))
+        H5FD_AIO_g = H5FD_register((const H5FD_class_t *)&H5FD_aio_g, sizeof(H5FD_class_vector_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_AIO_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD_aio_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_AIO_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_aio_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_aio
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_AIO
+ *              driver defined in this source file.  QUEUE_DEPTH is the
+ *              most blocks of a vector operation in flight at once with
+ *              io_uring and NTHREADS the number of threads issuing them
+ *              otherwise; zero selects the default for either.  FLAGS is
+ *              a combination of the H5FD_AIO_* flags.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_aio(hid_t fapl_id, unsigned queue_depth, unsigned nthreads,
+    unsigned flags)
+{
+    H5P_genplist_t      *plist;      /* Property list pointer */
+    H5FD_aio_fapl_t     fa;
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIuIuIu", fapl_id, queue_depth, nthreads, flags);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(flags & ~(unsigned)H5FD_AIO_NO_URING)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown flags")
+
+    fa.queue_depth = queue_depth ? queue_depth : H5FD_AIO_QUEUE_DEPTH_DEF;
+    fa.nthreads = nthreads ? nthreads : H5FD_AIO_NTHREADS_DEF;
+    fa.flags = flags;
+
+    ret_value = H5P_set_driver(plist, H5FD_AIO, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_aio() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_aio
+ *
+ * Purpose:     Returns information about the aio file access property
+ *              list through the function arguments.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_aio(hid_t fapl_id, unsigned *queue_depth/*out*/,
+    unsigned *nthreads/*out*/, unsigned *flags/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_aio_fapl_t *fa;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, queue_depth, nthreads, flags);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_AIO != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_aio_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(queue_depth)
+        *queue_depth = fa->queue_depth;
+    if(nthreads)
+        *nthreads = fa->nthreads;
+    if(flags)
+        *flags = fa->flags;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_aio() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_fapl_get
+ *
+ * Purpose:     Returns a copy of the file access properties a file was
+ *              opened with.
+ *
+ * Return:      Success:    Ptr to new file access properties
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_aio_fapl_get(H5FD_t *_file)
+{
+    H5FD_aio_t  *file = (H5FD_aio_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(H5FD_aio_fapl_copy(&(file->fa)))
+} /* end H5FD_aio_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_fapl_copy
+ *
+ * Purpose:     Copies the aio-specific file access properties.
+ *
+ * Return:      Success:    Ptr to new file access properties
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_aio_fapl_copy(const void *_old_fa)
+{
+    const H5FD_aio_fapl_t *old_fa = (const H5FD_aio_fapl_t *)_old_fa;
+    H5FD_aio_fapl_t *new_fa;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(NULL != (new_fa = (H5FD_aio_fapl_t *)H5MM_malloc(sizeof(H5FD_aio_fapl_t))))
+        HDmemcpy(new_fa, old_fa, sizeof(H5FD_aio_fapl_t));
+
+    FUNC_LEAVE_NOAPI(new_fa)
+} /* end H5FD_aio_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file, and sets up
+ *              an io_uring instance for it when the kernel allows.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_aio_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_aio_t      *file       = NULL;     /* aio VFD info             */
+    int             fd          = -1;       /* File descriptor          */
+    int             o_flags;                /* Flags for open() call    */
+    h5_stat_t       sb;
+    H5P_genplist_t  *plist;                 /* Property list pointer    */
+    const H5FD_aio_fapl_t *fa   = NULL;     /* Driver properties        */
+    H5FD_aio_fapl_t default_fa;             /* Default driver properties */
+    H5FD_t          *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_aio_fapl_t *)H5P_peek_driver_info(plist))) {
+        default_fa.queue_depth = H5FD_AIO_QUEUE_DEPTH_DEF;
+        default_fa.nthreads = H5FD_AIO_NTHREADS_DEF;
+        default_fa.flags = 0;
+        fa = &default_fa;
+    } /* end if */
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if(H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if(H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if(H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if((fd = HDopen(name, o_flags, 0666)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x", name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_aio_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->fa = *fa;
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+#ifdef H5FD_AIO_HAVE_URING
+    /* Set up the io_uring instance.  When the kernel doesn't support it
+     * (or forbids it), the threads issue the requests instead. */
+    if(!(file->fa.flags & H5FD_AIO_NO_URING))
+        file->use_ring = (hbool_t)(H5FD_aio_ring_init(&file->ring,
+                MIN(file->fa.queue_depth, H5FD_AIO_MAX_QUEUE_DEPTH)) >= 0);
+#endif /* H5FD_AIO_HAVE_URING */
+
+    /* Set return value */
+    ret_value = (H5FD_t*)file;
+
+done:
+    if(NULL == ret_value) {
+        if(fd >= 0)
+            HDclose(fd);
+        if(file)
+            file = H5FL_FREE(H5FD_aio_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_close(H5FD_t *_file)
+{
+    H5FD_aio_t  *file = (H5FD_aio_t *)_file;
+    herr_t      ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(file);
+
+#ifdef H5FD_AIO_HAVE_URING
+    /* Release the io_uring instance */
+    if(file->use_ring)
+        H5FD_aio_ring_term(&file->ring);
+#endif /* H5FD_AIO_HAVE_URING */
+
+    /* Close the underlying file */
+    if(HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_aio_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_aio_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_aio_t    *f1 = (const H5FD_aio_t *)_f1;
+    const H5FD_aio_t    *f2 = (const H5FD_aio_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if(f1->device < f2->device) HGOTO_DONE(-1)
+    if(f1->device > f2->device) HGOTO_DONE(1)
+#else /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) < 0) HGOTO_DONE(-1)
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) > 0) HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if(f1->inode < f2->inode) HGOTO_DONE(-1)
+    if(f1->inode > f2->inode) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA;    /* OK to accumulate metadata for faster writes                      */
+        *flags |= H5FD_FEAT_DATA_SIEVE;             /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* VFD handle is POSIX I/O call compatible                          */
+        *flags |= H5FD_FEAT_CONCURRENT_READ;        /* OK to read raw data without the API lock                         */
+        *flags |= H5FD_FEAT_VECTOR_IO;              /* OK to hand lists of raw data blocks to the driver at once        */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_aio_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_aio_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_aio_t    *file = (const H5FD_aio_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_aio_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_aio_t  *file = (H5FD_aio_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_aio_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_aio_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_aio_t    *file = (const H5FD_aio_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD_aio_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_get_handle
+ *
+ * Purpose:     Returns the file handle of aio file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_aio_t          *file = (H5FD_aio_t *)_file;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_do_req
+ *
+ * Purpose:     Reads or writes one block with pread() or pwrite(), being
+ *              careful of interrupted system calls, partial results, and
+ *              the end of the file (past which a read returns zeros).
+ *              Runs on worker threads, so it only records the errno of a
+ *              failure in the request.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_aio_do_req(int fd, hbool_t is_write, H5FD_aio_req_t *req)
+{
+    /* No FUNC_ENTER, this routine runs outside the library's API lock */
+
+    while(req->size > 0) {
+        h5_posix_io_t       bytes_in;       /* # of bytes to transfer   */
+        h5_posix_io_ret_t   bytes_done;     /* # of bytes transferred   */
+
+        /* Trying to transfer more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if(req->size > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)req->size;
+
+        do {
+            if(is_write)
+                bytes_done = HDpwrite(fd, req->buf, bytes_in, (HDoff_t)req->addr);
+            else
+                bytes_done = HDpread(fd, req->buf, bytes_in, (HDoff_t)req->addr);
+        } while(-1 == bytes_done && EINTR == errno);
+
+        if(-1 == bytes_done) {
+            req->err = errno;
+            break;
+        } /* end if */
+        if(0 == bytes_done) {
+            if(is_write) {
+                req->err = EIO;
+                break;
+            } /* end if */
+
+            /* end of file but not end of format address space */
+            HDmemset(req->buf, 0, req->size);
+            req->size = 0;
+            break;
+        } /* end if */
+
+        req->size -= (size_t)bytes_done;
+        req->addr += (haddr_t)bytes_done;
+        req->buf += bytes_done;
+    } /* end while */
+} /* end H5FD_aio_do_req() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_worker
+ *
+ * Purpose:     Thread routine for vector operations without io_uring:
+ *              repeatedly claims the next block of a batch and reads or
+ *              writes it, until there are none left.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_aio_worker(void *_batch)
+{
+    H5FD_aio_batch_t *batch = (H5FD_aio_batch_t *)_batch;
+
+    /* No FUNC_ENTER, this routine runs outside the library's API lock */
+
+    for(;;) {
+        size_t idx;                     /* Index of block to transfer */
+
+        /* Claim the next block */
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_lock_simple(&batch->lock);
+#endif /* H5_HAVE_THREADSAFE */
+        idx = batch->next++;
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_unlock_simple(&batch->lock);
+#endif /* H5_HAVE_THREADSAFE */
+        if(idx >= batch->nreqs)
+            break;
+
+        H5FD_aio_do_req(batch->fd, batch->is_write, &batch->reqs[idx]);
+    } /* end for */
+} /* end H5FD_aio_worker() */
+
+#ifdef H5FD_AIO_HAVE_URING
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_ring_init
+ *
+ * Purpose:     Sets up an io_uring instance with room for DEPTH requests
+ *              and maps its rings.  Failure is expected on kernels without
+ *              io_uring, so no error is pushed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_ring_init(H5FD_aio_ring_t *ring, unsigned depth)
+{
+    struct io_uring_params params;      /* Parameters of the instance */
+    void        *ptr;                   /* Mapped memory */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDmemset(ring, 0, sizeof(*ring));
+    ring->sq_ptr = ring->cq_ptr = MAP_FAILED;
+    ring->sqes = (struct io_uring_sqe *)MAP_FAILED;
+
+    HDmemset(&params, 0, sizeof(params));
+    if((ring->fd = (int)syscall(__NR_io_uring_setup, depth, &params)) < 0)
+        HGOTO_DONE(FAIL)
+    ring->depth = MIN(params.sq_entries, params.cq_entries);
+
+    /* Map the rings, which the kernel may put in one mapping */
+    ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+#ifdef IORING_FEAT_SINGLE_MMAP
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->sq_size = ring->cq_size = MAX(ring->sq_size, ring->cq_size);
+#endif /* IORING_FEAT_SINGLE_MMAP */
+    if(MAP_FAILED == (ring->sq_ptr = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, (off_t)IORING_OFF_SQ_RING)))
+        HGOTO_DONE(FAIL)
+#ifdef IORING_FEAT_SINGLE_MMAP
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ptr = ring->sq_ptr;
+    else
+#endif /* IORING_FEAT_SINGLE_MMAP */
+    if(MAP_FAILED == (ring->cq_ptr = mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, (off_t)IORING_OFF_CQ_RING)))
+        HGOTO_DONE(FAIL)
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    if(MAP_FAILED == (ptr = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, (off_t)IORING_OFF_SQES)))
+        HGOTO_DONE(FAIL)
+    ring->sqes = (struct io_uring_sqe *)ptr;
+
+    /* Locate the fields of the rings */
+    ring->sq_head = (unsigned *)((char *)ring->sq_ptr + params.sq_off.head);
+    ring->sq_tail = (unsigned *)((char *)ring->sq_ptr + params.sq_off.tail);
+    ring->sq_mask = (unsigned *)((char *)ring->sq_ptr + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)((char *)ring->sq_ptr + params.sq_off.array);
+    ring->cq_head = (unsigned *)((char *)ring->cq_ptr + params.cq_off.head);
+    ring->cq_tail = (unsigned *)((char *)ring->cq_ptr + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)((char *)ring->cq_ptr + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)((char *)ring->cq_ptr + params.cq_off.cqes);
+
+done:
+    if(ret_value < 0 && ring->fd >= 0)
+        H5FD_aio_ring_term(ring);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_ring_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_ring_term
+ *
+ * Purpose:     Unmaps the rings of an io_uring instance and closes it.
+ *              Closing the instance waits for any requests in flight.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_aio_ring_term(H5FD_aio_ring_t *ring)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(ring->sqes != (struct io_uring_sqe *)MAP_FAILED)
+        munmap(ring->sqes, ring->sqes_size);
+    if(ring->cq_ptr != MAP_FAILED && ring->cq_ptr != ring->sq_ptr)
+        munmap(ring->cq_ptr, ring->cq_size);
+    if(ring->sq_ptr != MAP_FAILED)
+        munmap(ring->sq_ptr, ring->sq_size);
+    if(ring->fd >= 0)
+        HDclose(ring->fd);
+    ring->sq_ptr = ring->cq_ptr = MAP_FAILED;
+    ring->sqes = (struct io_uring_sqe *)MAP_FAILED;
+    ring->fd = -1;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_aio_ring_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_ring_run
+ *
+ * Purpose:     Reads or writes all the blocks of a vector operation
+ *              through the file's io_uring instance, keeping up to its
+ *              depth of requests in flight.  Partial transfers are
+ *              resubmitted for the rest of the block; a read that hits
+ *              the end of the file fills the rest of the block with
+ *              zeros.  Failed requests record their errno.
+ *
+ *              If the kernel stops taking requests, the instance is shut
+ *              down (which waits for those in flight) and the file goes
+ *              on without it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_ring_run(H5FD_aio_t *file, hbool_t is_write, size_t nreqs,
+    H5FD_aio_req_t reqs[])
+{
+    H5FD_aio_ring_t *ring = &file->ring;    /* io_uring instance */
+    size_t      *pending = NULL;        /* Circular queue of requests to submit */
+    size_t      pend_head = 0;          /* First request in the queue */
+    size_t      npending;               /* # of requests in the queue */
+    unsigned    ninflight = 0;          /* # of requests submitted and not complete */
+    unsigned    tail;                   /* Submission ring tail */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file->use_ring);
+    HDassert(nreqs > 0);
+
+    /* Queue all the requests */
+    if(NULL == (pending = (size_t *)H5MM_malloc(nreqs * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate request queue")
+    for(u = 0; u < nreqs; u++)
+        pending[u] = u;
+    npending = nreqs;
+
+    tail = *ring->sq_tail;
+    while(npending > 0 || ninflight > 0) {
+        unsigned    to_submit;          /* # of entries the kernel hasn't consumed */
+        unsigned    head;               /* Completion ring head */
+        unsigned    cq_tail;            /* Completion ring tail */
+        int         ret;                /* Return value of io_uring_enter */
+
+        /* Fill the submission ring */
+        while(npending > 0 && ninflight < ring->depth) {
+            size_t      idx = pending[pend_head];   /* Request to submit */
+            H5FD_aio_req_t *req = &reqs[idx];
+            unsigned    slot = tail & *ring->sq_mask;
+            struct io_uring_sqe *sqe = &ring->sqes[slot];
+
+            req->iov.iov_base = req->buf;
+            req->iov.iov_len = MIN(req->size, (size_t)H5_POSIX_MAX_IO_BYTES);
+
+            HDmemset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = (__u8)(is_write ? IORING_OP_WRITEV : IORING_OP_READV);
+            sqe->fd = file->fd;
+            sqe->addr = (__u64)(uintptr_t)&req->iov;
+            sqe->len = 1;
+            sqe->off = (__u64)req->addr;
+            sqe->user_data = (__u64)idx;
+            ring->sq_array[slot] = slot;
+            tail++;
+
+            pend_head = (pend_head + 1) % nreqs;
+            npending--;
+            ninflight++;
+        } /* end while */
+        __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+
+        /* Submit the new entries and wait for a completion */
+        to_submit = tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+        do {
+            ret = (int)syscall(__NR_io_uring_enter, ring->fd, to_submit, 1U,
+                    (unsigned)IORING_ENTER_GETEVENTS, NULL, (size_t)0);
+        } while(ret < 0 && EINTR == errno);
+        if(ret < 0) {
+            int myerrno = errno;
+
+            /* Give up on io_uring for this file */
+            H5FD_aio_ring_term(ring);
+            file->use_ring = FALSE;
+            HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "io_uring submission failed: filename = '%s', errno = %d, error message = '%s'", file->filename, myerrno, HDstrerror(myerrno))
+        } /* end if */
+
+        /* Reap the completions */
+        head = *ring->cq_head;
+        cq_tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        while(head != cq_tail) {
+            const struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+            size_t      idx = (size_t)cqe->user_data;
+            H5FD_aio_req_t *req = &reqs[idx];
+            int         res = cqe->res;
+            hbool_t     requeue = FALSE;
+
+            head++;
+            ninflight--;
+
+            if(res < 0) {
+                if(-EINTR == res || -EAGAIN == res)
+                    requeue = TRUE;
+                else
+                    req->err = -res;
+            } /* end if */
+            else if(0 == res) {
+                if(is_write)
+                    req->err = EIO;
+                else {
+                    /* end of file but not end of format address space */
+                    HDmemset(req->buf, 0, req->size);
+                    req->size = 0;
+                } /* end else */
+            } /* end if */
+            else {
+                HDassert((size_t)res <= req->size);
+                req->size -= (size_t)res;
+                req->addr += (haddr_t)res;
+                req->buf += res;
+                requeue = (hbool_t)(req->size > 0);
+            } /* end else */
+
+            if(requeue) {
+                pending[(pend_head + npending) % nreqs] = idx;
+                npending++;
+            } /* end if */
+        } /* end while */
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    } /* end while */
+
+done:
+    H5MM_xfree(pending);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_ring_run() */
+#endif /* H5FD_AIO_HAVE_URING */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_run
+ *
+ * Purpose:     Reads or writes the blocks of a vector operation: all the
+ *              non-empty blocks are queued, then completed through the
+ *              file's io_uring instance or by the calling thread and
+ *              threads from the library's worker pool.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_run(H5FD_aio_t *file, hbool_t is_write, size_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[])
+{
+    H5FD_aio_req_t  *reqs = NULL;       /* Blocks to transfer */
+    size_t          nreqs = 0;          /* # of blocks to transfer */
+    haddr_t         end = 0;            /* End of the last block */
+    size_t          u;                  /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check the blocks and queue the non-empty ones */
+    if(count > 0)
+        if(NULL == (reqs = (H5FD_aio_req_t *)H5MM_calloc(count * sizeof(H5FD_aio_req_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate request list")
+    for(u = 0; u < count; u++) {
+        if(0 == sizes[u])
+            continue;
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+
+        reqs[nreqs].addr = addrs[u];
+        reqs[nreqs].buf = (unsigned char *)bufs[u];
+        reqs[nreqs].size = sizes[u];
+        nreqs++;
+        end = MAX(end, addrs[u] + sizes[u]);
+    } /* end for */
+    if(0 == nreqs)
+        HGOTO_DONE(SUCCEED)
+
+#ifdef H5FD_AIO_HAVE_URING
+    if(file->use_ring) {
+        if(H5FD_aio_ring_run(file, is_write, nreqs, reqs) < 0)
+            HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "io_uring vector operation failed")
+    } /* end if */
+    else
+#endif /* H5FD_AIO_HAVE_URING */
+    {
+        H5FD_aio_batch_t batch;         /* Blocks for the threads */
+
+        batch.fd = file->fd;
+        batch.is_write = is_write;
+        batch.nreqs = nreqs;
+        batch.reqs = reqs;
+        batch.next = 0;
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_init(&batch.lock);
+        (void)H5TS_pool_run((unsigned)MIN(file->fa.nthreads, nreqs), H5FD_aio_worker, &batch);
+        H5TS_mutex_destroy(&batch.lock);
+#else /* H5_HAVE_THREADSAFE */
+        H5FD_aio_worker(&batch);
+#endif /* H5_HAVE_THREADSAFE */
+    } /* end else */
+
+    /* Check for failed blocks */
+    for(u = 0; u < nreqs; u++)
+        if(reqs[u].err) {
+            time_t mytime = HDtime(NULL);
+
+            if(is_write)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', offset = %llu", HDctime(&mytime), file->filename, file->fd, reqs[u].err, HDstrerror(reqs[u].err), (unsigned long long)reqs[u].addr)
+            else
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', offset = %llu", HDctime(&mytime), file->filename, file->fd, reqs[u].err, HDstrerror(reqs[u].err), (unsigned long long)reqs[u].addr)
+        } /* end if */
+
+    /* Update eof */
+    if(is_write && end > file->eof)
+        file->eof = end;
+
+done:
+    H5MM_xfree(reqs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_run() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_aio_t      *file       = (H5FD_aio_t *)_file;
+    H5FD_aio_req_t  req;                                    /* Block to read */
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    /* Read data */
+    HDmemset(&req, 0, sizeof(req));
+    req.addr = addr;
+    req.buf = (unsigned char *)buf;
+    req.size = size;
+    H5FD_aio_do_req(file->fd, FALSE, &req);
+    if(req.err) {
+        time_t mytime = HDtime(NULL);
+
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, req.err, HDstrerror(req.err), buf, (unsigned long long)size, (unsigned long long)req.addr)
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_aio_t      *file       = (H5FD_aio_t *)_file;
+    H5FD_aio_req_t  req;                                    /* Block to write */
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addr, (unsigned long long)size)
+
+    /* Write the data */
+    HDmemset(&req, 0, sizeof(req));
+    req.addr = addr;
+    /* (Casting away const OK) */
+H5_GCC_DIAG_OFF(cast-qual)
+    req.buf = (unsigned char *)buf;
+H5_GCC_DIAG_ON(cast-qual)
+    req.size = size;
+    H5FD_aio_do_req(file->fd, TRUE, &req);
+    if(req.err) {
+        time_t mytime = HDtime(NULL);
+
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total write size = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, req.err, HDstrerror(req.err), buf, (unsigned long long)size, (unsigned long long)req.addr)
+    } /* end if */
+
+    /* Update eof */
+    if(addr + size > file->eof)
+        file->eof = addr + size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_read_vector
+ *
+ * Purpose:     Reads COUNT blocks, block U being SIZES[U] bytes at address
+ *              ADDRS[U], into the buffers BUFS.  All the blocks are queued
+ *              before waiting for any of them, and complete in any order.
+ *              Calls for the same file must not overlap.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, size_t count,
+    const H5FD_mem_t H5_ATTR_UNUSED types[], const haddr_t addrs[], const size_t sizes[],
+    void *bufs[] /*out*/)
+{
+    H5FD_aio_t      *file       = (H5FD_aio_t *)_file;
+    herr_t          ret_value   = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    if(H5FD_aio_run(file, FALSE, count, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_write_vector
+ *
+ * Purpose:     Writes COUNT blocks, block U being SIZES[U] bytes from
+ *              BUFS[U] to address ADDRS[U].  All the blocks are queued
+ *              before waiting for any of them, and complete in any order,
+ *              so they must not overlap.  Calls for the same file must
+ *              not overlap either.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, size_t count,
+    const H5FD_mem_t H5_ATTR_UNUSED types[], const haddr_t addrs[], const size_t sizes[],
+    const void *bufs[])
+{
+    H5FD_aio_t      *file       = (H5FD_aio_t *)_file;
+    herr_t          ret_value   = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    /* (Casting away const OK) */
+H5_GCC_DIAG_OFF(cast-qual)
+    if(H5FD_aio_run(file, TRUE, count, addrs, sizes, (void **)bufs) < 0)
+H5_GCC_DIAG_ON(cast-qual)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_write_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as
+ *              the end-of-allocation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_aio_t *file = (H5FD_aio_t *)_file;
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Extend the file to make sure it's large enough */
+    if(!H5F_addr_eq(file->eoa, file->eof)) {
+        if(-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_aio_t *file = (H5FD_aio_t *)_file;     /* VFD file struct */
+    int lock;                                   /* The type of lock */
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Determine the type of lock */
+    lock = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place the lock with non-blocking */
+    if(HDflock(file->fd, lock | LOCK_NB) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to flock file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_aio_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_aio_unlock(H5FD_t *_file)
+{
+    H5FD_aio_t *file = (H5FD_aio_t *)_file;     /* VFD file struct */
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(HDflock(file->fd, LOCK_UN) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to flock (unlock) file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_aio_unlock() */
+
+#endif /* H5_HAVE_AIO */
@@ -0,0 +1,54 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the aio driver.
+ */
+#ifndef H5FDaio_H
+#define H5FDaio_H
+
+#ifdef H5_HAVE_AIO
+#       define H5FD_AIO        (H5FD_aio_init())
+#else
+#       define H5FD_AIO        (-1)
+#endif /* H5_HAVE_AIO */
+
+#ifdef H5_HAVE_AIO
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default values for the number of requests in flight at once and the
+ * number of threads issuing them when io_uring can't be used.  Applications
+ * can set these values through the function H5Pset_fapl_aio. */
+#define H5FD_AIO_QUEUE_DEPTH_DEF        64
+#define H5FD_AIO_NTHREADS_DEF           4
+
+/* Flags for H5Pset_fapl_aio */
+#define H5FD_AIO_NO_URING               0x0001  /* Always use threads, even when io_uring is available */
+
+H5_DLL hid_t H5FD_aio_init(void);
+H5_DLL herr_t H5Pset_fapl_aio(hid_t fapl_id, unsigned queue_depth,
+                        unsigned nthreads, unsigned flags);
+H5_DLL herr_t H5Pget_fapl_aio(hid_t fapl_id, unsigned *queue_depth/*out*/,
+                        unsigned *nthreads/*out*/, unsigned *flags/*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_AIO */
+
+#endif
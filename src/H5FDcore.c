@@ -124,6 +124,7 @@ typedef struct H5FD_core_fapl_t {
 static herr_t H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
 static herr_t H5FD__core_destroy_dirty_list(H5FD_core_t *file);
 static herr_t H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t H5FD__core_extend(H5FD_core_t *file, haddr_t end);
 static herr_t H5FD__core_term(void);
 static void *H5FD__core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -139,12 +140,19 @@ static herr_t H5FD__core_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, had
             size_t size, void *buf);
 static herr_t H5FD__core_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD__core_read_vector(H5FD_t *_file, hid_t dxpl_id, size_t count,
+            const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+            void *bufs[]);
+static herr_t H5FD__core_write_vector(H5FD_t *_file, hid_t dxpl_id, size_t count,
+            const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+            const void *bufs[]);
 static herr_t H5FD__core_flush(H5FD_t *_file, hid_t dxpl_id, unsigned closing);
 static herr_t H5FD__core_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_core_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_core_unlock(H5FD_t *_file);
 
-static const H5FD_class_t H5FD_core_g = {
+static const H5FD_class_vector_t H5FD_core_g = {
+    {   /* Start of superclass information */
     "core",                     /* name                 */
     MAXADDR,                    /* maxaddr              */
     H5F_CLOSE_WEAK,             /* fc_degree            */
@@ -177,6 +185,9 @@ static const H5FD_class_t H5FD_core_g = {
     H5FD_core_lock,             /* lock                 */
     H5FD_core_unlock,           /* unlock               */
     H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    },  /* End of superclass information */
+    H5FD__core_read_vector,     /* read_vector          */
+    H5FD__core_write_vector     /* write_vector         */
 };
 
 /* Define a free list to manage the region type */
@@ -471,7 +482,7 @@ H5FD_core_init(void)
     FUNC_ENTER_NOAPI(FAIL)
 
     if(H5I_VFL != H5I_get_type(H5FD_CORE_g))
-        H5FD_CORE_g = H5FD_register(&H5FD_core_g, sizeof(H5FD_class_t), FALSE);
+        H5FD_CORE_g = H5FD_register((const H5FD_class_t *)&H5FD_core_g, sizeof(H5FD_class_vector_t), FALSE);
 
     /* Set return value */
     ret_value = H5FD_CORE_g;
@@ -1024,6 +1035,8 @@ H5FD__core_query(const H5FD_t * _file, unsigned long *flags /* out */)
         *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;            /* OK to aggregate "small" raw data allocations                     */
         *flags |= H5FD_FEAT_ALLOW_FILE_IMAGE;               /* OK to use file image feature with this VFD                       */
         *flags |= H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS;   /* OK to use file image callbacks with this VFD                     */
+        *flags |= H5FD_FEAT_CONCURRENT_READ;                /* OK to read raw data without the API lock                         */
+        *flags |= H5FD_FEAT_VECTOR_IO;                      /* OK to hand lists of raw data blocks to the driver at once        */
 
         /* If the backing store is open, a POSIX file handle is available */
         if(file && file->fd >= 0 && file->backing_store)
@@ -1239,6 +1252,59 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_extend
+ *
+ * Purpose:     Grows the memory buffer of FILE so that it holds at least
+ *              END bytes, rounded up to the file's increment.
+ *
+ *              Careful of overflow.  Also, if the allocation fails then
+ *              the file should remain in a usable state.  Be careful of
+ *              non-Posix realloc() that doesn't understand what to do
+ *              when the first argument is null.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_extend(H5FD_core_t *file, haddr_t end)
+{
+    unsigned char *x;
+    size_t new_eof;
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(end > file->eof);
+
+    /* Determine new size of memory buffer */
+    H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * (end / file->increment), hsize_t);
+    if(end % file->increment)
+        new_eof += file->increment;
+
+    /* (Re)allocate memory for the file buffer, using callbacks if available */
+    if(file->fi_callbacks.image_realloc) {
+        if(NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes with callback", (unsigned long long)new_eof)
+    } /* end if */
+    else {
+        if(NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
+    } /* end else */
+
+    HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+    file->mem = x;
+
+    file->eof = new_eof;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_extend() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_write
@@ -1270,36 +1336,10 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     if(REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
 
-    /*
-     * Allocate more memory if necessary, careful of overflow. Also, if the
-     * allocation fails then the file should remain in a usable state.  Be
-     * careful of non-Posix realloc() that doesn't understand what to do when
-     * the first argument is null.
-     */
-    if(addr + size > file->eof) {
-        unsigned char *x;
-        size_t new_eof;
-
-        /* Determine new size of memory buffer */
-        H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * ((addr + size) / file->increment), hsize_t);
-        if((addr + size) % file->increment)
-            new_eof += file->increment;
-
-        /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if(file->fi_callbacks.image_realloc) {
-            if(NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
-                HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes with callback", (unsigned long long)new_eof)
-        } /* end if */
-        else {
-            if(NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
-                HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
-        } /* end else */
-
-        HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
-
-        file->eof = new_eof;
-    } /* end if */
+    /* Allocate more memory if necessary */
+    if(addr + size > file->eof)
+        if(H5FD__core_extend(file, addr + size) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to extend memory buffer")
 
     /* Add the buffer region to the dirty list if using that optimization */
     if(file->dirty_list) {
@@ -1320,6 +1360,141 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_vector
+ *
+ * Purpose:     Reads COUNT blocks of data from FILE, block U being SIZES[U]
+ *              bytes beginning at address ADDRS[U], into the buffers BUFS.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffers BUFS.
+ *              Failure:    FAIL, Contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, size_t count,
+    const H5FD_mem_t H5_ATTR_UNUSED types[], const haddr_t addrs[],
+    const size_t sizes[], void *bufs[]/*out*/)
+{
+    H5FD_core_t	*file = (H5FD_core_t*)_file;
+    size_t      u;                      /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    for(u = 0; u < count; u++) {
+        haddr_t addr = addrs[u];
+        size_t size = sizes[u];
+        unsigned char *buf = (unsigned char *)bufs[u];
+
+        /* Check for overflow conditions */
+        if(HADDR_UNDEF == addr)
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+        if(REGION_OVERFLOW(addr, size))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+
+        /* Copy the part which is before the EOF marker, which is usually
+         * all of it, and zeros for the rest */
+        if(addr + size <= file->eof)
+            HDmemcpy(buf, file->mem + addr, size);
+        else {
+            size_t nbytes = 0;
+
+            if(addr < file->eof) {
+                nbytes = (size_t)(file->eof - addr);
+                HDmemcpy(buf, file->mem + addr, nbytes);
+            } /* end if */
+            HDmemset(buf + nbytes, 0, size - nbytes);
+        } /* end else */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_vector() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_write_vector
+ *
+ * Purpose:     Writes COUNT blocks of data to FILE, block U being SIZES[U]
+ *              bytes from buffer BUFS[U] written beginning at address
+ *              ADDRS[U].
+ *
+ *              The memory buffer is grown at most once for the whole
+ *              list, and blocks which follow each other are added to the
+ *              dirty list as one region.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, size_t count,
+    const H5FD_mem_t H5_ATTR_UNUSED types[], const haddr_t addrs[],
+    const size_t sizes[], const void *bufs[])
+{
+    H5FD_core_t *file = (H5FD_core_t*)_file;
+    haddr_t     end = 0;                /* End of the last byte written */
+    haddr_t     dirty_start = HADDR_UNDEF;      /* Start of pending dirty region */
+    haddr_t     dirty_end = HADDR_UNDEF;        /* End of pending dirty region */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions and find the end of the writes */
+    for(u = 0; u < count; u++) {
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+        end = MAX(end, addrs[u] + sizes[u]);
+    } /* end for */
+
+    /* Allocate more memory if necessary */
+    if(end > file->eof)
+        if(H5FD__core_extend(file, end) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to extend memory buffer")
+
+    for(u = 0; u < count; u++) {
+        if(0 == sizes[u])
+            continue;
+
+        /* Add the buffer regions to the dirty list if using that optimization */
+        if(file->dirty_list) {
+            if(addrs[u] != dirty_end) {
+                if(H5F_addr_defined(dirty_start))
+                    if(H5FD__core_add_dirty_region(file, dirty_start, dirty_end - 1) != SUCCEED)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "unable to add core VFD dirty region during write call - addresses: start=%llu end=%llu", dirty_start, dirty_end - 1)
+                dirty_start = addrs[u];
+            } /* end if */
+            dirty_end = addrs[u] + sizes[u];
+        } /* end if */
+
+        /* Write from BUF to memory */
+        HDmemcpy(file->mem + addrs[u], bufs[u], sizes[u]);
+    } /* end for */
+
+    /* Add the last pending dirty region */
+    if(H5F_addr_defined(dirty_start))
+        if(H5FD__core_add_dirty_region(file, dirty_start, dirty_end - 1) != SUCCEED)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "unable to add core VFD dirty region during write call - addresses: start=%llu end=%llu", dirty_start, dirty_end - 1)
+
+    /* Mark memory buffer as modified */
+    file->dirty = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_flush
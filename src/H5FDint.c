@@ -39,6 +39,7 @@
 #include "H5Fprivate.h"         /* File access				*/
 #include "H5FDpkg.h"		/* File Drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 
 
 /****************/
@@ -199,7 +200,15 @@ H5FD_read(H5FD_t *file, const H5P_genplist_t *dxpl, H5FD_mem_t type, haddr_t add
 
     if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
 	HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
-    if((addr + file->base_addr + size) > eoa)
+
+    /*
+     * If the file is open for SWMR read access, allow access to data past
+     * the end of the allocated space (the 'eoa').  This is done because the
+     * eoa stored in the file's superblock might be out of sync with the
+     * objects being written within the file by the application performing
+     * SWMR write operations.
+     */
+    if(!(file->access_flags & H5F_ACC_SWMR_READ) && ((addr + file->base_addr + size) > eoa))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu", 
                     (unsigned long long)(addr+ file->base_addr), (unsigned long long)size, (unsigned long long)eoa)
 
@@ -279,6 +288,183 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__vector_addrs
+ *
+ * Purpose:	Checks the blocks of a vector read or write against the
+ *		file's EOA and makes their addresses absolute.
+ *
+ *		If the file's base address is zero, *ABS_ADDRS is set to
+ *		NULL and ADDRS are used as they are, otherwise it is set to
+ *		a new array which the caller must free.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__vector_addrs(const H5FD_t *file, hbool_t check_eoa, size_t count,
+    const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+    haddr_t **abs_addrs)
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check each block against the EOA for its type */
+    if(check_eoa)
+        for(u = 0; u < count; u++) {
+            haddr_t eoa;                /* End of allocated space for type */
+
+            if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+            if((addrs[u] + file->base_addr + sizes[u]) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu",
+                            (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u], (unsigned long long)eoa)
+        } /* end for */
+
+    /* Make the addresses absolute */
+    *abs_addrs = NULL;
+    if(file->base_addr > 0) {
+        if(NULL == (*abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address list")
+        for(u = 0; u < count; u++)
+            (*abs_addrs)[u] = addrs[u] + file->base_addr;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__vector_addrs() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_read_vector
+ *
+ * Purpose:	Private version of H5FDread_vector()
+ *
+ *		Drivers that set H5FD_FEAT_VECTOR_IO get the whole list
+ *		of blocks at once through their 'read_vector' callback,
+ *		the others get one 'read' per block.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file, const H5P_genplist_t *dxpl, size_t count,
+    const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+    void *bufs[]/*out*/)
+{
+    haddr_t     *abs_addrs = NULL;      /* Absolute addresses of blocks, if rebased */
+    const haddr_t *io_addrs;            /* Addresses handed to the driver */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file && file->cls);
+    HDassert(TRUE == H5P_class_isa(H5P_CLASS(dxpl), H5P_CLS_DATASET_XFER_g));
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    /* The no-op case */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check the blocks (SWMR readers may read past the EOA, see H5FD_read) */
+    if(H5FD__vector_addrs(file, !(file->access_flags & H5F_ACC_SWMR_READ),
+            count, types, addrs, sizes, &abs_addrs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADRANGE, FAIL, "invalid block in vector read")
+    io_addrs = abs_addrs ? abs_addrs : addrs;
+
+    /* Dispatch to driver */
+    if(file->feature_flags & H5FD_FEAT_VECTOR_IO) {
+        const H5FD_class_vector_t *cls = (const H5FD_class_vector_t *)file->cls;
+
+        if((cls->read_vector)(file, H5P_PLIST_ID(dxpl), count, types, io_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read_vector request failed")
+    } /* end if */
+    else {
+        size_t u;               /* Local index variable */
+
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0)
+                if((file->cls->read)(file, types[u], H5P_PLIST_ID(dxpl), io_addrs[u], sizes[u], bufs[u]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+    } /* end else */
+
+done:
+    H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_write_vector
+ *
+ * Purpose:	Private version of H5FDwrite_vector()
+ *
+ *		Drivers that set H5FD_FEAT_VECTOR_IO get the whole list
+ *		of blocks at once through their 'write_vector' callback,
+ *		the others get one 'write' per block.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file, const H5P_genplist_t *dxpl, size_t count,
+    const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+    const void *bufs[])
+{
+    haddr_t     *abs_addrs = NULL;      /* Absolute addresses of blocks, if rebased */
+    const haddr_t *io_addrs;            /* Addresses handed to the driver */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file && file->cls);
+    HDassert(TRUE == H5P_class_isa(H5P_CLASS(dxpl), H5P_CLS_DATASET_XFER_g));
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    /* The no-op case */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check the blocks */
+    if(H5FD__vector_addrs(file, TRUE, count, types, addrs, sizes, &abs_addrs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADRANGE, FAIL, "invalid block in vector write")
+    io_addrs = abs_addrs ? abs_addrs : addrs;
+
+    /* Dispatch to driver */
+    if(file->feature_flags & H5FD_FEAT_VECTOR_IO) {
+        const H5FD_class_vector_t *cls = (const H5FD_class_vector_t *)file->cls;
+
+        if((cls->write_vector)(file, H5P_PLIST_ID(dxpl), count, types, io_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write_vector request failed")
+    } /* end if */
+    else {
+        size_t u;               /* Local index variable */
+
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0)
+                if((file->cls->write)(file, types[u], H5P_PLIST_ID(dxpl), io_addrs[u], sizes[u], bufs[u]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+    } /* end else */
+
+done:
+    H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_set_eoa
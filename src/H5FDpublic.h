@@ -234,6 +234,23 @@ typedef enum H5F_mem_t	H5FD_mem_t;
      * image to store in memory.
      */
 #define H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS 0x00000800
+    /*
+     * Defining H5FD_FEAT_CONCURRENT_READ for a VFL driver means that the
+     * driver's 'read' callback never calls back into the HDF5 API, so the
+     * library may issue raw data reads on a read-only file without holding
+     * the thread-safe API lock.  Reads of a single file are still
+     * serialized with each other.
+     */
+#define H5FD_FEAT_CONCURRENT_READ       0x00001000
+    /*
+     * Defining H5FD_FEAT_VECTOR_IO for a VFL driver means that the driver
+     * has 'read_vector' and 'write_vector' callbacks which are cheaper than
+     * a 'read' or 'write' call per block, so the library should gather
+     * lists of raw data blocks and hand them to the driver in one call.
+     * The driver must be registered with H5FDregister_vector(), since the
+     * callbacks are only looked for when this flag is set.
+     */
+#define H5FD_FEAT_VECTOR_IO             0x00002000
 
 /* Forward declaration */
 typedef struct H5FD_t H5FD_t;
@@ -279,6 +296,18 @@ typedef struct H5FD_class_t {
     H5FD_mem_t fl_map[H5FD_MEM_NTYPES];
 } H5FD_class_t;
 
+/* Class information for file drivers with vector I/O callbacks (drivers
+ * which set H5FD_FEAT_VECTOR_IO) */
+typedef struct H5FD_class_vector_t {
+    H5FD_class_t        super;          /* Superclass information & methods */
+    herr_t  (*read_vector)(H5FD_t *file, hid_t dxpl, size_t count,
+                    const H5FD_mem_t types[], const haddr_t addrs[],
+                    const size_t sizes[], void *bufs[]);
+    herr_t  (*write_vector)(H5FD_t *file, hid_t dxpl, size_t count,
+                    const H5FD_mem_t types[], const haddr_t addrs[],
+                    const size_t sizes[], const void *bufs[]);
+} H5FD_class_vector_t;
+
 /* A free list is a singly-linked list of address/size pairs. */
 typedef struct H5FD_free_t {
     haddr_t		addr;
@@ -295,6 +324,7 @@ struct H5FD_t {
     const H5FD_class_t *cls;            /*constant class info       */
     unsigned long       fileno;         /* File 'serial' number     */
     unsigned long       feature_flags;  /* VFL Driver feature Flags */
+    unsigned            access_flags;   /* File access flags (from create or open) */
     haddr_t             maxaddr;        /* For this file, overrides class */
     haddr_t             base_addr;      /* Base address for HDF5 data w/in file */
 
@@ -336,6 +366,7 @@ extern "C" {
 
 /* Function prototypes */
 H5_DLL hid_t H5FDregister(const H5FD_class_t *cls);
+H5_DLL hid_t H5FDregister_vector(const H5FD_class_vector_t *cls);
 H5_DLL herr_t H5FDunregister(hid_t driver_id);
 H5_DLL H5FD_t *H5FDopen(const char *name, unsigned flags, hid_t fapl_id,
                         haddr_t maxaddr);
@@ -353,6 +384,12 @@ H5_DLL herr_t H5FDread(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                        haddr_t addr, size_t size, void *buf/*out*/);
 H5_DLL herr_t H5FDwrite(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                         haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5FDread_vector(H5FD_t *file, hid_t dxpl_id, size_t count,
+                       const H5FD_mem_t types[], const haddr_t addrs[],
+                       const size_t sizes[], void *bufs[]/*out*/);
+H5_DLL herr_t H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, size_t count,
+                       const H5FD_mem_t types[], const haddr_t addrs[],
+                       const size_t sizes[], const void *bufs[]);
 H5_DLL herr_t H5FDflush(H5FD_t *file, hid_t dxpl_id, unsigned closing);
 H5_DLL herr_t H5FDtruncate(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDlock(H5FD_t *file, hbool_t rw);
@@ -122,6 +122,18 @@ typedef struct H5FD_sec2_t {
                                  HADDR_UNDEF==(A)+(Z) ||                    \
                                 (HDoff_t)((A)+(Z))<(HDoff_t)(A))
 
+/* Most blocks passed to one preadv() or pwritev() call */
+#ifdef IOV_MAX
+#define H5FD_SEC2_MAX_IOV   IOV_MAX
+#else
+#define H5FD_SEC2_MAX_IOV   1024
+#endif
+
+/* Largest hole between two blocks of a vector read that is read into a
+ * scratch buffer and thrown away, instead of starting another preadv()
+ */
+#define H5FD_SEC2_MAX_GAP   4096
+
 /* Prototypes */
 static herr_t H5FD_sec2_term(void);
 static H5FD_t *H5FD_sec2_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -137,11 +149,18 @@ static herr_t H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, hadd
             size_t size, void *buf);
 static herr_t H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD_sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, size_t count,
+            const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+            void *bufs[]);
+static herr_t H5FD_sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, size_t count,
+            const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+            const void *bufs[]);
 static herr_t H5FD_sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_sec2_unlock(H5FD_t *_file);
 
-static const H5FD_class_t H5FD_sec2_g = {
+static const H5FD_class_vector_t H5FD_sec2_g = {
+    {   /* Start of superclass information */
     "sec2",                     /* name                 */
     MAXADDR,                    /* maxaddr              */
     H5F_CLOSE_WEAK,             /* fc_degree            */
@@ -174,6 +193,9 @@ static const H5FD_class_t H5FD_sec2_g = {
     H5FD_sec2_lock,             /* lock                 */
     H5FD_sec2_unlock,           /* unlock               */
     H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    },  /* End of superclass information */
+    H5FD_sec2_read_vector,      /* read_vector          */
+    H5FD_sec2_write_vector      /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_sec2_t struct */
@@ -226,7 +248,7 @@ H5FD_sec2_init(void)
     FUNC_ENTER_NOAPI(FAIL)
 
     if(H5I_VFL != H5I_get_type(H5FD_SEC2_g))
-        H5FD_SEC2_g = H5FD_register(&H5FD_sec2_g, sizeof(H5FD_class_t), FALSE);
+        H5FD_SEC2_g = H5FD_register((const H5FD_class_t *)&H5FD_sec2_g, sizeof(H5FD_class_vector_t), FALSE);
 
     /* Set return value */
     ret_value = H5FD_SEC2_g;
@@ -530,6 +552,10 @@ H5FD_sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
         *flags |= H5FD_FEAT_DATA_SIEVE;             /* OK to perform data sieving for faster raw data reads & writes    */
         *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
         *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* VFD handle is POSIX I/O call compatible                          */
+        *flags |= H5FD_FEAT_CONCURRENT_READ;        /* OK to read raw data without the API lock                         */
+#if defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV)
+        *flags |= H5FD_FEAT_VECTOR_IO;              /* OK to hand lists of raw data blocks to the driver at once        */
+#endif /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
 
         /* Check for flags that are set by h5repart */
         if(file && file->fam_to_sec2)
@@ -835,6 +861,308 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_write() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_read_vector
+ *
+ * Purpose:     Reads COUNT blocks of data from FILE, block U being SIZES[U]
+ *              bytes beginning at address ADDRS[U], into the buffers BUFS.
+ *
+ *              Runs of blocks which follow each other in the file, with
+ *              holes of no more than H5FD_SEC2_MAX_GAP bytes between them,
+ *              are read with a single preadv() call.  Holes are read into
+ *              a scratch buffer and discarded.  Without preadv() each
+ *              block is read with H5FD_sec2_read().
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffers BUFS.
+ *              Failure:    FAIL, Contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, size_t count,
+    const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+    void *bufs[] /*out*/)
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+#ifdef H5_HAVE_PREADV
+    struct iovec    iov[H5FD_SEC2_MAX_IOV];         /* I/O vector for one run of blocks */
+    unsigned char   gap_buf[H5FD_SEC2_MAX_GAP];     /* Scratch space for holes between blocks */
+#endif /* H5_HAVE_PREADV */
+    size_t          u = 0;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    while(u < count) {
+#ifdef H5_HAVE_PREADV
+        struct iovec    *curr_iov = iov;    /* First unfinished part of the run */
+        int             niov = 0;           /* # of parts in the run */
+        haddr_t         addr;               /* Current file address of the run */
+        haddr_t         run_end;            /* End of the last block in the run */
+        size_t          run_size;           /* # of bytes in the run */
+
+        /* Skip empty blocks */
+        if(0 == sizes[u]) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Blocks too large for one system call are read on their own */
+        if(sizes[u] > H5_POSIX_MAX_IO_BYTES) {
+            if(H5FD_sec2_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+            u++;
+            continue;
+        } /* end if */
+
+        /* Check for overflow conditions */
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addrs[u])
+
+        /* Start a new run with this block */
+        addr = addrs[u];
+        run_end = addrs[u] + sizes[u];
+        run_size = sizes[u];
+        iov[niov].iov_base = bufs[u];
+        iov[niov].iov_len = sizes[u];
+        niov++;
+        u++;
+
+        /* Add the following blocks which are close enough */
+        while(u < count && niov < (H5FD_SEC2_MAX_IOV - 1)) {
+            size_t gap;             /* Size of the hole before the block */
+
+            if(0 == sizes[u]) {
+                u++;
+                continue;
+            } /* end if */
+            if(addrs[u] < run_end || (addrs[u] - run_end) > H5FD_SEC2_MAX_GAP)
+                break;
+            gap = (size_t)(addrs[u] - run_end);
+            if(sizes[u] > ((size_t)H5_POSIX_MAX_IO_BYTES - run_size - gap)
+                    || REGION_OVERFLOW(addrs[u], sizes[u]))
+                break;
+
+            if(gap > 0) {
+                iov[niov].iov_base = gap_buf;
+                iov[niov].iov_len = gap;
+                niov++;
+            } /* end if */
+            iov[niov].iov_base = bufs[u];
+            iov[niov].iov_len = sizes[u];
+            niov++;
+            run_end = addrs[u] + sizes[u];
+            run_size += gap + sizes[u];
+            u++;
+        } /* end while */
+
+        /* Read the run, being careful of interrupted system calls, partial
+         * results, and the end of the file.
+         */
+        while(niov > 0) {
+            h5_posix_io_ret_t   bytes_read = -1;    /* # of bytes actually read */
+
+            do {
+                bytes_read = HDpreadv(file->fd, curr_iov, niov, (HDoff_t)addr);
+            } while(-1 == bytes_read && EINTR == errno);
+
+            if(-1 == bytes_read) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', # of buffers = %d, total read size = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), niov, (unsigned long long)run_size, (unsigned long long)addr);
+            } /* end if */
+
+            if(0 == bytes_read) {
+                /* end of file but not end of format address space */
+                while(niov > 0) {
+                    HDmemset(curr_iov->iov_base, 0, curr_iov->iov_len);
+                    curr_iov++;
+                    niov--;
+                } /* end while */
+                break;
+            } /* end if */
+
+            HDassert((size_t)bytes_read <= run_size);
+            run_size -= (size_t)bytes_read;
+            addr += (haddr_t)bytes_read;
+
+            /* Skip over the parts of the run that are done */
+            while(niov > 0 && (size_t)bytes_read >= curr_iov->iov_len) {
+                bytes_read -= (h5_posix_io_ret_t)curr_iov->iov_len;
+                curr_iov++;
+                niov--;
+            } /* end while */
+            if(bytes_read > 0) {
+                curr_iov->iov_base = (char *)curr_iov->iov_base + bytes_read;
+                curr_iov->iov_len -= (size_t)bytes_read;
+            } /* end if */
+        } /* end while */
+#else /* H5_HAVE_PREADV */
+        if(sizes[u] > 0)
+            if(H5FD_sec2_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+        u++;
+#endif /* H5_HAVE_PREADV */
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_read_vector() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_write_vector
+ *
+ * Purpose:     Writes COUNT blocks of data to FILE, block U being SIZES[U]
+ *              bytes from buffer BUFS[U] written beginning at address
+ *              ADDRS[U].
+ *
+ *              Runs of blocks which follow each other in the file with no
+ *              holes between them are written with a single pwritev()
+ *              call.  Without pwritev() each block is written with
+ *              H5FD_sec2_write().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, size_t count,
+    const H5FD_mem_t types[], const haddr_t addrs[], const size_t sizes[],
+    const void *bufs[])
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+#ifdef H5_HAVE_PWRITEV
+    struct iovec    iov[H5FD_SEC2_MAX_IOV];         /* I/O vector for one run of blocks */
+#endif /* H5_HAVE_PWRITEV */
+    size_t          u = 0;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    while(u < count) {
+#ifdef H5_HAVE_PWRITEV
+        struct iovec    *curr_iov = iov;    /* First unfinished part of the run */
+        int             niov = 0;           /* # of blocks in the run */
+        haddr_t         addr;               /* Current file address of the run */
+        haddr_t         run_end;            /* End of the last block in the run */
+        size_t          run_size;           /* # of bytes in the run */
+
+        /* Skip empty blocks */
+        if(0 == sizes[u]) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Blocks too large for one system call are written on their own */
+        if(sizes[u] > H5_POSIX_MAX_IO_BYTES) {
+            if(H5FD_sec2_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+            u++;
+            continue;
+        } /* end if */
+
+        /* Check for overflow conditions */
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+
+        /* Start a new run with this block */
+        addr = addrs[u];
+        run_end = addrs[u] + sizes[u];
+        run_size = sizes[u];
+        /* (Casting away const OK) */
+H5_GCC_DIAG_OFF(cast-qual)
+        iov[niov].iov_base = (void *)bufs[u];
+H5_GCC_DIAG_ON(cast-qual)
+        iov[niov].iov_len = sizes[u];
+        niov++;
+        u++;
+
+        /* Add the following blocks which start where the run ends */
+        while(u < count && niov < H5FD_SEC2_MAX_IOV) {
+            if(0 == sizes[u]) {
+                u++;
+                continue;
+            } /* end if */
+            if(addrs[u] != run_end || sizes[u] > ((size_t)H5_POSIX_MAX_IO_BYTES - run_size)
+                    || REGION_OVERFLOW(addrs[u], sizes[u]))
+                break;
+
+            /* (Casting away const OK) */
+H5_GCC_DIAG_OFF(cast-qual)
+            iov[niov].iov_base = (void *)bufs[u];
+H5_GCC_DIAG_ON(cast-qual)
+            iov[niov].iov_len = sizes[u];
+            niov++;
+            run_end += sizes[u];
+            run_size += sizes[u];
+            u++;
+        } /* end while */
+
+        /* Write the run, being careful of interrupted system calls and
+         * partial results
+         */
+        while(niov > 0) {
+            h5_posix_io_ret_t   bytes_wrote = -1;   /* # of bytes written */
+
+            do {
+                bytes_wrote = HDpwritev(file->fd, curr_iov, niov, (HDoff_t)addr);
+            } while(-1 == bytes_wrote && EINTR == errno);
+
+            if(-1 == bytes_wrote) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', # of buffers = %d, total write size = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), niov, (unsigned long long)run_size, (unsigned long long)addr);
+            } /* end if */
+
+            HDassert(bytes_wrote > 0);
+            HDassert((size_t)bytes_wrote <= run_size);
+            run_size -= (size_t)bytes_wrote;
+            addr += (haddr_t)bytes_wrote;
+
+            /* Skip over the blocks that are done */
+            while(niov > 0 && (size_t)bytes_wrote >= curr_iov->iov_len) {
+                bytes_wrote -= (h5_posix_io_ret_t)curr_iov->iov_len;
+                curr_iov++;
+                niov--;
+            } /* end while */
+            if(bytes_wrote > 0) {
+                curr_iov->iov_base = (char *)curr_iov->iov_base + bytes_wrote;
+                curr_iov->iov_len -= (size_t)bytes_wrote;
+            } /* end if */
+        } /* end while */
+
+        /* Update eof */
+        if(run_end > file->eof)
+            file->eof = run_end;
+#else /* H5_HAVE_PWRITEV */
+        if(sizes[u] > 0)
+            if(H5FD_sec2_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+        u++;
+#endif /* H5_HAVE_PWRITEV */
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_sec2_truncate
@@ -39,6 +39,7 @@
 #include "H5Fpkg.h"             /* File access				*/
 #include "H5FDprivate.h"	/* File drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"		/* Memory management			*/
 
 
 /****************/
@@ -60,6 +61,9 @@
 /* Local Prototypes */
 /********************/
 
+static herr_t H5F__accum_vector_sync(const H5F_io_info_t *fio_info,
+    size_t count, const haddr_t addrs[], const size_t sizes[]);
+
 
 /*********************/
 /* Package Variables */
@@ -76,6 +80,49 @@
 /*******************/
 
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_vector_sync
+ *
+ * Purpose:	Makes the metadata accumulator coherent with a list of raw
+ *		data blocks about to be handed to the driver directly.  If
+ *		any block overlaps the accumulated region, the accumulator
+ *		is flushed (when dirty) and emptied, so that a vector read
+ *		sees data still held in it and a vector write is not later
+ *		overwritten by a stale copy.
+ *
+ *		The caller must hold the file's I/O lock.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_vector_sync(const H5F_io_info_t *fio_info, size_t count,
+    const haddr_t addrs[], const size_t sizes[])
+{
+    const H5F_meta_accum_t *accum;      /* Metadata accumulator */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+
+    accum = &fio_info->f->shared->accum;
+    if((fio_info->f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && accum->size > 0)
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0 && H5F_addr_overlap(addrs[u], sizes[u], accum->loc, accum->size)) {
+                if(H5F__accum_reset(fio_info, TRUE) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset metadata accumulator")
+                break;
+            } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_vector_sync() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_block_read
@@ -99,6 +146,7 @@ H5F_block_read(const H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
     H5F_io_info_t fio_info;             /* I/O info for operation */
     H5FD_mem_t  map_type;               /* Mapped memory type */
     hid_t       my_dxpl_id = dxpl_id;   /* transfer property to use for I/O */
+    herr_t      status;                 /* Status from I/O operation */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -130,13 +178,183 @@ HDfprintf(stderr, "%s: read from addr = %a, size = %Zu\n", FUNC, addr, size);
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
 
     /* Pass through metadata accumulator layer */
-    if(H5F__accum_read(&fio_info, map_type, addr, size, buf) < 0)
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_lock_simple(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
+    status = H5F__accum_read(&fio_info, map_type, addr, size, buf);
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_unlock_simple(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
+    if(status < 0)
         HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through metadata accumulator failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_read() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_read_concurrent
+ *
+ * Purpose:	Reads raw data from a file into a buffer that no other
+ *		thread can see, such as a chunk being loaded into the
+ *		chunk cache.
+ *
+ *		In thread-safe builds, when the file is open read-only,
+ *		has no page buffer and its driver sets
+ *		H5FD_FEAT_CONCURRENT_READ, the API lock is released around
+ *		the driver's read callback so that threads reading other
+ *		files can make progress at the same time.  All checks on
+ *		the request are made before the lock is given up, and a
+ *		failed read is only reported once it is taken back.  The
+ *		file's I/O lock is taken before the API lock is given up
+ *		and released before it is taken back, so a thread waiting
+ *		for the I/O lock never holds it while waiting for the API
+ *		lock.  The caller must keep the file and any object being
+ *		read open across the call (see H5D__read_hold).  Otherwise
+ *		this is the same as H5F_block_read.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_read_concurrent(const H5F_t *f, haddr_t addr, size_t size,
+    hid_t dxpl_id, void *buf/*out*/)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(buf);
+    HDassert(H5F_addr_defined(addr));
+
+#ifdef H5_HAVE_THREADSAFE
+    if(!(H5F_INTENT(f) & H5F_ACC_RDWR) && NULL == f->shared->page_buf
+            && H5F_HAS_FEATURE(f, H5FD_FEAT_CONCURRENT_READ)) {
+        H5FD_t  *lf = f->shared->lf;    /* File driver */
+        haddr_t eoa;                    /* End of allocated space */
+        unsigned lock_count;            /* Depth of the API lock given up */
+        herr_t  status;                 /* Status from driver read */
+
+        /* Check for attempting I/O on 'temporary' file address */
+        if(H5F_addr_le(f->shared->tmp_addr, (addr + size)))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+        /* Make the checks H5FD_read would, while errors can be pushed */
+        if(0 == size)
+            HGOTO_DONE(SUCCEED)
+        if(HADDR_UNDEF == (eoa = H5FD_get_eoa(lf, H5FD_MEM_DRAW)))
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+        if(!(H5F_INTENT(f) & H5F_ACC_SWMR_READ) && H5F_addr_gt((addr + size), eoa))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)addr, (unsigned long long)size, (unsigned long long)eoa)
+
+        /* Raw data bypasses the (clean) metadata accumulator of a
+         * read-only file, so go straight to the driver.  Only the read
+         * callback itself runs without the API lock; any error it tries
+         * to push meanwhile is dropped (see H5TS_api_unlocked).
+         */
+        H5TS_mutex_lock_simple(&f->shared->io_lock);
+        H5TS_mutex_release(&H5_g.init_lock, &lock_count);
+        status = (lf->cls->read)(lf, H5FD_MEM_DRAW, dxpl_id, addr + lf->base_addr, size, buf);
+        H5TS_mutex_unlock_simple(&f->shared->io_lock);
+        H5TS_mutex_reacquire(&H5_g.init_lock, lock_count);
+
+        if(status < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
+    } /* end if */
+    else
+#endif /* H5_HAVE_THREADSAFE */
+    if(H5F_block_read(f, H5FD_MEM_DRAW, addr, size, dxpl_id, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_read_concurrent() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_read_vector
+ *
+ * Purpose:	Reads COUNT blocks of raw data from a file, block U being
+ *		SIZES[U] bytes at address ADDRS[U] (relative to the base
+ *		address for the file), into the buffers BUFS.
+ *
+ *		When the file's driver sets H5FD_FEAT_VECTOR_IO and the
+ *		file has no page buffer, the whole list is handed to the
+ *		driver at once, after flushing and emptying the metadata
+ *		accumulator if it overlaps any block.  Otherwise each block
+ *		is read with H5F_block_read_concurrent.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_read_vector(const H5F_t *f, size_t count, const haddr_t addrs[],
+    const size_t sizes[], hid_t dxpl_id, void *bufs[]/*out*/)
+{
+    H5FD_mem_t  *types = NULL;          /* Memory types of blocks */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    if(NULL == f->shared->page_buf && H5F_HAS_FEATURE(f, H5FD_FEAT_VECTOR_IO)) {
+        H5F_io_info_t fio_info;         /* I/O info for operation */
+        herr_t  status;                 /* Status from driver read */
+
+        /* Check for attempting I/O on 'temporary' file address */
+        for(u = 0; u < count; u++) {
+            HDassert(H5F_addr_defined(addrs[u]));
+            if(H5F_addr_le(f->shared->tmp_addr, (addrs[u] + sizes[u])))
+                HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+        } /* end for */
+
+        /* Set up I/O info for operation */
+        fio_info.f = f;
+        if(NULL == (fio_info.dxpl = (H5P_genplist_t *)H5I_object(dxpl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
+
+        /* All blocks are raw data */
+        if(NULL == (types = (H5FD_mem_t *)H5MM_malloc(count * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate memory type list")
+        for(u = 0; u < count; u++)
+            types[u] = H5FD_MEM_DRAW;
+
+        /* Give the driver the whole list, after making sure that no
+         * block is held in the metadata accumulator */
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_lock_simple(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
+        if((status = H5F__accum_vector_sync(&fio_info, count, addrs, sizes)) >= 0)
+            status = H5FD_read_vector(f->shared->lf, fio_info.dxpl, count, types, addrs, sizes, bufs);
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_unlock_simple(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
+        if(status < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver vector read request failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0)
+                if(H5F_block_read_concurrent(f, addrs[u], sizes[u], dxpl_id, bufs[u]) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    H5MM_xfree(types);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_read_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_block_write
@@ -160,6 +378,7 @@ H5F_block_write(const H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
     H5F_io_info_t fio_info;             /* I/O info for operation */
     H5FD_mem_t  map_type;               /* Mapped memory type */
     hid_t       my_dxpl_id = dxpl_id;   /* transfer property to use for I/O */
+    herr_t      status;                 /* Status from I/O operation */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -192,10 +411,98 @@ HDfprintf(stderr, "%s: write to addr = %a, size = %Zu\n", FUNC, addr, size);
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
 
     /* Pass through metadata accumulator layer */
-    if(H5F__accum_write(&fio_info, map_type, addr, size, buf) < 0)
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_lock_simple(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
+    status = H5F__accum_write(&fio_info, map_type, addr, size, buf);
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_unlock_simple(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
+    if(status < 0)
         HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through metadata accumulator failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_write_vector
+ *
+ * Purpose:	Writes COUNT blocks of raw data to a file, block U being
+ *		SIZES[U] bytes from BUFS[U] written at address ADDRS[U]
+ *		(relative to the base address for the file).
+ *
+ *		When the file's driver sets H5FD_FEAT_VECTOR_IO and the
+ *		file has no page buffer, the whole list is handed to the
+ *		driver at once, after flushing and emptying the metadata
+ *		accumulator if it overlaps any block.  Otherwise each block
+ *		is written with H5F_block_write.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_write_vector(const H5F_t *f, size_t count, const haddr_t addrs[],
+    const size_t sizes[], hid_t dxpl_id, const void *bufs[])
+{
+    H5FD_mem_t  *types = NULL;          /* Memory types of blocks */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(H5F_INTENT(f) & H5F_ACC_RDWR);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    if(NULL == f->shared->page_buf && H5F_HAS_FEATURE(f, H5FD_FEAT_VECTOR_IO)) {
+        H5F_io_info_t fio_info;         /* I/O info for operation */
+        herr_t  status;                 /* Status from driver write */
+
+        /* Check for attempting I/O on 'temporary' file address */
+        for(u = 0; u < count; u++) {
+            HDassert(H5F_addr_defined(addrs[u]));
+            if(H5F_addr_le(f->shared->tmp_addr, (addrs[u] + sizes[u])))
+                HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+        } /* end for */
+
+        /* Set up I/O info for operation */
+        fio_info.f = f;
+        if(NULL == (fio_info.dxpl = (H5P_genplist_t *)H5I_object(dxpl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
+
+        /* All blocks are raw data */
+        if(NULL == (types = (H5FD_mem_t *)H5MM_malloc(count * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate memory type list")
+        for(u = 0; u < count; u++)
+            types[u] = H5FD_MEM_DRAW;
+
+        /* Give the driver the whole list, after making sure that no
+         * block is held in the metadata accumulator */
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_lock_simple(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
+        if((status = H5F__accum_vector_sync(&fio_info, count, addrs, sizes)) >= 0)
+            status = H5FD_write_vector(f->shared->lf, fio_info.dxpl, count, types, addrs, sizes, bufs);
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_unlock_simple(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
+        if(status < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "driver vector write request failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0)
+                if(H5F_block_write(f, H5FD_MEM_DRAW, addrs[u], sizes[u], dxpl_id, bufs[u]) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+
+done:
+    H5MM_xfree(types);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_write_vector() */
+
@@ -220,6 +220,10 @@ H5F_mount(H5G_loc_t *loc, const char *name, H5F_t *child,
     if(H5G_mount(parent->shared->mtab.child[md].group) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEOBJ, FAIL, "unable to set group mounted flag")
 
+    /* Paths cached in the parent may now lead through the mount point */
+    if(H5G_path_cache_invalidate(parent) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRESET, FAIL, "unable to invalidate path cache")
+
     /* Get the group location for the root group in the file to unmount */
     if(NULL == (root_loc.oloc = H5G_oloc(child->shared->root_grp)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to get object location for root group")
@@ -42,6 +42,8 @@
 #include "H5FSprivate.h"	/* File free space                      */
 #include "H5Gprivate.h"		/* Groups 			  	*/
 #include "H5Oprivate.h"         /* Object header messages               */
+#include "H5PBprivate.h"	/* Page buffer				*/
+#include "H5SLprivate.h"	/* Skip lists				*/
 #include "H5UCprivate.h"	/* Reference counted object functions	*/
 
 
@@ -59,7 +61,7 @@
 #define H5F_SUPER_ALL_FLAGS             (H5F_SUPER_WRITE_ACCESS | H5F_SUPER_FILE_OK)
 
 /* Mask for removing private file access flags */
-#define H5F_ACC_PUBLIC_FLAGS 	        0x001fu
+#define H5F_ACC_PUBLIC_FLAGS 	        0x007fu
 
 /* Free space section+aggregator merge flags */
 #define H5F_FS_MERGE_METADATA           0x01    /* Section can merge with metadata aggregator */
@@ -265,6 +267,10 @@ struct H5F_file_t {
     size_t	rdcc_nbytes;	/* Size of raw data chunk cache	(bytes)	*/
     double	rdcc_w0;	/* Preempt read chunks first? [0.0..1.0]*/
     size_t      sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
+    size_t      page_buf_size;  /* Size of the page buffer (0 if not buffering) */
+    size_t      page_buf_page_size;     /* Size of each page in the page buffer */
+    unsigned    page_buf_min_meta_perc; /* Percentage of page buffer reserved for metadata */
+    unsigned    page_buf_min_raw_perc;  /* Percentage of page buffer reserved for raw data */
     hsize_t	threshold;	/* Threshold for alignment		*/
     hsize_t	alignment;	/* Alignment				*/
     unsigned	gc_ref;		/* Garbage-collect references?		*/
@@ -275,6 +281,7 @@ struct H5F_file_t {
     struct H5G_t *root_grp;	/* Open root group			*/
     H5FO_t *open_objs;          /* Open objects in file                 */
     H5UC_t *grp_btree_shared;   /* Ref-counted group B-tree node info   */
+    H5SL_t *grp_path_cache;     /* Group path prefix -> address cache   */
 
     /* File space allocation information */
     H5F_file_space_type_t fs_strategy;	/* File space handling strategy		*/
@@ -293,6 +300,15 @@ struct H5F_file_t {
 
     /* Metadata accumulator information */
     H5F_meta_accum_t accum;     /* Metadata accumulator info           	*/
+
+    /* Page buffer information */
+    H5PB_t *page_buf;           /* Page buffer (NULL if not buffering)  */
+
+#ifdef H5_HAVE_THREADSAFE
+    /* Serializes calls into the file driver, which may be made without */
+    /* the API lock held (see H5F_block_read_concurrent) */
+    H5TS_mutex_simple_t io_lock;
+#endif /* H5_HAVE_THREADSAFE */
 };
 
 /*
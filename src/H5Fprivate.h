@@ -313,6 +313,8 @@
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL)    ((F)->shared->store_msg_crt_idx = (FL))
 #define H5F_GRP_BTREE_SHARED(F) ((F)->shared->grp_btree_shared)
 #define H5F_SET_GRP_BTREE_SHARED(F, RC) (((F)->shared->grp_btree_shared = (RC)) ? SUCCEED : FAIL)
+#define H5F_GRP_PATH_CACHE(F)   ((F)->shared->grp_path_cache)
+#define H5F_SET_GRP_PATH_CACHE(F, PC) ((F)->shared->grp_path_cache = (PC), SUCCEED)
 #define H5F_USE_TMP_SPACE(F)    ((F)->shared->use_tmp_space)
 #define H5F_IS_TMP_ADDR(F, ADDR) (H5F_addr_le((F)->shared->tmp_addr, (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -358,6 +360,8 @@
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL)    (H5F_set_store_msg_crt_idx((F), (FL)))
 #define H5F_GRP_BTREE_SHARED(F) (H5F_grp_btree_shared(F))
 #define H5F_SET_GRP_BTREE_SHARED(F, RC) (H5F_set_grp_btree_shared((F), (RC)))
+#define H5F_GRP_PATH_CACHE(F)   (H5F_grp_path_cache(F))
+#define H5F_SET_GRP_PATH_CACHE(F, PC) (H5F_set_grp_path_cache((F), (PC)))
 #define H5F_USE_TMP_SPACE(F)    (H5F_use_tmp_space(F))
 #define H5F_IS_TMP_ADDR(F, ADDR) (H5F_is_tmp_addr((F), (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -464,6 +468,10 @@
 #define H5F_ACS_CORE_WRITE_TRACKING_FLAG_NAME       "core_write_tracking_flag" /* Whether or not core VFD backing store write tracking is enabled */
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME  "core_write_tracking_page_size" /* The page size in kiB when core VFD write tracking is enabled */
 #define H5F_ACS_COLL_MD_WRITE_FLAG_NAME         "collective_metadata_write" /* property indicating whether metadata writes are done collectively or not */
+#define H5F_ACS_PAGE_BUFFER_SIZE_NAME           "page_buffer_size" /* the maximum size for the page buffer cache */
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME  "page_buffer_min_meta_perc" /* the min metadata percentage for the page buffer cache */
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME   "page_buffer_min_raw_perc" /* the min raw data percentage for the page buffer cache */
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME      "page_buffer_page_size" /* the size of each page in the page buffer cache */
 
 /* ======================== File Mount properties ====================*/
 #define H5F_MNT_SYM_LOCAL_NAME 		"local"                 /* Whether absolute symlinks local to file. */
@@ -504,6 +512,17 @@
 /* Default free space section threshold used by free-space managers */
 #define H5F_FREE_SPACE_THRESHOLD_DEF	        1
 
+/* Number of times a SWMR reader tries to load a piece of metadata before
+ * giving up (the writer may be part way through flushing it)
+ */
+#define H5F_SWMR_METADATA_READ_ATTEMPTS         100
+
+/* Initial and maximum time (in nanoseconds) a SWMR reader waits between
+ * attempts to load a piece of metadata.  The wait doubles after each attempt.
+ */
+#define H5F_SWMR_METADATA_RETRY_SLEEP_MIN       ((uint64_t)1000)
+#define H5F_SWMR_METADATA_RETRY_SLEEP_MAX       ((uint64_t)10000000)
+
 /* Macros to define signatures of all objects in the file */
 
 /* Size of signature information (on disk) */
@@ -562,6 +581,7 @@
 /* Forward declarations (for prototypes & type definitions) */
 struct H5B_class_t;
 struct H5UC_t;
+struct H5SL_t;
 struct H5O_loc_t;
 struct H5HG_heap_t;
 struct H5P_genplist_t;
@@ -646,6 +666,8 @@ H5_DLL hbool_t H5F_store_msg_crt_idx(const H5F_t *f);
 H5_DLL herr_t H5F_set_store_msg_crt_idx(H5F_t *f, hbool_t flag);
 H5_DLL struct H5UC_t *H5F_grp_btree_shared(const H5F_t *f);
 H5_DLL herr_t H5F_set_grp_btree_shared(H5F_t *f, struct H5UC_t *rc);
+H5_DLL struct H5SL_t *H5F_grp_path_cache(const H5F_t *f);
+H5_DLL herr_t H5F_set_grp_path_cache(H5F_t *f, struct H5SL_t *pc);
 H5_DLL hbool_t H5F_use_tmp_space(const H5F_t *f);
 H5_DLL hbool_t H5F_is_tmp_addr(const H5F_t *f, haddr_t addr);
 #ifdef H5_HAVE_PARALLEL
@@ -669,8 +691,16 @@ H5_DLL herr_t H5F_flush_mounts(H5F_t *f, hid_t dxpl_id);
 /* Functions that operate on blocks of bytes wrt super block */
 H5_DLL herr_t H5F_block_read(const H5F_t *f, H5FD_mem_t type, haddr_t addr,
                 size_t size, hid_t dxpl_id, void *buf/*out*/);
+H5_DLL herr_t H5F_block_read_concurrent(const H5F_t *f, haddr_t addr,
+                size_t size, hid_t dxpl_id, void *buf/*out*/);
 H5_DLL herr_t H5F_block_write(const H5F_t *f, H5FD_mem_t type, haddr_t addr,
                 size_t size, hid_t dxpl_id, const void *buf);
+H5_DLL herr_t H5F_block_read_vector(const H5F_t *f, size_t count,
+                const haddr_t addrs[], const size_t sizes[], hid_t dxpl_id,
+                void *bufs[]/*out*/);
+H5_DLL herr_t H5F_block_write_vector(const H5F_t *f, size_t count,
+                const haddr_t addrs[], const size_t sizes[], hid_t dxpl_id,
+                const void *bufs[]);
 
 /* Address-related functions */
 H5_DLL void H5F_addr_encode(const H5F_t *f, uint8_t **pp, haddr_t addr);
@@ -715,6 +715,31 @@ H5F_grp_btree_shared(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->grp_btree_shared)
 } /* end H5F_grp_btree_shared() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_grp_path_cache
+ *
+ * Purpose:	Retrieve the group path prefix cache for the file.
+ *
+ * Return:	Success:	The path cache (NULL if none has been
+ *                              built yet).
+ *
+ * 		Failure:	(should not happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5SL_t *
+H5F_grp_path_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->grp_path_cache)
+} /* end H5F_grp_path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_sieve_buf_size
@@ -404,7 +404,10 @@ H5F__super_read(H5F_t *f, hid_t dxpl_id)
         HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to determine file size")
 
     /* (Account for the stored EOA being absolute offset -QAK) */
-    if((eof + sblock->base_addr) < udata.stored_eof)
+    /* (A SWMR writer may have allocated space it hasn't written yet, so
+     *  the check doesn't apply to SWMR readers)
+     */
+    if(!(H5F_INTENT(f) & H5F_ACC_SWMR_READ) && (eof + sblock->base_addr) < udata.stored_eof)
         HGOTO_ERROR(H5E_FILE, H5E_TRUNCATED, FAIL, "truncated file: eof = %llu, sblock->base_addr = %llu, stored_eoa = %llu", (unsigned long long)eof, (unsigned long long)sblock->base_addr, (unsigned long long)udata.stored_eof)
 
     /*
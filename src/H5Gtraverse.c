@@ -38,12 +38,14 @@
 #include "H5Dprivate.h"         /* Datasets                             */
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fprivate.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5Gpkg.h"		/* Groups		  		*/
 #include "H5HLprivate.h"	/* Local Heaps				*/
 #include "H5Iprivate.h"		/* IDs					*/
 #include "H5Lprivate.h"		/* Links				*/
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Ppublic.h"		/* Property Lists			*/
+#include "H5SLprivate.h"	/* Skip lists				*/
 #include "H5WBprivate.h"        /* Wrapped Buffers                      */
 
 
@@ -51,6 +53,10 @@
 /* Local Macros */
 /****************/
 
+/* Maximum number of path prefixes cached for a file before the cache is
+ * emptied and rebuilt from subsequent traversals */
+#define H5G_PATH_CACHE_MAX_ENTRIES      4096
+
 
 /******************/
 /* Local Typedefs */
@@ -66,6 +72,13 @@ typedef struct {
     hbool_t exists;             /* Indicate if object exists */
 } H5G_trav_slink_t;
 
+/* Entry in a file's path cache, mapping a canonical path prefix (relative to
+ * the group the traversal started at) to the object reached through it */
+typedef struct H5G_path_cache_ent_t {
+    char *key;                  /* "<start addr>:/comp1/comp2/..." */
+    haddr_t addr;               /* Address of object's header */
+} H5G_path_cache_ent_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -87,6 +100,10 @@ static herr_t H5G_traverse_slink(const H5G_loc_t *grp_loc, const H5O_link_t *lnk
 static herr_t H5G_traverse_real(const H5G_loc_t *loc, const char *name,
     unsigned target, size_t *nlinks, H5G_traverse_t op, void *op_data,
     hid_t lapl_id, hid_t dxpl_id);
+static herr_t H5G__path_cache_find(const H5G_loc_t *loc, const char **name/*in,out*/,
+    H5G_loc_t *grp_loc/*in,out*/, char *key/*out*/, size_t *key_len/*out*/);
+static herr_t H5G__path_cache_insert(H5F_t *f, const char *key, haddr_t addr);
+static herr_t H5G__path_cache_free_cb(void *item, void *key, void *op_data);
 
 
 /*********************/
@@ -103,6 +120,9 @@ static herr_t H5G_traverse_real(const H5G_loc_t *loc, const char *name,
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the H5G_path_cache_ent_t struct */
+H5FL_DEFINE_STATIC(H5G_path_cache_ent_t);
+
 
 
 /*-------------------------------------------------------------------------
@@ -462,6 +482,193 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__traverse_special() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_free_cb
+ *
+ * Purpose:	Release an entry in a file's path cache
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__path_cache_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    H5G_path_cache_ent_t *ent = (H5G_path_cache_ent_t *)item;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ent);
+
+    H5MM_xfree(ent->key);
+    ent = H5FL_FREE(H5G_path_cache_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5G__path_cache_free_cb() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_find
+ *
+ * Purpose:	Build the path cache key for the intermediate components of
+ *              NAME, relative to LOC, and look for the longest prefix that
+ *              is already cached.  On a hit, GRP_LOC (a copy of LOC) is
+ *              moved to the cached group and NAME is advanced past the
+ *              components it covers.
+ *
+ *              On return, the first KEY_LEN characters of KEY hold the key
+ *              for GRP_LOC, ready to have further components appended.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__path_cache_find(const H5G_loc_t *loc, const char **name/*in,out*/,
+    H5G_loc_t *grp_loc/*in,out*/, char *key/*out*/, size_t *key_len/*out*/)
+{
+    H5SL_t *cache;                      /* File's path cache */
+    const char *s;                      /* Pointer into name */
+    size_t prefix_len;                  /* Length of the starting group part of key */
+    size_t nchars;                      /* Length of component */
+    unsigned ncomps = 0;                /* Number of components in name */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(loc);
+    HDassert(name && *name);
+    HDassert(grp_loc);
+    HDassert(key);
+    HDassert(key_len);
+
+    /* Key entries by the group the traversal starts at */
+    HDsprintf(key, H5_PRINTF_HADDR_FMT ":", loc->oloc->addr);
+    *key_len = prefix_len = HDstrlen(key);
+
+    /* Nothing to look up until the file has cached something */
+    if(NULL == (cache = H5F_GRP_PATH_CACHE(loc->oloc->file)))
+        HGOTO_DONE(SUCCEED)
+
+    /* Build the canonical form of the name, without '.' components or
+     * repeated separators */
+    s = *name;
+    while((s = H5G__component(s, &nchars)) && *s) {
+        if(!(1 == nchars && '.' == *s)) {
+            key[*key_len] = '/';
+            HDmemcpy(key + *key_len + 1, s, nchars);
+            *key_len += nchars + 1;
+            ncomps++;
+        } /* end if */
+        s += nchars;
+    } /* end while */
+    key[*key_len] = '\0';
+
+    /* Look for the longest cached prefix, not counting the last component */
+    while(ncomps > 1) {
+        H5G_path_cache_ent_t *ent;      /* Cached entry */
+        char *sep;                      /* Last separator in key */
+
+        sep = HDstrrchr(key + prefix_len, '/');
+        *sep = '\0';
+        ncomps--;
+
+        if(NULL != (ent = (H5G_path_cache_ent_t *)H5SL_search(cache, key))) {
+            unsigned n;                 /* Number of components to skip */
+
+            /* Start the traversal at the cached object */
+            grp_loc->oloc->addr = ent->addr;
+            if(H5G_name_set(loc->path, grp_loc->path, key + prefix_len + 1) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "cannot set name")
+
+            /* Skip over the components of the name the entry covers */
+            s = *name;
+            n = ncomps;
+            while(n > 0) {
+                s = H5G__component(s, &nchars);
+                if(!(1 == nchars && '.' == *s))
+                    n--;
+                s += nchars;
+            } /* end while */
+            *name = s;
+            *key_len = (size_t)(sep - key);
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end while */
+
+    /* Nothing cached, start from the beginning */
+    *key_len = prefix_len;
+    key[prefix_len] = '\0';
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_find() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_insert
+ *
+ * Purpose:	Remember the object at the end of the path prefix KEY in
+ *              file F's path cache.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__path_cache_insert(H5F_t *f, const char *key, haddr_t addr)
+{
+    H5SL_t *cache;                      /* File's path cache */
+    H5G_path_cache_ent_t *ent = NULL;   /* New cache entry */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(key);
+    HDassert(H5F_addr_defined(addr));
+
+    /* Create the cache the first time something is inserted */
+    if(NULL == (cache = H5F_GRP_PATH_CACHE(f))) {
+        if(NULL == (cache = H5SL_create(H5SL_TYPE_STR, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create path cache")
+        if(H5F_SET_GRP_PATH_CACHE(f, cache) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set path cache")
+    } /* end if */
+    else {
+        /* A nested traversal may have cached this prefix already */
+        if(NULL != H5SL_search(cache, key))
+            HGOTO_DONE(SUCCEED)
+
+        /* Start over when the cache gets too large */
+        if(H5SL_count(cache) >= H5G_PATH_CACHE_MAX_ENTRIES)
+            if(H5SL_free(cache, H5G__path_cache_free_cb, NULL) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't empty path cache")
+    } /* end else */
+
+    /* Create the entry and add it to the cache */
+    if(NULL == (ent = H5FL_MALLOC(H5G_path_cache_ent_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (ent->key = H5MM_xstrdup(key))) {
+        ent = H5FL_FREE(H5G_path_cache_ent_t, ent);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    } /* end if */
+    ent->addr = addr;
+    if(H5SL_insert(cache, ent, ent->key) < 0) {
+        H5G__path_cache_free_cb(ent, NULL, NULL);
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert path cache entry")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_insert() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_traverse_real
@@ -500,6 +707,9 @@ H5G_traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     char                *comp;          /* Pointer to buffer for path components */
     H5WB_t              *wb = NULL;     /* Wrapped buffer for temporary buffer */
     hbool_t last_comp = FALSE;          /* Flag to indicate that a component is the last component in the name */
+    char                *key = NULL;    /* Path cache key for current group */
+    size_t              key_len = 0;    /* Length of path cache key */
+    hbool_t use_cache = FALSE;          /* Flag to indicate that the current group can be cached */
     herr_t              ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -560,6 +770,21 @@ H5G_traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     if(NULL == (comp = (char *)H5WB_actual(wb, (HDstrlen(name) + 1))))
         HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
 
+    /*
+     * Skip the intermediate components of the name that are in the file's
+     * path cache.  Cached prefixes only ever cross hard links within the
+     * starting file, so SWMR readers, which can't see link changes made by
+     * the writer, don't use the cache.
+     */
+    if(H5F_addr_defined(loc.oloc->addr) && HDstrchr(name, '/')
+            && !(H5F_INTENT(loc.oloc->file) & H5F_ACC_SWMR_READ)) {
+        if(NULL == (key = (char *)H5MM_malloc(HDstrlen(name) + 32)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for path cache key")
+        if(H5G__path_cache_find(&loc, &name, &grp_loc, key, &key_len) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't search path cache")
+        use_cache = TRUE;
+    } /* end if */
+
     /* Traverse the path */
     while((name = H5G__component(name, &nchars)) && *name) {
         const char *s;                  /* Temporary string pointer */
@@ -759,6 +984,21 @@ H5G_traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
 	 * Advance to the next component of the path.
 	 */
 
+        /* Cache the path to this group if it was reached through hard links
+         * that stayed in the starting file */
+        if(use_cache) {
+            if(lookup_status && H5L_TYPE_HARD == lnk.type
+                    && obj_loc.oloc->file == loc.oloc->file) {
+                key[key_len++] = '/';
+                HDmemcpy(key + key_len, comp, nchars + 1);
+                key_len += nchars;
+                if(H5G__path_cache_insert(loc.oloc->file, key, obj_loc.oloc->addr) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't cache path")
+            } /* end if */
+            else
+                use_cache = FALSE;
+        } /* end if */
+
         /* Transfer "ownership" of the object's information to the group object */
         H5G_loc_free(&grp_loc);
         H5G_loc_copy(&grp_loc, &obj_loc, H5_COPY_SHALLOW);
@@ -806,6 +1046,7 @@ done:
     /* Release temporary component buffer */
     if(wb && H5WB_unwrap(wb) < 0)
         HDONE_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release wrapped buffer")
+    H5MM_xfree(key);
 
    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G_traverse_real() */
@@ -875,3 +1116,37 @@ done:
    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G_traverse() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_path_cache_invalidate
+ *
+ * Purpose:	Discard the path cache for file F.  Called whenever a link in
+ *              the file is created, removed or moved, when another file is
+ *              mounted on it, and when the file is closed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_path_cache_invalidate(H5F_t *f)
+{
+    H5SL_t *cache;                      /* File's path cache */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(f);
+
+    if(NULL != (cache = H5F_GRP_PATH_CACHE(f))) {
+        if(H5F_SET_GRP_PATH_CACHE(f, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't reset path cache")
+        if(H5SL_destroy(cache, H5G__path_cache_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCLOSEOBJ, FAIL, "can't destroy path cache")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_path_cache_invalidate() */
@@ -45,7 +45,6 @@
 #include "H5Ipkg.h"		/* IDs			  		*/
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Oprivate.h"		/* Object headers		  	*/
-#include "H5SLprivate.h"	/* Skip Lists                           */
 
 /* Define this to compile in support for dumping ID information */
 /* #define H5I_DEBUG_OUTPUT */
@@ -64,6 +63,14 @@
 #define H5I_MAKE(g,i)	((((hid_t)(g) & TYPE_MASK) << ID_BITS) |	  \
 			     ((hid_t)(i) & ID_MASK))
 
+/* Initial (and minimum) number of slots in a type's hash table of IDs */
+#define H5I_MIN_NSLOTS  64
+
+/* Home slot of an ID in a hash table with NSLOTS slots (a power of two).
+ * IDs in a type are handed out sequentially, so their serial numbers are
+ * spread evenly over the table without further hashing. */
+#define H5I_SLOT(id, nslots)  ((size_t)((id) & ID_MASK) & ((nslots) - 1))
+
 /* Local typedefs */
 
 /* Atom information structure used */
@@ -72,6 +79,8 @@ typedef struct H5I_id_info_t {
     unsigned	count;		/* ref. count for this atom		    */
     unsigned    app_count;      /* ref. count of application visible atoms  */
     const void	*obj_ptr;	/* pointer associated with the atom	    */
+    struct H5I_id_info_t *prev; /* Previous ID in type, in creation order */
+    struct H5I_id_info_t *next; /* Next ID in type, in creation order     */
 } H5I_id_info_t;
 
 /* ID type structure used */
@@ -80,7 +89,10 @@ typedef struct {
     unsigned	init_count;	/* # of times this type has been initialized*/
     uint64_t	id_count;	/* Current number of IDs held		    */
     uint64_t	nextid;		/* ID to use for the next atom		    */
-    H5SL_t      *ids;           /* Pointer to skip list that stores IDs     */
+    H5I_id_info_t **ids;        /* Hash table of IDs (open addressing)      */
+    size_t      nslots;         /* Number of slots in hash table            */
+    H5I_id_info_t *first;       /* Oldest ID in the type                    */
+    H5I_id_info_t *last;        /* Newest ID in the type                    */
 } H5I_id_type_t;
 
 typedef struct {
@@ -129,7 +141,11 @@ H5FL_DEFINE_STATIC(H5I_id_type_t);
 H5FL_DEFINE_STATIC(H5I_class_t);
 
 /*--------------------- Local function prototypes ---------------------------*/
-static htri_t H5I__clear_type_cb(void *_id, void *key, void *udata);
+static herr_t H5I__resize_ids(H5I_id_type_t *type_ptr, size_t new_nslots);
+static herr_t H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static H5I_id_info_t *H5I__search_id(const H5I_id_type_t *type_ptr, hid_t id);
+static void H5I__unlink_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static htri_t H5I__clear_type_cb(H5I_id_info_t *id, H5I_clear_type_ud_t *udata);
 static int H5I__destroy_type(H5I_type_t type);
 static void *H5I__remove_verify(hid_t id, H5I_type_t id_type);
 static void *H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id);
@@ -324,8 +340,10 @@ H5I_register_type(const H5I_class_t *cls)
         type_ptr->cls = cls;
         type_ptr->id_count = 0;
         type_ptr->nextid = cls->reserved;
-        if(NULL == (type_ptr->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
-            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "skip list creation failed")
+        type_ptr->first = type_ptr->last = NULL;
+        type_ptr->nslots = H5I_MIN_NSLOTS;
+        if(NULL == (type_ptr->ids = (H5I_id_info_t **)H5MM_calloc(type_ptr->nslots * sizeof(H5I_id_info_t *))))
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "ID hash table creation failed")
     } /* end if */
 
     /* Increment the count of the times this type has been initialized */
@@ -335,7 +353,7 @@ done:
     if(ret_value < 0) {	/* Clean up on error */
         if(type_ptr) {
             if(type_ptr->ids)
-                H5SL_close(type_ptr->ids);
+                type_ptr->ids = (H5I_id_info_t **)H5MM_xfree(type_ptr->ids);
             (void)H5FL_FREE(H5I_id_type_t, type_ptr);
         } /* end if */
     } /* end if */
@@ -517,6 +535,7 @@ herr_t
 H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
 {
     H5I_clear_type_ud_t udata;          /* udata struct for callback */
+    H5I_id_info_t *id_ptr, *next_ptr;   /* Current & next IDs in type */
     int         ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -532,9 +551,21 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
     udata.force = force;
     udata.app_ref = app_ref;
 
-    /* Attempt to free all ids in the type */
-    if(H5SL_try_free_safe(udata.type_ptr->ids, H5I__clear_type_cb, &udata) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, FAIL, "can't free ids in type")
+    /* Attempt to free all ids in the type, oldest first.  The 'free'
+     * callbacks may remove other IDs in the type, so the next ID is only
+     * looked up once the current one's callback has returned. */
+    for(id_ptr = udata.type_ptr->first; id_ptr; id_ptr = next_ptr) {
+        htri_t delete_id;               /* Whether to remove the ID */
+
+        delete_id = H5I__clear_type_cb(id_ptr, &udata);
+        next_ptr = id_ptr->next;
+
+        /* Remove ID if requested */
+        if(delete_id) {
+            H5I__unlink_id(udata.type_ptr, id_ptr);
+            id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+        } /* end if */
+    } /* end for */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -547,8 +578,8 @@ done:
  * Purpose:     Attempts to free the specified ID , calling the free
  *              function for the object.
  *
- * Return:      Success:        Non-negative
- *              Failure:        negative
+ * Return:      TRUE if the ID should be removed from its type, FALSE if
+ *              not
  *
  * Programmer:  Neil Fortner
  *              Friday, July 10, 2015
@@ -556,10 +587,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
+H5I__clear_type_cb(H5I_id_info_t *id, H5I_clear_type_ud_t *udata)
 {
-    H5I_id_info_t       *id = (H5I_id_info_t *)_id; /* Current ID being worked with */
-    H5I_clear_type_ud_t *udata = (H5I_clear_type_ud_t *)_udata; /* udata struct */
     htri_t              ret_value = FALSE;    /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
@@ -594,15 +623,6 @@ H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
             /* Indicate node should be removed from list */
             ret_value = TRUE;
         } /* end else */
-
-        /* Remove ID if requested */
-        if(ret_value) {
-            /* Free ID info */
-            id = H5FL_FREE(H5I_id_info_t, id);
-
-            /* Decrement the number of IDs in the type */
-            udata->type_ptr->id_count--;
-        } /* end if */
     } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -682,9 +702,14 @@ H5I__destroy_type(H5I_type_t type)
     if(type_ptr->cls->flags & H5I_CLASS_IS_APPLICATION)
         type_ptr->cls = H5FL_FREE(H5I_class_t, (void *)type_ptr->cls);
 
-    if(H5SL_close(type_ptr->ids) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list")
-    type_ptr->ids = NULL;
+    /* Release any IDs the 'free' callbacks refused to give up */
+    while(type_ptr->first) {
+        H5I_id_info_t *id_ptr = type_ptr->first;
+
+        H5I__unlink_id(type_ptr, id_ptr);
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+    } /* end while */
+    type_ptr->ids = (H5I_id_info_t **)H5MM_xfree(type_ptr->ids);
 
     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
     H5I_id_type_list_g[type] = NULL;
@@ -770,9 +795,10 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     id_ptr->obj_ptr = object;
 
     /* Insert into the type */
-    if(H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if(H5I__insert_id(type_ptr, id_ptr) < 0) {
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into hash table")
+    } /* end if */
     type_ptr->nextid++;
 
     /*
@@ -1093,15 +1119,21 @@ H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id)
     HDassert(type_ptr);
 
     /* Get the ID node for the ID */
-    if(NULL == (curr_id = (H5I_id_info_t *)H5SL_remove(type_ptr->ids, &id)))
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
+    if(NULL == (curr_id = H5I__search_id(type_ptr, id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from hash table")
+    H5I__unlink_id(type_ptr, curr_id);
 
     /* (Casting away const OK -QAK) */
     ret_value = (void *)curr_id->obj_ptr;
     curr_id = H5FL_FREE(H5I_id_info_t, curr_id);
 
-    /* Decrement the number of IDs in the type */
-    (type_ptr->id_count)--;
+    /* Shrink the hash table once it's mostly empty (keeping the larger
+     * table if that fails is harmless) */
+    if(type_ptr->nslots > H5I_MIN_NSLOTS && 8 * type_ptr->id_count < (uint64_t)type_ptr->nslots) {
+        H5E_BEGIN_TRY {
+            (void)H5I__resize_ids(type_ptr, type_ptr->nslots / 2);
+        } H5E_END_TRY
+    } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1884,10 +1916,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__iterate_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__iterate_cb(const H5I_id_info_t *item, const H5I_iterate_ud_t *udata)
 {
-    H5I_id_info_t *item = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
-    H5I_iterate_ud_t *udata = (H5I_iterate_ud_t *)_udata; /* User data for callback */
     int ret_value = H5_ITER_CONT;     /* Callback return value */
 
     FUNC_ENTER_STATIC_NOERR
@@ -1953,15 +1983,21 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
     /* Only iterate through ID list if it is initialized and there are IDs in type */
     if(type_ptr && type_ptr->init_count > 0 && type_ptr->id_count > 0) {
         H5I_iterate_ud_t iter_udata;    /* User data for iteration callback */
-        herr_t iter_status;             /* Iteration status */
+        H5I_id_info_t *id_ptr, *next_ptr; /* Current & next IDs in type */
+        int iter_status = H5_ITER_CONT; /* Iteration status */
 
         /* Set up iterator user data */
         iter_udata.user_func = func;
         iter_udata.user_udata = udata;
         iter_udata.app_ref = app_ref;
 
-        /* Iterate over IDs */
-        if((iter_status = H5SL_iterate(type_ptr->ids, H5I__iterate_cb, &iter_udata)) < 0)
+        /* Iterate over IDs, in increasing order (the order they were
+         * created in).  The callback may remove the current ID. */
+        for(id_ptr = type_ptr->first; id_ptr && iter_status == H5_ITER_CONT; id_ptr = next_ptr) {
+            next_ptr = id_ptr->next;
+            iter_status = H5I__iterate_cb(id_ptr, &iter_udata);
+        } /* end for */
+        if(iter_status < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
     } /* end if */
 
@@ -2003,12 +2039,202 @@ H5I__find_id(hid_t id)
 	HGOTO_DONE(NULL)
 
     /* Locate the ID node for the ID */
-    ret_value = (H5I_id_info_t *)H5SL_search(type_ptr->ids, &id);
+    ret_value = H5I__search_id(type_ptr, id);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I__find_id() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5I__resize_ids
+ *
+ * Purpose:	Moves the IDs of a type into a hash table with NEW_NSLOTS
+ *		slots (a power of two).
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__resize_ids(H5I_id_type_t *type_ptr, size_t new_nslots)
+{
+    H5I_id_info_t **new_ids;            /* New hash table */
+    H5I_id_info_t *id_ptr;              /* Current ID */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(type_ptr);
+    HDassert(new_nslots >= H5I_MIN_NSLOTS);
+    HDassert(0 == (new_nslots & (new_nslots - 1)));
+    HDassert((uint64_t)new_nslots > type_ptr->id_count);
+
+    if(NULL == (new_ids = (H5I_id_info_t **)H5MM_calloc(new_nslots * sizeof(H5I_id_info_t *))))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "can't allocate ID hash table")
+
+    /* Re-insert the IDs, probing linearly from their home slots */
+    for(id_ptr = type_ptr->first; id_ptr; id_ptr = id_ptr->next) {
+        size_t u = H5I_SLOT(id_ptr->id, new_nslots);
+
+        while(new_ids[u])
+            u = (u + 1) & (new_nslots - 1);
+        new_ids[u] = id_ptr;
+    } /* end for */
+
+    H5MM_xfree(type_ptr->ids);
+    type_ptr->ids = new_ids;
+    type_ptr->nslots = new_nslots;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__resize_ids() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5I__insert_id
+ *
+ * Purpose:	Adds a new ID to its type.  The ID must be newer than all
+ *		the IDs already in the type.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    size_t      u;                      /* Slot for ID */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+    HDassert(NULL == type_ptr->last || type_ptr->last->id < id_ptr->id);
+
+    /* Keep the table at most 3/4 full, so probe sequences stay short */
+    if(4 * (type_ptr->id_count + 1) > 3 * (uint64_t)type_ptr->nslots)
+        if(H5I__resize_ids(type_ptr, 2 * type_ptr->nslots) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTRESIZE, FAIL, "can't grow ID hash table")
+
+    /* Put the ID in the first free slot from its home slot */
+    u = H5I_SLOT(id_ptr->id, type_ptr->nslots);
+    while(type_ptr->ids[u])
+        u = (u + 1) & (type_ptr->nslots - 1);
+    type_ptr->ids[u] = id_ptr;
+
+    /* Append the ID to the type's list, which stays in increasing order */
+    id_ptr->prev = type_ptr->last;
+    id_ptr->next = NULL;
+    if(type_ptr->last)
+        type_ptr->last->next = id_ptr;
+    else
+        type_ptr->first = id_ptr;
+    type_ptr->last = id_ptr;
+
+    type_ptr->id_count++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__insert_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5I__search_id
+ *
+ * Purpose:	Looks up an ID in its type's hash table.
+ *
+ * Return:	Success:	Ptr to the ID's info struct.
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__search_id(const H5I_id_type_t *type_ptr, hid_t id)
+{
+    size_t      u;                      /* Current slot */
+    H5I_id_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(type_ptr);
+
+    /* Probe from the ID's home slot until the ID or an empty slot is found */
+    u = H5I_SLOT(id, type_ptr->nslots);
+    while(type_ptr->ids[u]) {
+        if(type_ptr->ids[u]->id == id)
+            HGOTO_DONE(type_ptr->ids[u])
+        u = (u + 1) & (type_ptr->nslots - 1);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__search_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5I__unlink_id
+ *
+ * Purpose:	Removes an ID from its type's hash table and list, without
+ *		releasing it.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__unlink_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    size_t      mask;                   /* Mask for slot numbers */
+    size_t      hole;                   /* Slot being emptied */
+    size_t      u;                      /* Current slot */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+    HDassert(type_ptr->id_count > 0);
+
+    /* Find the ID's slot */
+    mask = type_ptr->nslots - 1;
+    hole = H5I_SLOT(id_ptr->id, type_ptr->nslots);
+    while(type_ptr->ids[hole] != id_ptr) {
+        HDassert(type_ptr->ids[hole]);
+        hole = (hole + 1) & mask;
+    } /* end while */
+
+    /* Empty the slot, moving back any later IDs in the probe sequence that
+     * could no longer be found past the hole (so no "deleted" markers are
+     * needed) */
+    for(u = (hole + 1) & mask; type_ptr->ids[u]; u = (u + 1) & mask) {
+        size_t home = H5I_SLOT(type_ptr->ids[u]->id, type_ptr->nslots);
+
+        /* Move the ID if its home slot isn't cyclically in (hole, u] */
+        if(((u - home) & mask) >= ((u - hole) & mask)) {
+            type_ptr->ids[hole] = type_ptr->ids[u];
+            hole = u;
+        } /* end if */
+    } /* end for */
+    type_ptr->ids[hole] = NULL;
+
+    /* Remove the ID from the type's list */
+    if(id_ptr->prev)
+        id_ptr->prev->next = id_ptr->next;
+    else
+        type_ptr->first = id_ptr->next;
+    if(id_ptr->next)
+        id_ptr->next->prev = id_ptr->prev;
+    else
+        type_ptr->last = id_ptr->prev;
+
+    type_ptr->id_count--;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__unlink_id() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5Iget_name
@@ -2213,6 +2439,7 @@ static herr_t
 H5I__debug(H5I_type_t type)
 {
     H5I_id_type_t *type_ptr;
+    H5I_id_info_t *id_ptr;
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -2227,7 +2454,8 @@ H5I__debug(H5I_type_t type)
 
     /* List */
     fprintf(stderr, "	 List:\n");
-    H5SL_iterate(type_ptr->ids, H5I__debug_cb, &type);
+    for(id_ptr = type_ptr->first; id_ptr; id_ptr = id_ptr->next)
+        H5I__debug_cb(id_ptr, NULL, &type);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5I__debug() */
@@ -1783,6 +1783,10 @@ H5L_link_cb(H5G_loc_t *grp_loc/*in*/, const char *name, const H5O_link_t H5_ATTR
             udata->dxpl_id) < 0)
         HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create new link for object")
 
+    /* Forget cached paths in the file */
+    if(H5G_path_cache_invalidate(grp_loc->oloc->file) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTRESET, FAIL, "unable to invalidate path cache")
+
     /* Set object's path if it has been passed in and is not set */
     if(udata->path != NULL && udata->path->user_path_r == NULL)
         if(H5G_name_set(grp_loc->path, udata->path, name) < 0)
@@ -2359,6 +2363,10 @@ H5L_delete_cb(H5G_loc_t *grp_loc/*in*/, const char *name, const H5O_link_t *lnk,
     if(H5G_obj_remove(grp_loc->oloc, grp_loc->path->full_path_r, name, udata->dxpl_id) < 0)
 	HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to remove link from group")
 
+    /* Forget cached paths in the file */
+    if(H5G_path_cache_invalidate(grp_loc->oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRESET, FAIL, "unable to invalidate path cache")
+
 done:
     /* Indicate that this callback didn't take ownership of the group *
      * location for the object */
@@ -2442,6 +2450,10 @@ H5L_delete_by_idx_cb(H5G_loc_t H5_ATTR_UNUSED *grp_loc/*in*/, const char H5_ATTR
             udata->idx_type, udata->order, udata->n, udata->dxpl_id) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "link not found")
 
+    /* Forget cached paths in the file */
+    if(H5G_path_cache_invalidate(obj_loc->oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRESET, FAIL, "unable to invalidate path cache")
+
 done:
     /* Indicate that this callback didn't take ownership of the group *
      * location for the object */
@@ -2500,6 +2512,10 @@ H5L_move_dest_cb(H5G_loc_t *grp_loc/*in*/, const char *name,
             NULL, udata->dxpl_id) < 0)
         HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create new link to object")
 
+    /* Forget cached paths in the file */
+    if(H5G_path_cache_invalidate(grp_loc->oloc->file) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTRESET, FAIL, "unable to invalidate path cache")
+
     /* If the link was a user-defined link, call its move callback if it has one */
     if(udata->lnk->type >= H5L_TYPE_UD_MIN) {
         const H5L_class_t   *link_class;         /* User-defined link class */
@@ -2653,6 +2669,10 @@ H5L_move_cb(H5G_loc_t *grp_loc/*in*/, const char *name, const H5O_link_t *lnk,
         } /* end if */
 
         H5RS_decr(dst_name_r);
+
+        /* Forget cached paths in the file */
+        if(H5G_path_cache_invalidate(grp_loc->oloc->file) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRESET, FAIL, "unable to invalidate path cache")
     } /* end if */
 
 done:
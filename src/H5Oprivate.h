@@ -399,6 +399,8 @@ typedef struct H5O_efl_t {
 /* Forward declaration of structs used below */
 struct H5D_layout_ops_t;                /* Defined in H5Dpkg.h               */
 struct H5D_chunk_ops_t;                 /* Defined in H5Dpkg.h               */
+struct H5FA_t;                          /* Defined in H5FApkg.h              */
+struct H5EA_t;                          /* Defined in H5EApkg.h              */
 
 typedef struct H5O_storage_contig_t {
     haddr_t	addr;			/* File address of data              */
@@ -410,12 +412,26 @@ typedef struct H5O_storage_chunk_btree_t {
     H5UC_t     *shared;			/* Ref-counted shared info for B-tree nodes */
 } H5O_storage_chunk_btree_t;
 
+typedef struct H5O_storage_chunk_farray_t {
+    haddr_t     dset_ohdr_addr;         /* File address dataset's object header */
+    struct H5FA_t *fa;                  /* Pointer to fixed index array struct */
+    struct H5O_t *dset_ohdr;            /* Dataset's object header, when index depends on it */
+} H5O_storage_chunk_farray_t;
+
+typedef struct H5O_storage_chunk_earray_t {
+    haddr_t     dset_ohdr_addr;         /* File address dataset's object header */
+    struct H5EA_t *ea;                  /* Pointer to extensible index array struct */
+    struct H5O_t *dset_ohdr;            /* Dataset's object header, when index depends on it */
+} H5O_storage_chunk_earray_t;
+
 typedef struct H5O_storage_chunk_t {
     H5D_chunk_index_t idx_type;		/* Type of chunk index               */
     haddr_t	idx_addr;		/* File address of chunk index       */
     const struct H5D_chunk_ops_t *ops;  /* Pointer to chunked storage operations */
     union {
         H5O_storage_chunk_btree_t btree;   /* Information for v1 B-tree index   */
+        H5O_storage_chunk_farray_t farray; /* Information for fixed array index */
+        H5O_storage_chunk_earray_t earray; /* Information for extensible array index */
     } u;
 } H5O_storage_chunk_t;
 
@@ -510,6 +526,24 @@ typedef struct H5O_storage_t {
     } u;
 } H5O_storage_t;
 
+typedef struct H5O_layout_chunk_farray_t {
+    /* Stored in message */
+    uint8_t     max_dblk_page_nelmts_bits;  /* Log2(Max. # of elements in a data block page) */
+} H5O_layout_chunk_farray_t;
+
+typedef struct H5O_layout_chunk_earray_t {
+    /* Stored in message */
+    uint8_t     max_nelmts_bits;        /* Log2(Max. # of elements in array) */
+    uint8_t     idx_blk_elmts;          /* # of elements to store in index block */
+    uint8_t     data_blk_min_elmts;     /* Min. # of elements per data block */
+    uint8_t     sup_blk_min_data_ptrs;  /* Min. # of data block pointers for a super block */
+    uint8_t     max_dblk_page_nelmts_bits;  /* Log2(Max. # of elements in a data block page) */
+
+    /* Not stored */
+    unsigned    unlim_dim;              /* Rank of unlimited dimension for dataset */
+    hsize_t     swizzled_max_down_chunks[H5O_LAYOUT_NDIMS]; /* "down" size of number of chunks in each max dim, with the unlimited dim first */
+} H5O_layout_chunk_earray_t;
+
 typedef struct H5O_layout_chunk_t {
     unsigned	ndims;			/* Num dimensions in chunk           */
     uint32_t	dim[H5O_LAYOUT_NDIMS];	/* Size of chunk in elements         */
@@ -521,6 +555,10 @@ typedef struct H5O_layout_chunk_t {
     hsize_t     max_chunks[H5O_LAYOUT_NDIMS];      /* # of chunks in each dataset's max. dimension */
     hsize_t    	down_chunks[H5O_LAYOUT_NDIMS];     /* "down" size of number of chunks in each dimension */
     hsize_t    	max_down_chunks[H5O_LAYOUT_NDIMS]; /* "down" size of number of chunks in each max dim */
+    union {
+        H5O_layout_chunk_farray_t farray;  /* Information for fixed array index */
+        H5O_layout_chunk_earray_t earray;  /* Information for extensible array index */
+    } u;
 } H5O_layout_chunk_t;
 
 typedef struct H5O_layout_t {
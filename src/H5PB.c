@@ -0,0 +1,956 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:             H5PB.c
+ *
+ * Purpose:             Page buffer routines.  The page buffer caches
+ *                      fixed-size, page-aligned blocks of the file between
+ *                      the metadata accumulator and the file driver, so
+ *                      that many small, scattered metadata and raw data
+ *                      accesses within the same page are satisfied from
+ *                      memory and written back as whole pages.
+ *
+ *                      Pages are kept on an LRU list and in a skip list
+ *                      keyed on the page's file address.  A minimum
+ *                      percentage of pages may be reserved for metadata
+ *                      and for raw data, so that one kind of access can't
+ *                      flush the other out of the buffer entirely.
+ *                      Accesses which are at least a page in size bypass
+ *                      the buffer and go directly to the file driver.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5PBmodule.h"         /* This source code file is part of the H5PB module */
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5ACprivate.h"	/* Metadata cache			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"             /* File access				*/
+#include "H5FDprivate.h"	/* File drivers				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5PBprivate.h"	/* Page buffer				*/
+#include "H5SLprivate.h"	/* Skip Lists				*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Determine whether an I/O of a particular type is metadata or raw data */
+#define H5PB_IS_META(T)         (H5FD_MEM_DRAW != (T))
+
+/* Statistics array index for an I/O of a particular type */
+#define H5PB_STATS_IDX(T)       (H5PB_IS_META(T) ? H5PB_STATS_META : H5PB_STATS_RAW)
+
+/* Remove an entry from the LRU list */
+#define H5PB__LRU_REMOVE(pb, e)                                             \
+{                                                                           \
+    if((e)->prev)                                                           \
+        (e)->prev->next = (e)->next;                                        \
+    else                                                                    \
+        (pb)->head = (e)->next;                                             \
+    if((e)->next)                                                           \
+        (e)->next->prev = (e)->prev;                                        \
+    else                                                                    \
+        (pb)->tail = (e)->prev;                                             \
+    (e)->prev = (e)->next = NULL;                                           \
+}
+
+/* Insert an entry at the head (most recently used end) of the LRU list */
+#define H5PB__LRU_PREPEND(pb, e)                                            \
+{                                                                           \
+    (e)->prev = NULL;                                                       \
+    (e)->next = (pb)->head;                                                 \
+    if((pb)->head)                                                          \
+        (pb)->head->prev = (e);                                             \
+    else                                                                    \
+        (pb)->tail = (e);                                                   \
+    (pb)->head = (e);                                                       \
+}
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* A single page in the page buffer */
+typedef struct H5PB_entry_t {
+    haddr_t addr;                       /* Address of page in file (the skip list key) */
+    H5FD_mem_t type;                    /* Type of I/O which loaded the page */
+    hbool_t is_meta;                    /* Whether the page holds metadata */
+    hbool_t is_dirty;                   /* Whether the page needs writing to the file */
+    size_t len;                         /* # of bytes at the start of the page image which are valid */
+    uint8_t *page;                      /* Page image */
+    struct H5PB_entry_t *prev;          /* Previous (more recently used) entry in LRU list */
+    struct H5PB_entry_t *next;          /* Next (less recently used) entry in LRU list */
+} H5PB_entry_t;
+
+/* The page buffer for a file */
+struct H5PB_t {
+    /* Configuration */
+    size_t max_size;                    /* Maximum size of the page buffer, in bytes */
+    size_t page_size;                   /* Size of each page, in bytes */
+    unsigned min_meta_perc;             /* Percentage of pages reserved for metadata */
+    unsigned min_raw_perc;              /* Percentage of pages reserved for raw data */
+    size_t max_pages;                   /* Maximum # of pages held */
+    size_t min_meta_count;              /* Minimum # of metadata pages to retain */
+    size_t min_raw_count;               /* Minimum # of raw data pages to retain */
+
+    /* Current state */
+    size_t meta_count;                  /* # of metadata pages currently held */
+    size_t raw_count;                   /* # of raw data pages currently held */
+    H5SL_t *slist;                      /* Skip list of pages, keyed on address */
+    H5PB_entry_t *head;                 /* Most recently used page */
+    H5PB_entry_t *tail;                 /* Least recently used page */
+    H5FL_fac_head_t *page_fac;          /* Factory for page images */
+
+    /* Statistics (index H5PB_STATS_META or H5PB_STATS_RAW) */
+    unsigned accesses[H5PB_NUM_STATS_TYPES];    /* # of accesses */
+    unsigned hits[H5PB_NUM_STATS_TYPES];        /* # of accesses satisfied from the buffer */
+    unsigned misses[H5PB_NUM_STATS_TYPES];      /* # of accesses that loaded a page */
+    unsigned evictions[H5PB_NUM_STATS_TYPES];   /* # of pages evicted */
+    unsigned bypasses[H5PB_NUM_STATS_TYPES];    /* # of accesses that went to the file driver */
+};
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static const H5P_genplist_t *H5PB__get_dxpl(hbool_t is_meta);
+static herr_t H5PB__write_entry(const H5F_io_info_t *fio_info,
+    H5PB_entry_t *entry);
+static htri_t H5PB__make_space(const H5F_io_info_t *fio_info, H5PB_t *page_buf,
+    hbool_t is_meta);
+static herr_t H5PB__load_page(const H5F_io_info_t *fio_info, H5FD_mem_t type,
+    haddr_t page_addr, H5PB_entry_t **entry_out);
+static herr_t H5PB__extend_entry(const H5F_io_info_t *fio_info,
+    H5PB_entry_t *entry, haddr_t eoa);
+static herr_t H5PB__free_entry_cb(void *item, void *key, void *op_data);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* Package initialization variable */
+hbool_t H5_PKG_INIT_VAR = FALSE;
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5PB_t struct */
+H5FL_DEFINE_STATIC(H5PB_t);
+
+/* Declare a free list to manage the H5PB_entry_t struct */
+H5FL_DEFINE_STATIC(H5PB_entry_t);
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_create
+ *
+ * Purpose:	Create a page buffer for a file.  SIZE is the total size
+ *              of the buffer, which is rounded down to a whole number of
+ *              pages of PAGE_SIZE bytes each.  MIN_META_PERC and
+ *              MIN_RAW_PERC are the percentages of those pages which are
+ *              reserved for metadata and raw data, respectively.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_create(H5F_t *f, size_t size, size_t page_size, unsigned min_meta_perc,
+    unsigned min_raw_perc)
+{
+    H5PB_t *page_buf = NULL;            /* New page buffer */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(NULL == f->shared->page_buf);
+    HDassert(min_meta_perc <= 100);
+    HDassert(min_raw_perc <= 100);
+    HDassert((min_meta_perc + min_raw_perc) <= 100);
+
+    /* Check arguments */
+    if(page_size < H5PB_MIN_PAGE_SIZE || !POWER_OF_TWO(page_size))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page size must be a power of two and at least %u bytes", (unsigned)H5PB_MIN_PAGE_SIZE)
+    if(size < page_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page buffer size smaller than page size")
+
+    /* Page buffering isn't coordinated between processes */
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "page buffering is not supported with parallel file drivers")
+
+    /* The multi driver maps each type of data to its own member file, in
+     *  regions of the address space which aren't page-aligned */
+    if(!HDstrcmp(f->shared->lf->cls->name, "multi"))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "page buffering is not supported with the multi file driver")
+
+    /* Pages written by a SWMR writer would be held back from the readers, and
+     *  pages cached by a SWMR reader would go stale */
+    if(H5F_INTENT(f) & (H5F_ACC_SWMR_WRITE | H5F_ACC_SWMR_READ))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "page buffering is not supported with SWMR access")
+
+    /* Allocate the page buffer struct */
+    if(NULL == (page_buf = H5FL_CALLOC(H5PB_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    /* Set configuration */
+    page_buf->page_size = page_size;
+    page_buf->max_pages = size / page_size;
+    page_buf->max_size = page_buf->max_pages * page_size;
+    page_buf->min_meta_perc = min_meta_perc;
+    page_buf->min_raw_perc = min_raw_perc;
+    page_buf->min_meta_count = (page_buf->max_pages * min_meta_perc) / 100;
+    page_buf->min_raw_count = (page_buf->max_pages * min_raw_perc) / 100;
+
+    /* Create the skip list for the pages */
+    if(NULL == (page_buf->slist = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list")
+
+    /* Create the factory for page images */
+    if(NULL == (page_buf->page_fac = H5FL_fac_init(page_size)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINIT, FAIL, "can't create page factory")
+
+    /* Attach the page buffer to the file */
+    f->shared->page_buf = page_buf;
+
+done:
+    if(ret_value < 0 && page_buf) {
+        if(page_buf->slist)
+            H5SL_close(page_buf->slist);
+        if(page_buf->page_fac)
+            H5FL_fac_term(page_buf->page_fac);
+        page_buf = H5FL_FREE(H5PB_t, page_buf);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__get_dxpl
+ *
+ * Purpose:	Retrieve the library's default transfer property list for
+ *              writing back a page of metadata or raw data.  Write-back
+ *              happens on behalf of whatever operation caused it, so the
+ *              caller's DXPL may not match the kind of page being written.
+ *
+ * Return:	Success:	Pointer to DXPL
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static const H5P_genplist_t *
+H5PB__get_dxpl(hbool_t is_meta)
+{
+    const H5P_genplist_t *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (ret_value = (const H5P_genplist_t *)H5I_object(is_meta ? H5AC_ind_read_dxpl_id : H5AC_rawdata_dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "can't get property list")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__get_dxpl() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__write_entry
+ *
+ * Purpose:	Write a dirty page to the file.  Only the valid portion of
+ *              the page which is also below the current EOA is written, so
+ *              file space allocated after the page was loaded is never
+ *              overwritten with bytes the buffer doesn't hold.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__write_entry(const H5F_io_info_t *fio_info, H5PB_entry_t *entry)
+{
+    H5FD_t *lf = fio_info->f->shared->lf;       /* File driver */
+    haddr_t eoa;                                /* Current EOA for the page's type */
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(entry);
+
+    if(entry->is_dirty) {
+        if(HADDR_UNDEF == (eoa = H5FD_get_eoa(lf, entry->type)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+
+        /* Skip pages that are now entirely past the end of the file */
+        if(H5F_addr_lt(entry->addr, eoa) && entry->len > 0) {
+            const H5P_genplist_t *dxpl;         /* DXPL for write */
+            size_t len = (size_t)MIN((haddr_t)entry->len, eoa - entry->addr);
+
+            if(NULL == (dxpl = H5PB__get_dxpl(entry->is_meta)))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't get transfer property list")
+            if(H5FD_write(lf, dxpl, entry->type, entry->addr, len, entry->page) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+        } /* end if */
+
+        entry->is_dirty = FALSE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__write_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__make_space
+ *
+ * Purpose:	Ensure there is room for another page of the given kind,
+ *              evicting the least recently used eligible page if the
+ *              buffer is full.  A page is eligible if it is the same kind
+ *              as the new page, or if evicting it won't take its kind
+ *              below its reserved minimum.
+ *
+ * Return:	TRUE if there is room/FALSE if no page could be
+ *              evicted/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5PB__make_space(const H5F_io_info_t *fio_info, H5PB_t *page_buf, hbool_t is_meta)
+{
+    H5PB_entry_t *entry;                /* Current entry examined */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check for room without evicting anything */
+    if((page_buf->meta_count + page_buf->raw_count) < page_buf->max_pages)
+        HGOTO_DONE(TRUE)
+
+    /* Scan from the least recently used end for a page to evict */
+    for(entry = page_buf->tail; entry; entry = entry->prev) {
+        if(entry->is_meta == is_meta
+                || (entry->is_meta && page_buf->meta_count > page_buf->min_meta_count)
+                || (!entry->is_meta && page_buf->raw_count > page_buf->min_raw_count))
+            break;
+    } /* end for */
+
+    if(entry) {
+        /* Write the page, if it's dirty */
+        if(H5PB__write_entry(fio_info, entry) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "unable to write page")
+
+        /* Remove it from the buffer */
+        if(NULL == H5SL_remove(page_buf->slist, &entry->addr))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTREMOVE, FAIL, "can't remove page from skip list")
+        H5PB__LRU_REMOVE(page_buf, entry)
+        if(entry->is_meta) {
+            page_buf->meta_count--;
+            page_buf->evictions[H5PB_STATS_META]++;
+        } /* end if */
+        else {
+            page_buf->raw_count--;
+            page_buf->evictions[H5PB_STATS_RAW]++;
+        } /* end else */
+
+        /* Release it */
+        entry->page = (uint8_t *)H5FL_FAC_FREE(page_buf->page_fac, entry->page);
+        entry = H5FL_FREE(H5PB_entry_t, entry);
+
+        ret_value = TRUE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__make_space() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__load_page
+ *
+ * Purpose:	Bring the page at PAGE_ADDR into the buffer, reading
+ *              whatever part of it lies below the EOA from the file.  The
+ *              rest of the page isn't valid until the EOA grows to cover
+ *              it (see H5PB__extend_entry).  If no page can be evicted to make
+ *              room, *ENTRY_OUT is set to NULL and the caller should
+ *              perform its I/O directly.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__load_page(const H5F_io_info_t *fio_info, H5FD_mem_t type,
+    haddr_t page_addr, H5PB_entry_t **entry_out)
+{
+    H5PB_t *page_buf = fio_info->f->shared->page_buf;   /* Page buffer */
+    H5FD_t *lf = fio_info->f->shared->lf;               /* File driver */
+    H5PB_entry_t *entry = NULL;         /* New entry */
+    hbool_t is_meta = H5PB_IS_META(type);       /* Kind of page */
+    haddr_t eoa;                        /* Current EOA for the type */
+    htri_t have_space;                  /* Whether there's room for the page */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(page_buf);
+    HDassert(0 == (page_addr % page_buf->page_size));
+    HDassert(entry_out);
+
+    *entry_out = NULL;
+
+    /* Make room for the page */
+    if((have_space = H5PB__make_space(fio_info, page_buf, is_meta)) < 0)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "unable to make space in page buffer")
+    if(!have_space)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate the entry and its page image */
+    if(NULL == (entry = H5FL_CALLOC(H5PB_entry_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (entry->page = (uint8_t *)H5FL_FAC_MALLOC(page_buf->page_fac)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for page")
+    entry->addr = page_addr;
+    entry->type = type;
+    entry->is_meta = is_meta;
+
+    /* Read the part of the page that lies within the file */
+    if(HADDR_UNDEF == (eoa = H5FD_get_eoa(lf, type)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+    if(H5F_addr_lt(page_addr, eoa)) {
+        entry->len = (size_t)MIN((haddr_t)page_buf->page_size, eoa - page_addr);
+
+        if(H5FD_read(lf, fio_info->dxpl, type, page_addr, entry->len, entry->page) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "file read failed")
+    } /* end if */
+
+    /* Add the entry to the buffer */
+    if(H5SL_insert(page_buf->slist, entry, &entry->addr) < 0)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "can't insert page into skip list")
+    H5PB__LRU_PREPEND(page_buf, entry)
+    if(is_meta)
+        page_buf->meta_count++;
+    else
+        page_buf->raw_count++;
+
+    *entry_out = entry;
+
+done:
+    if(ret_value < 0 && entry) {
+        if(entry->page)
+            entry->page = (uint8_t *)H5FL_FAC_FREE(page_buf->page_fac, entry->page);
+        entry = H5FL_FREE(H5PB_entry_t, entry);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__load_page() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__extend_entry
+ *
+ * Purpose:	Read the part of a buffered page which was past the EOA when
+ *              the page was loaded, but which EOA now covers.  The bytes
+ *              already valid in the page image (which may be dirty) are
+ *              left alone.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__extend_entry(const H5F_io_info_t *fio_info, H5PB_entry_t *entry,
+    haddr_t eoa)
+{
+    size_t page_size = fio_info->f->shared->page_buf->page_size;  /* Size of a page */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(entry);
+    HDassert(entry->len <= page_size);
+
+    if(entry->len < page_size && H5F_addr_gt(eoa, entry->addr + entry->len)) {
+        size_t new_len = (size_t)MIN((haddr_t)page_size, eoa - entry->addr);
+
+        if(H5FD_read(fio_info->f->shared->lf, fio_info->dxpl, entry->type, entry->addr + entry->len, new_len - entry->len, entry->page + entry->len) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "file read failed")
+        entry->len = new_len;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__extend_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_read
+ *
+ * Purpose:	Reads SIZE bytes from the file at ADDR into BUF, through the
+ *              page buffer if there is one.  Reads of a page or more go
+ *              directly to the file driver and are then patched with any
+ *              dirty pages they overlap.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_read(const H5F_io_info_t *fio_info, H5FD_mem_t type, haddr_t addr,
+    size_t size, void *buf/*out*/)
+{
+    H5PB_t *page_buf;                   /* Page buffer */
+    H5FD_t *lf;                         /* File driver */
+    unsigned idx;                       /* Statistics index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+    HDassert(buf);
+
+    page_buf = fio_info->f->shared->page_buf;
+    lf = fio_info->f->shared->lf;
+
+    /* Pass through to the file driver when not buffering */
+    if(NULL == page_buf || 0 == size) {
+        if(H5FD_read(lf, fio_info->dxpl, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    idx = H5PB_STATS_IDX(type);
+    page_buf->accesses[idx]++;
+
+    if(size >= page_buf->page_size) {
+        H5SL_node_t *node;              /* Skip list node */
+        haddr_t first_page = addr - (addr % page_buf->page_size);
+        haddr_t end = addr + size;
+
+        page_buf->bypasses[idx]++;
+
+        /* Read the data directly */
+        if(H5FD_read(lf, fio_info->dxpl, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+
+        /* Overlay any dirty pages which overlap the read */
+        node = H5SL_above(page_buf->slist, &first_page);
+        while(node) {
+            H5PB_entry_t *entry = (H5PB_entry_t *)H5SL_item(node);
+
+            if(H5F_addr_ge(entry->addr, end))
+                break;
+            if(entry->is_dirty && H5F_addr_lt(addr, entry->addr + entry->len)) {
+                haddr_t start = MAX(addr, entry->addr);
+                haddr_t stop = MIN(end, entry->addr + entry->len);
+
+                HDmemcpy((uint8_t *)buf + (start - addr), entry->page + (start - entry->addr), (size_t)(stop - start));
+            } /* end if */
+
+            node = H5SL_next(node);
+        } /* end while */
+    } /* end if */
+    else {
+        haddr_t eoa;                    /* Current EOA for the type */
+        uint8_t *p = (uint8_t *)buf;    /* Current position in buffer */
+        hbool_t hit = TRUE;             /* Whether all pages were present */
+
+        /* Apply the same bounds check as the file driver */
+        if(HADDR_UNDEF == (eoa = H5FD_get_eoa(lf, type)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+        if((addr + size) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu", (unsigned long long)addr, (unsigned long long)size, (unsigned long long)eoa)
+
+        /* A small access spans at most two pages */
+        while(size > 0) {
+            H5PB_entry_t *entry;        /* Page entry */
+            haddr_t page_addr = addr - (addr % page_buf->page_size);
+            size_t offset = (size_t)(addr - page_addr);
+            size_t len = MIN(size, page_buf->page_size - offset);
+
+            if(NULL != (entry = (H5PB_entry_t *)H5SL_search(page_buf->slist, &page_addr))) {
+                /* Make the page most recently used */
+                H5PB__LRU_REMOVE(page_buf, entry)
+                H5PB__LRU_PREPEND(page_buf, entry)
+
+                /* Pick up any of the page the file has grown into */
+                if((offset + len) > entry->len)
+                    if(H5PB__extend_entry(fio_info, entry, eoa) < 0)
+                        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "unable to extend page")
+            } /* end if */
+            else {
+                hit = FALSE;
+                if(H5PB__load_page(fio_info, type, page_addr, &entry) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTLOAD, FAIL, "unable to load page")
+            } /* end else */
+
+            if(entry)
+                HDmemcpy(p, entry->page + offset, len);
+            else
+                if(H5FD_read(lf, fio_info->dxpl, type, addr, len, p) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+
+            addr += len;
+            p += len;
+            size -= len;
+        } /* end while */
+
+        if(hit)
+            page_buf->hits[idx]++;
+        else
+            page_buf->misses[idx]++;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_write
+ *
+ * Purpose:	Writes SIZE bytes from BUF to the file at ADDR, through the
+ *              page buffer if there is one.  Small writes are held in
+ *              the buffer until their page is evicted or flushed.  Writes
+ *              of a page or more go directly to the file driver and also
+ *              update any pages they overlap that are already buffered.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_write(const H5F_io_info_t *fio_info, H5FD_mem_t type, haddr_t addr,
+    size_t size, const void *buf)
+{
+    H5PB_t *page_buf;                   /* Page buffer */
+    H5FD_t *lf;                         /* File driver */
+    unsigned idx;                       /* Statistics index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+    HDassert(buf);
+
+    page_buf = fio_info->f->shared->page_buf;
+    lf = fio_info->f->shared->lf;
+
+    /* Pass through to the file driver when not buffering */
+    if(NULL == page_buf || 0 == size) {
+        if(H5FD_write(lf, fio_info->dxpl, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "driver write request failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    idx = H5PB_STATS_IDX(type);
+    page_buf->accesses[idx]++;
+
+    if(size >= page_buf->page_size) {
+        H5SL_node_t *node;              /* Skip list node */
+        haddr_t first_page = addr - (addr % page_buf->page_size);
+        haddr_t end = addr + size;
+
+        page_buf->bypasses[idx]++;
+
+        /* Write the data directly */
+        if(H5FD_write(lf, fio_info->dxpl, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "driver write request failed")
+
+        /* Keep any buffered pages which overlap the write current.  A page
+         *  which doesn't yet hold the bytes up to the write is extended
+         *  first, from the file, which already has the new data.
+         */
+        node = H5SL_above(page_buf->slist, &first_page);
+        while(node) {
+            H5PB_entry_t *entry = (H5PB_entry_t *)H5SL_item(node);
+            haddr_t start, stop;
+
+            if(H5F_addr_ge(entry->addr, end))
+                break;
+            start = MAX(addr, entry->addr);
+            stop = MIN(end, entry->addr + page_buf->page_size);
+            if((stop - entry->addr) > entry->len) {
+                haddr_t eoa;            /* Current EOA for the page's type */
+
+                if(HADDR_UNDEF == (eoa = H5FD_get_eoa(lf, entry->type)))
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+                if(H5PB__extend_entry(fio_info, entry, eoa) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "unable to extend page")
+            } /* end if */
+            HDmemcpy(entry->page + (start - entry->addr), (const uint8_t *)buf + (start - addr), (size_t)(stop - start));
+
+            node = H5SL_next(node);
+        } /* end while */
+    } /* end if */
+    else {
+        haddr_t eoa;                    /* Current EOA for the type */
+        const uint8_t *p = (const uint8_t *)buf;        /* Current position in buffer */
+        hbool_t hit = TRUE;             /* Whether all pages were present */
+
+        /* Apply the same bounds check as the file driver */
+        if(HADDR_UNDEF == (eoa = H5FD_get_eoa(lf, type)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+        if((addr + size) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu", (unsigned long long)addr, (unsigned long long)size, (unsigned long long)eoa)
+
+        /* A small access spans at most two pages */
+        while(size > 0) {
+            H5PB_entry_t *entry;        /* Page entry */
+            haddr_t page_addr = addr - (addr % page_buf->page_size);
+            size_t offset = (size_t)(addr - page_addr);
+            size_t len = MIN(size, page_buf->page_size - offset);
+
+            if(NULL != (entry = (H5PB_entry_t *)H5SL_search(page_buf->slist, &page_addr))) {
+                /* Make the page most recently used */
+                H5PB__LRU_REMOVE(page_buf, entry)
+                H5PB__LRU_PREPEND(page_buf, entry)
+
+                /* Pick up any of the page the file has grown into */
+                if((offset + len) > entry->len)
+                    if(H5PB__extend_entry(fio_info, entry, eoa) < 0)
+                        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "unable to extend page")
+            } /* end if */
+            else {
+                hit = FALSE;
+                if(H5PB__load_page(fio_info, type, page_addr, &entry) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTLOAD, FAIL, "unable to load page")
+            } /* end else */
+
+            if(entry) {
+                HDmemcpy(entry->page + offset, p, len);
+                entry->is_dirty = TRUE;
+            } /* end if */
+            else
+                if(H5FD_write(lf, fio_info->dxpl, type, addr, len, p) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "driver write request failed")
+
+            addr += len;
+            p += len;
+            size -= len;
+        } /* end while */
+
+        if(hit)
+            page_buf->hits[idx]++;
+        else
+            page_buf->misses[idx]++;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_flush
+ *
+ * Purpose:	Write all dirty pages to the file, in address order.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_flush(const H5F_io_info_t *fio_info)
+{
+    H5PB_t *page_buf;                   /* Page buffer */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+
+    if(NULL != (page_buf = fio_info->f->shared->page_buf)) {
+        H5SL_node_t *node;              /* Skip list node */
+
+        for(node = H5SL_first(page_buf->slist); node; node = H5SL_next(node))
+            if(H5PB__write_entry(fio_info, (H5PB_entry_t *)H5SL_item(node)) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTFLUSH, FAIL, "unable to write page")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__free_entry_cb
+ *
+ * Purpose:	Skip list callback to release a page entry.
+ *
+ * Return:	Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__free_entry_cb(void *item, void H5_ATTR_UNUSED *key, void *op_data)
+{
+    H5PB_entry_t *entry = (H5PB_entry_t *)item;         /* Entry to free */
+    H5PB_t *page_buf = (H5PB_t *)op_data;               /* Page buffer */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    entry->page = (uint8_t *)H5FL_FAC_FREE(page_buf->page_fac, entry->page);
+    entry = H5FL_FREE(H5PB_entry_t, entry);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5PB__free_entry_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_dest
+ *
+ * Purpose:	Flush and release the page buffer for a file, if it has one.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_dest(const H5F_io_info_t *fio_info)
+{
+    H5PB_t *page_buf;                   /* Page buffer */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+
+    if(NULL != (page_buf = fio_info->f->shared->page_buf)) {
+        /* Write out any dirty pages */
+        if(H5PB_flush(fio_info) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_PAGEBUF, H5E_CANTFLUSH, FAIL, "unable to flush page buffer")
+
+        /* Release the pages and the buffer itself */
+        if(H5SL_destroy(page_buf->slist, H5PB__free_entry_cb, page_buf) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy skip list")
+        if(H5FL_fac_term(page_buf->page_fac) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_PAGEBUF, H5E_CANTRELEASE, FAIL, "can't release page factory")
+        fio_info->f->shared->page_buf = H5FL_FREE(H5PB_t, page_buf);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_dest() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_get_stats
+ *
+ * Purpose:	Retrieve the page buffer statistics.  Each array has an
+ *              element for metadata (H5PB_STATS_META) and for raw data
+ *              (H5PB_STATS_RAW).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
+    unsigned misses[2], unsigned evictions[2], unsigned bypasses[2])
+{
+    unsigned u;                         /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Sanity checks */
+    HDassert(page_buf);
+
+    for(u = 0; u < H5PB_NUM_STATS_TYPES; u++) {
+        if(accesses)
+            accesses[u] = page_buf->accesses[u];
+        if(hits)
+            hits[u] = page_buf->hits[u];
+        if(misses)
+            misses[u] = page_buf->misses[u];
+        if(evictions)
+            evictions[u] = page_buf->evictions[u];
+        if(bypasses)
+            bypasses[u] = page_buf->bypasses[u];
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5PB_get_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_reset_stats
+ *
+ * Purpose:	Reset the page buffer statistics.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_reset_stats(H5PB_t *page_buf)
+{
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Sanity checks */
+    HDassert(page_buf);
+
+    HDmemset(page_buf->accesses, 0, sizeof(page_buf->accesses));
+    HDmemset(page_buf->hits, 0, sizeof(page_buf->hits));
+    HDmemset(page_buf->misses, 0, sizeof(page_buf->misses));
+    HDmemset(page_buf->evictions, 0, sizeof(page_buf->evictions));
+    HDmemset(page_buf->bypasses, 0, sizeof(page_buf->bypasses));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5PB_reset_stats() */
+
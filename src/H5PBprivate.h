@@ -0,0 +1,81 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5PBprivate.h
+ *
+ * Purpose:		This file contains private declarations for the
+ *			page buffer, which caches fixed-size, page-aligned
+ *			blocks of the file beneath the metadata accumulator.
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef _H5PBprivate_H
+#define _H5PBprivate_H
+
+/* Private headers needed by this file */
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Fprivate.h"		/* File access				*/
+#include "H5FDprivate.h"	/* File drivers				*/
+
+
+/**************************/
+/* Library Private Macros */
+/**************************/
+
+/* Default size of a page in the page buffer */
+#define H5PB_DEFAULT_PAGE_SIZE          4096
+
+/* Smallest page size permitted */
+#define H5PB_MIN_PAGE_SIZE              512
+
+/* Indices into the page buffer statistics arrays */
+#define H5PB_STATS_META                 0
+#define H5PB_STATS_RAW                  1
+#define H5PB_NUM_STATS_TYPES            2
+
+
+/****************************/
+/* Library Private Typedefs */
+/****************************/
+
+/* Page buffer (defined in H5PB.c) */
+typedef struct H5PB_t H5PB_t;
+
+
+/***************************************/
+/* Library-private Function Prototypes */
+/***************************************/
+
+/* General routines */
+H5_DLL herr_t H5PB_create(H5F_t *f, size_t size, size_t page_size,
+    unsigned min_meta_perc, unsigned min_raw_perc);
+H5_DLL herr_t H5PB_flush(const H5F_io_info_t *fio_info);
+H5_DLL herr_t H5PB_dest(const H5F_io_info_t *fio_info);
+
+/* I/O routines */
+H5_DLL herr_t H5PB_read(const H5F_io_info_t *fio_info, H5FD_mem_t type,
+    haddr_t addr, size_t size, void *buf/*out*/);
+H5_DLL herr_t H5PB_write(const H5F_io_info_t *fio_info, H5FD_mem_t type,
+    haddr_t addr, size_t size, const void *buf);
+
+/* Statistics routines */
+H5_DLL herr_t H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2],
+    unsigned hits[2], unsigned misses[2], unsigned evictions[2],
+    unsigned bypasses[2]);
+H5_DLL herr_t H5PB_reset_stats(H5PB_t *page_buf);
+
+#endif /* _H5PBprivate_H */
+
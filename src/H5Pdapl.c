@@ -63,6 +63,11 @@
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEF         H5D_CHUNK_CACHE_W0_DEFAULT
 #define H5D_ACS_PREEMPT_READ_CHUNKS_ENC         H5P__encode_double
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEC         H5P__decode_double
+/* Definition for replacement policy of raw data chunk cache */
+#define H5D_ACS_CHUNK_CACHE_POLICY_SIZE         sizeof(H5D_chunk_cache_policy_t)
+#define H5D_ACS_CHUNK_CACHE_POLICY_DEF          H5D_CHUNK_CACHE_POLICY_W0
+#define H5D_ACS_CHUNK_CACHE_POLICY_ENC          H5P__dacc_chunk_cache_policy_enc
+#define H5D_ACS_CHUNK_CACHE_POLICY_DEC          H5P__dacc_chunk_cache_policy_dec
 /* Definitions for VDS view option */
 #define H5D_ACS_VDS_VIEW_SIZE                   sizeof(H5D_vds_view_t)
 #define H5D_ACS_VDS_VIEW_DEF                    H5D_VDS_LAST_AVAILABLE
@@ -107,6 +112,8 @@ static herr_t H5P__decode_chunk_cache_nslots(const void **_pp, void *_value);
 static herr_t H5P__encode_chunk_cache_nbytes(const void *value, void **_pp,
     size_t *size);
 static herr_t H5P__decode_chunk_cache_nbytes(const void **_pp, void *_value);
+static herr_t H5P__dacc_chunk_cache_policy_enc(const void *value, void **pp, size_t *size);
+static herr_t H5P__dacc_chunk_cache_policy_dec(const void **pp, void *value);
 
 /* Property list callbacks */
 static herr_t H5P__dacc_vds_view_enc(const void *value, void **pp, size_t *size);
@@ -179,6 +186,7 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     size_t rdcc_nslots = H5D_ACS_DATA_CACHE_NUM_SLOTS_DEF;      /* Default raw data chunk cache # of slots */
     size_t rdcc_nbytes = H5D_ACS_DATA_CACHE_BYTE_SIZE_DEF;      /* Default raw data chunk cache # of bytes */
     double rdcc_w0 = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
+    H5D_chunk_cache_policy_t rdcc_policy = H5D_ACS_CHUNK_CACHE_POLICY_DEF; /* Default raw data chunk cache replacement policy */
     H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;         /* Default VDS view option */
     hsize_t printf_gap = H5D_ACS_VDS_PRINTF_GAP_DEF;            /* Default VDS printf gap */
     herr_t ret_value = SUCCEED;         /* Return value */
@@ -200,6 +208,11 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
              NULL, NULL, NULL, H5D_ACS_PREEMPT_READ_CHUNKS_ENC, H5D_ACS_PREEMPT_READ_CHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
          HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the replacement policy of the raw data chunk cache */
+    if(H5P_register_real(pclass, H5D_ACS_CHUNK_CACHE_POLICY_NAME, H5D_ACS_CHUNK_CACHE_POLICY_SIZE, &rdcc_policy,
+             NULL, NULL, NULL, H5D_ACS_CHUNK_CACHE_POLICY_ENC, H5D_ACS_CHUNK_CACHE_POLICY_DEC, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the VDS view option */
     if(H5P_register_real(pclass, H5D_ACS_VDS_VIEW_NAME, H5D_ACS_VDS_VIEW_SIZE, &virtual_view,
             NULL, NULL, NULL, H5D_ACS_VDS_VIEW_ENC, H5D_ACS_VDS_VIEW_DEC,
@@ -606,6 +619,156 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_chunk_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_chunk_cache_policy
+ *
+ * Purpose:	Sets the replacement policy of the raw data chunk cache for
+ *		datasets opened with this property list:
+ *
+ *		H5D_CHUNK_CACHE_POLICY_W0 (the default) preempts chunks in
+ *		least recently used order, preferring chunks that have been
+ *		fully read or written according to the RDCC_W0 value.
+ *
+ *		H5D_CHUNK_CACHE_POLICY_LRU preempts the least recently used
+ *		chunk.
+ *
+ *		H5D_CHUNK_CACHE_POLICY_ARC keeps chunks that have been used
+ *		more than once apart from chunks used only once, and adapts
+ *		the share of the cache given to each from the chunks it
+ *		recently preempted, in the manner of the Adaptive
+ *		Replacement Cache.  Reads that stride once across many
+ *		chunks then don't push out the chunks in steady use.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t policy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iDp", dapl_id, policy);
+
+    /* Check argument */
+    if(policy < H5D_CHUNK_CACHE_POLICY_W0 || policy >= H5D_CHUNK_CACHE_POLICY_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a valid chunk cache policy")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_ACS_CHUNK_CACHE_POLICY_NAME, &policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk cache policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_cache_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_chunk_cache_policy
+ *
+ * Purpose:	Retrieves the replacement policy of the raw data chunk
+ *		cache set by H5Pset_chunk_cache_policy().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t *policy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*Dp", dapl_id, policy);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value from property list */
+    if(policy)
+        if(H5P_get(plist, H5D_ACS_CHUNK_CACHE_POLICY_NAME, policy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_cache_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dacc_chunk_cache_policy_enc
+ *
+ * Purpose:     Callback routine which is called whenever the chunk cache
+ *              policy property in the dataset access property list is
+ *              encoded.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dacc_chunk_cache_policy_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5D_chunk_cache_policy_t *policy = (const H5D_chunk_cache_policy_t *)value; /* Create local alias for values */
+    uint8_t **pp = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(policy);
+    HDassert(size);
+
+    if(NULL != *pp)
+        /* Encode chunk cache policy property */
+        *(*pp)++ = (uint8_t)*policy;
+
+    /* Size of chunk cache policy property */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dacc_chunk_cache_policy_enc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dacc_chunk_cache_policy_dec
+ *
+ * Purpose:     Callback routine which is called whenever the chunk cache
+ *              policy property in the dataset access property list is
+ *              decoded.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dacc_chunk_cache_policy_dec(const void **_pp, void *_value)
+{
+    H5D_chunk_cache_policy_t *policy = (H5D_chunk_cache_policy_t *)_value;
+    const uint8_t **pp = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(policy);
+
+    /* Decode chunk cache policy property */
+    *policy = (H5D_chunk_cache_policy_t)*(*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dacc_chunk_cache_policy_dec() */
+
 
 /*-------------------------------------------------------------------------
  * Function:       H5P__encode_chunk_cache_nslots
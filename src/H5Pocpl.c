@@ -1302,6 +1302,47 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_fletcher32() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_crc32c
+ *
+ * Purpose:     Sets CRC32C checksum of EDC for a dataset creation
+ *              property list or group creation property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_crc32c(hid_t plist_id)
+{
+    H5P_genplist_t  *plist;             /* Property list */
+    H5O_pline_t     pline;              /* Filter pipeline */
+    herr_t          ret_value=SUCCEED;  /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", plist_id);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the pipeline property to append to */
+    if(H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the CRC32C checksum as a filter */
+    if(H5Z_append(&pline, H5Z_FILTER_CRC32C, H5Z_FLAG_MANDATORY, (size_t)0, NULL) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add crc32c filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if(H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_crc32c() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5P_get_filter
@@ -741,6 +741,10 @@ H5T__init_package(void)
     if(H5T__init_native() < 0)
 	HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize interface")
 
+    /* Pick the vector kernels for the hard conversions */
+    if(H5T__vec_init() < 0)
+	HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize vector conversion kernels")
+
     /* Get the atomic datatype structures needed by the initialization code below */
     if(NULL == (native_schar = (H5T_t *)H5I_object(H5T_NATIVE_SCHAR_g)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype object")
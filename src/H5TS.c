@@ -37,6 +37,28 @@ H5TS_once_t H5TS_first_init_g = PTHREAD_ONCE_INIT;
 H5TS_key_t H5TS_errstk_key_g;
 H5TS_key_t H5TS_funcstk_key_g;
 H5TS_key_t H5TS_cancel_key_g;
+#ifndef H5_HAVE_WIN_THREADS
+H5TS_key_t H5TS_unlocked_key_g;
+
+/* Pool of worker threads, for spreading work done inside one API call
+ * over several threads (see H5TS_pool_run) */
+typedef struct H5TS_pool_t {
+    pthread_mutex_t lock;               /* Lock protecting the fields below */
+    pthread_cond_t work_cond;           /* Signalled when a job is posted or the pool is stopped */
+    pthread_cond_t done_cond;           /* Signalled when the last worker leaves a job */
+    unsigned nworkers;                  /* # of worker threads started */
+    unsigned nwanted;                   /* # of workers still wanted for the current job */
+    unsigned nactive;                   /* # of workers running the current job */
+    hbool_t busy;                       /* Whether a job is running */
+    hbool_t stop;                       /* Whether the workers should exit */
+    H5TS_pool_func_t func;              /* Routine for the current job */
+    void *udata;                        /* User data for the current job */
+    pthread_t threads[H5TS_POOL_MAX_THREADS];   /* Worker threads */
+} H5TS_pool_t;
+
+static H5TS_pool_t H5TS_pool_g = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+    PTHREAD_COND_INITIALIZER, 0, 0, 0, FALSE, FALSE, NULL, NULL, {0}};
+#endif /* H5_HAVE_WIN_THREADS */
 
 
 /*--------------------------------------------------------------------------
@@ -113,6 +135,10 @@ H5TS_pthread_first_thread_init(void)
 
     /* initialize key for thread cancellability mechanism */
     pthread_key_create(&H5TS_cancel_key_g, H5TS_key_destructor);
+
+    /* initialize key for marking threads running without the API lock
+     * (the value isn't allocated, so there's no destructor) */
+    pthread_key_create(&H5TS_unlocked_key_g, NULL);
 }
 #endif /* H5_HAVE_WIN_THREADS */
 
@@ -216,6 +242,103 @@ H5TS_mutex_unlock(H5TS_mutex_t *mutex)
 #endif /* H5_HAVE_WIN_THREADS */
 } /* H5TS_mutex_unlock */
 
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_release
+ *
+ * USAGE
+ *    H5TS_mutex_release(&mutex_var, &lock_count)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Gives up every level of a recursive lock held by the calling thread,
+ *    returning the recursion depth in *lock_count so that
+ *    H5TS_mutex_reacquire can restore it later.  Until then the thread
+ *    is marked as running without the lock (see H5TS_api_unlocked).
+ *    With Windows threads the depth of a critical section is not
+ *    visible, so the lock is kept and *lock_count is set to zero.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_release(H5TS_mutex_t *mutex, unsigned *lock_count)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    *lock_count = 0;
+    return 0;
+#else  /* H5_HAVE_WIN_THREADS */
+    herr_t ret_value = pthread_mutex_lock(&mutex->atomic_lock);
+
+    if(ret_value)
+        return ret_value;
+
+    *lock_count = mutex->lock_count;
+    mutex->lock_count = 0;
+
+    ret_value = pthread_mutex_unlock(&mutex->atomic_lock);
+
+    if(*lock_count > 0) {
+        int err;
+
+        pthread_setspecific(H5TS_unlocked_key_g, mutex);
+
+        err = pthread_cond_signal(&mutex->cond_var);
+        if(err != 0)
+            ret_value = err;
+    } /* end if */
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_mutex_release */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_reacquire
+ *
+ * USAGE
+ *    H5TS_mutex_reacquire(&mutex_var, lock_count)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Takes back a recursive lock given up by H5TS_mutex_release, waiting
+ *    for any other owner to finish and restoring the saved recursion
+ *    depth.  A lock_count of zero means nothing was released.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_reacquire(H5TS_mutex_t *mutex, unsigned lock_count)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    return 0;
+#else  /* H5_HAVE_WIN_THREADS */
+    herr_t ret_value;
+
+    if(0 == lock_count)
+        return 0;
+
+    if((ret_value = pthread_mutex_lock(&mutex->atomic_lock)))
+        return ret_value;
+
+    /* Wait for the current owner, if any, to let go */
+    while(mutex->lock_count)
+        pthread_cond_wait(&mutex->cond_var, &mutex->atomic_lock);
+
+    mutex->owner_thread = HDpthread_self();
+    mutex->lock_count = lock_count;
+
+    pthread_setspecific(H5TS_unlocked_key_g, NULL);
+
+    return pthread_mutex_unlock(&mutex->atomic_lock);
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_mutex_reacquire */
+
 
 /*--------------------------------------------------------------------------
  * NAME
@@ -509,7 +632,8 @@ H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata)
 
 #else /* H5_HAVE_WIN_THREADS */
 
-    pthread_create(&ret_value, attr, (void * (*)(void *))func, udata);
+    if(pthread_create(&ret_value, attr, (void * (*)(void *))func, udata) != 0)
+        HDmemset(&ret_value, 0, sizeof(ret_value));
 
 #endif /* H5_HAVE_WIN_THREADS */
 
@@ -517,4 +641,199 @@ H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata)
 
 } /* H5TS_create_thread */
 
+#ifndef H5_HAVE_WIN_THREADS
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_worker
+ *
+ * RETURNS
+ *    NULL (always)
+ *
+ * DESCRIPTION
+ *    Thread routine for the threads in the worker pool: waits for a job to
+ *    be posted, runs its routine and goes back to waiting, until the pool
+ *    is stopped.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void *
+H5TS_pool_worker(void H5_ATTR_UNUSED *arg)
+{
+    H5TS_pool_t *pool = &H5TS_pool_g;
+
+    /* Mark this thread as running without the API lock, so it doesn't
+     * push errors */
+    pthread_setspecific(H5TS_unlocked_key_g, pool);
+
+    pthread_mutex_lock(&pool->lock);
+    for(;;) {
+        H5TS_pool_func_t func;
+        void *udata;
+
+        while(!pool->stop && 0 == pool->nwanted)
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        if(pool->stop)
+            break;
+
+        /* Join the current job */
+        pool->nwanted--;
+        pool->nactive++;
+        func = pool->func;
+        udata = pool->udata;
+        pthread_mutex_unlock(&pool->lock);
+
+        (*func)(udata);
+
+        pthread_mutex_lock(&pool->lock);
+        if(0 == --pool->nactive && 0 == pool->nwanted)
+            pthread_cond_broadcast(&pool->done_cond);
+    } /* end for */
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+} /* H5TS_pool_worker */
+#endif /* H5_HAVE_WIN_THREADS */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_run
+ *
+ * USAGE
+ *    H5TS_pool_run(nthreads, func, udata)
+ *
+ * RETURNS
+ *    # of threads that ran 'func', including the calling thread.
+ *
+ * DESCRIPTION
+ *    Runs 'func' with input 'udata' on up to 'nthreads' threads at once:
+ *    the calling thread and workers from a pool of threads that are kept
+ *    around between calls.  Returns once every thread has returned from
+ *    'func'.
+ *
+ *    'func' must loop, claiming items from a shared queue of work in
+ *    'udata' until there are none left, since workers that haven't
+ *    started by the time the calling thread has finished are not run.
+ *    It must not push errors or touch library state that isn't protected
+ *    by a lock of its own, since the workers run outside the API lock.
+ *
+ *    When no worker is free, no more threads can be started, or the
+ *    platform has no pool, 'func' just runs in the calling thread.
+ *
+ *--------------------------------------------------------------------------
+ */
+unsigned
+H5TS_pool_run(unsigned nthreads, H5TS_pool_func_t func, void *udata)
+{
+#ifndef H5_HAVE_WIN_THREADS
+    H5TS_pool_t *pool = &H5TS_pool_g;
+    unsigned nuse = 0;                  /* # of workers used */
+
+    /* Post the job, starting more workers if needed */
+    if(nthreads > 1) {
+        pthread_mutex_lock(&pool->lock);
+        if(!pool->busy && !pool->stop) {
+            nuse = MIN(nthreads - 1, H5TS_POOL_MAX_THREADS);
+            while(pool->nworkers < nuse) {
+                if(pthread_create(&pool->threads[pool->nworkers], NULL, H5TS_pool_worker, NULL) != 0)
+                    break;
+                pool->nworkers++;
+            } /* end while */
+            nuse = MIN(nuse, pool->nworkers);
+            if(nuse > 0) {
+                pool->busy = TRUE;
+                pool->func = func;
+                pool->udata = udata;
+                pool->nwanted = nuse;
+                pthread_cond_broadcast(&pool->work_cond);
+            } /* end if */
+        } /* end if */
+        pthread_mutex_unlock(&pool->lock);
+    } /* end if */
+
+    /* Take a share of the work in this thread */
+    (*func)(udata);
+
+    /* Wait for the workers that joined the job */
+    if(nuse > 0) {
+        unsigned nlate;                 /* # of workers that didn't join */
+
+        pthread_mutex_lock(&pool->lock);
+        nlate = pool->nwanted;
+        pool->nwanted = 0;
+        while(pool->nactive > 0)
+            pthread_cond_wait(&pool->done_cond, &pool->lock);
+        pool->busy = FALSE;
+        pool->func = NULL;
+        pool->udata = NULL;
+        pthread_mutex_unlock(&pool->lock);
+        nuse -= nlate;
+    } /* end if */
+
+    return nuse + 1;
+#else /* H5_HAVE_WIN_THREADS */
+    (*func)(udata);
+
+    return 1;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_pool_run */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_unlocked
+ *
+ * RETURNS
+ *    TRUE if the calling thread is running library code without holding
+ *    the API lock: it is a worker from the pool, or it gave the lock up
+ *    with H5TS_mutex_release.  FALSE otherwise.
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_api_unlocked(void)
+{
+#ifndef H5_HAVE_WIN_THREADS
+    return (hbool_t)(NULL != pthread_getspecific(H5TS_unlocked_key_g));
+#else /* H5_HAVE_WIN_THREADS */
+    return FALSE;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_api_unlocked */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_pool_term
+ *
+ * DESCRIPTION
+ *    Stops the threads in the worker pool and waits for them to exit.
+ *    Called when the library is shut down, with no job running.  The pool
+ *    is started again if it is needed afterwards.
+ *
+ *--------------------------------------------------------------------------
+ */
+void
+H5TS_pool_term(void)
+{
+#ifndef H5_HAVE_WIN_THREADS
+    H5TS_pool_t *pool = &H5TS_pool_g;
+    unsigned u;
+
+    pthread_mutex_lock(&pool->lock);
+    HDassert(!pool->busy);
+    pool->stop = TRUE;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for(u = 0; u < pool->nworkers; u++)
+        pthread_join(pool->threads[u], NULL);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->nworkers = 0;
+    pool->stop = FALSE;
+    pthread_mutex_unlock(&pool->lock);
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_pool_term */
+
 #endif  /* H5_HAVE_THREADSAFE */
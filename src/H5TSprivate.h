@@ -61,6 +61,7 @@ typedef INIT_ONCE H5TS_once_t;
 #define H5TS_attr_destroy(attr_ptr) 0
 #define H5TS_wait_for_thread(thread) WaitForSingleObject(thread, INFINITE)
 #define H5TS_mutex_init(mutex) InitializeCriticalSection(mutex)
+#define H5TS_mutex_destroy(mutex) DeleteCriticalSection(mutex)
 #define H5TS_mutex_lock_simple(mutex) EnterCriticalSection(mutex)
 #define H5TS_mutex_unlock_simple(mutex) LeaveCriticalSection(mutex)
 
@@ -102,11 +103,18 @@ typedef pthread_once_t H5TS_once_t;
 #define H5TS_attr_destroy(attr_ptr) pthread_attr_destroy(attr_ptr)
 #define H5TS_wait_for_thread(thread) pthread_join(thread, NULL)
 #define H5TS_mutex_init(mutex) pthread_mutex_init(mutex, NULL)
+#define H5TS_mutex_destroy(mutex) pthread_mutex_destroy(mutex)
 #define H5TS_mutex_lock_simple(mutex) pthread_mutex_lock(mutex)
 #define H5TS_mutex_unlock_simple(mutex) pthread_mutex_unlock(mutex)
 
 #endif /* H5_HAVE_WIN_THREADS */
 
+/* Largest # of threads in the worker pool */
+#define H5TS_POOL_MAX_THREADS   64
+
+/* Routine run by the threads in the worker pool */
+typedef void (*H5TS_pool_func_t)(void *udata);
+
 /* External global variables */
 extern H5TS_once_t H5TS_first_init_g;
 extern H5TS_key_t H5TS_errstk_key_g;
@@ -120,9 +128,14 @@ extern      "C"
 H5_DLL void   H5TS_pthread_first_thread_init(void);
 H5_DLL herr_t H5TS_mutex_lock(H5TS_mutex_t *mutex);
 H5_DLL herr_t H5TS_mutex_unlock(H5TS_mutex_t *mutex);
+H5_DLL herr_t H5TS_mutex_release(H5TS_mutex_t *mutex, unsigned *lock_count);
+H5_DLL herr_t H5TS_mutex_reacquire(H5TS_mutex_t *mutex, unsigned lock_count);
 H5_DLL herr_t H5TS_cancel_count_inc(void);
 H5_DLL herr_t H5TS_cancel_count_dec(void);
 H5_DLL H5TS_thread_t H5TS_create_thread(void *(*func)(void *), H5TS_attr_t * attr, void *udata);
+H5_DLL unsigned H5TS_pool_run(unsigned nthreads, H5TS_pool_func_t func, void *udata);
+H5_DLL hbool_t H5TS_api_unlocked(void);
+H5_DLL void   H5TS_pool_term(void);
 
 #if defined c_plusplus || defined __cplusplus
 }
@@ -738,6 +738,13 @@
 									      \
         H5T_CONV_SET_PREC(PREC)            /*init precision variables, or not */ \
                                                                               \
+        /* Packed buffers without an exception callback may use a vector */   \
+        /* kernel, if there is one for this pair of types */                  \
+        if((0 == buf_stride || (buf_stride == sizeof(ST) && buf_stride == sizeof(DT))) && \
+                NULL == cb_struct.func &&                                     \
+                H5T__vec_conv(H5T_VEC_##STYPE, H5T_VEC_##DTYPE, buf, nelmts)) \
+            break;                                                            \
+                                                                              \
         /* The outer loop of the type conversion macro, controlling which */  \
         /* direction the buffer is walked */				      \
         while (nelmts>0) {						      \
@@ -1180,6 +1187,11 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
             } /* end if */
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
+
+            /* Use a vector kernel for packed elements */
+            if(buf_stride == src->shared->size && H5T__vec_swap(buf, buf_stride, nelmts))
+                break;
+
             switch(src->shared->size) {
                 case 1:
                     /*no-op*/
@@ -325,6 +325,24 @@ typedef enum H5T_sdir_t {
     H5T_BIT_MSB				/*search msb toward lsb		     */
 } H5T_sdir_t;
 
+/* Native types named by the hard conversion routines, for the vector
+ * conversion kernels in H5Tvec.c */
+typedef enum H5T_vec_type_t {
+    H5T_VEC_SCHAR,
+    H5T_VEC_UCHAR,
+    H5T_VEC_SHORT,
+    H5T_VEC_USHORT,
+    H5T_VEC_INT,
+    H5T_VEC_UINT,
+    H5T_VEC_LONG,
+    H5T_VEC_ULONG,
+    H5T_VEC_LLONG,
+    H5T_VEC_ULLONG,
+    H5T_VEC_FLOAT,
+    H5T_VEC_DOUBLE,
+    H5T_VEC_LDOUBLE
+} H5T_vec_type_t;
+
 /* Typedef for named datatype creation operation */
 typedef struct {
     H5T_t *dt;                  /* Datatype to commit */
@@ -435,6 +453,12 @@ H5_DLL herr_t H5T__visit(H5T_t *dt, unsigned visit_flags, H5T_operator_t op,
     void *op_value);
 H5_DLL herr_t H5T__upgrade_version(H5T_t *dt, unsigned new_version);
 
+/* Vector conversion kernels */
+H5_DLL herr_t H5T__vec_init(void);
+H5_DLL hbool_t H5T__vec_swap(void *buf, size_t size, size_t nelmts);
+H5_DLL hbool_t H5T__vec_conv(H5T_vec_type_t src, H5T_vec_type_t dst,
+    void *buf, size_t nelmts);
+
 /* Conversion functions */
 H5_DLL herr_t H5T__conv_noop(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
 			    size_t nelmts, size_t buf_stride,
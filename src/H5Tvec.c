@@ -0,0 +1,577 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Module Info: Vectorized kernels for the hard datatype conversions and
+ *      the byte order conversion in H5Tconv.c.  The kernels only work on
+ *      packed buffers and are only used when no conversion exception
+ *      callback is set, so they give the same results as the "no
+ *      exception" loops they replace.
+ *
+ *      SSE2 kernels are used on every x86-64 system.  AVX2 kernels are
+ *      compiled in when the compiler supports per-function target
+ *      attributes and are selected at run time when the CPU has AVX2.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Tmodule.h"          /* This source code file is part of the H5T module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Tpkg.h"		/* Datatypes				*/
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define H5T_VEC_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) && (defined(__clang__) || (__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define H5T_VEC_AVX2
+#include <immintrin.h>
+#endif /* __GNUC__ */
+#endif /* __x86_64__ */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Attribute for functions using AVX2 instructions */
+#define H5T_VEC_AVX2_ATTR       __attribute__((target("avx2")))
+
+/* Convert a packed, in-place buffer of NELMTS elements from ST to DT,
+ * VEC_N elements at a time with VEC_BLOCK(S, D) and the remainder with
+ * ONE(ST, DT, BUF, I).  Widening conversions walk backward through the
+ * buffer and narrowing ones walk forward, which keeps each block's
+ * destination clear of source elements that have not been converted yet.
+ */
+#define H5T_VEC_CONV_LOOP(ST, DT, VEC_N, VEC_BLOCK, ONE, BUF, NELMTS) {      \
+    uint8_t *_buf = (uint8_t *)(BUF);                                         \
+    size_t _n = (NELMTS);                                                     \
+    size_t _nvec = _n - (_n % (VEC_N));                                       \
+    size_t _i;                                                                \
+                                                                              \
+    if(sizeof(DT) > sizeof(ST)) {                                             \
+        for(_i = _n; _i > _nvec; _i--)                                        \
+            ONE(ST, DT, _buf, _i - 1)                                         \
+        for(_i = _nvec; _i > 0; _i -= (VEC_N))                                \
+            VEC_BLOCK(_buf + (_i - (VEC_N)) * sizeof(ST), _buf + (_i - (VEC_N)) * sizeof(DT)) \
+    } /* end if */                                                            \
+    else {                                                                    \
+        for(_i = 0; _i < _nvec; _i += (VEC_N))                                \
+            VEC_BLOCK(_buf + _i * sizeof(ST), _buf + _i * sizeof(DT))         \
+        for(_i = _nvec; _i < _n; _i++)                                        \
+            ONE(ST, DT, _buf, _i)                                             \
+    } /* end else */                                                          \
+}
+
+/* Convert element I of a packed, in-place buffer with a cast */
+#define H5T_VEC_CONV_ONE(ST, DT, BUF, I) {                                    \
+    ST _s;                                                                    \
+    DT _d;                                                                    \
+                                                                              \
+    HDmemcpy(&_s, (BUF) + (I) * sizeof(ST), sizeof(ST));                      \
+    _d = (DT)_s;                                                              \
+    HDmemcpy((BUF) + (I) * sizeof(DT), &_d, sizeof(DT));                      \
+}
+
+/* Convert element I of a packed, in-place buffer of doubles to float,
+ * turning values out of the range of float into infinities like the
+ * vector blocks do */
+#define H5T_VEC_CONV_ONE_DOUBLE_FLOAT(ST, DT, BUF, I) {                       \
+    double _s;                                                                \
+    float _d;                                                                 \
+                                                                              \
+    HDmemcpy(&_s, (BUF) + (I) * sizeof(double), sizeof(double));              \
+    if(_s > (double)FLT_MAX)                                                  \
+        _d = H5T_NATIVE_FLOAT_POS_INF_g;                                      \
+    else if(_s < -(double)FLT_MAX)                                            \
+        _d = H5T_NATIVE_FLOAT_NEG_INF_g;                                      \
+    else                                                                      \
+        _d = (float)_s;                                                       \
+    HDmemcpy((BUF) + (I) * sizeof(float), &_d, sizeof(float));                \
+}
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Instruction sets available for the kernels */
+typedef enum H5T_vec_isa_t {
+    H5T_VEC_ISA_NONE = 0,       /* No vector kernels */
+    H5T_VEC_ISA_SSE2,           /* SSE2 kernels */
+    H5T_VEC_ISA_AVX2            /* AVX2 kernels */
+} H5T_vec_isa_t;
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+#ifdef H5T_VEC_SSE2
+static void H5T__vec_swap_sse2(uint8_t *buf, size_t size, size_t nelmts);
+static hbool_t H5T__vec_conv_sse2(H5T_vec_type_t src, H5T_vec_type_t dst,
+    void *buf, size_t nelmts);
+#endif /* H5T_VEC_SSE2 */
+#ifdef H5T_VEC_AVX2
+static void H5T__vec_swap_avx2(uint8_t *buf, size_t size, size_t nelmts) H5T_VEC_AVX2_ATTR;
+static hbool_t H5T__vec_conv_avx2(H5T_vec_type_t src, H5T_vec_type_t dst,
+    void *buf, size_t nelmts) H5T_VEC_AVX2_ATTR;
+#endif /* H5T_VEC_AVX2 */
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Best instruction set for the kernels on this CPU, set by H5T__vec_init() */
+static H5T_vec_isa_t H5T_vec_isa_g = H5T_VEC_ISA_NONE;
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vec_init
+ *
+ * Purpose:	Picks the instruction set used by the vector kernels,
+ *		based on what the CPU supports.  Setting the environment
+ *		variable HDF5_NO_SIMD_CONV turns the kernels off.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__vec_init(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    H5T_vec_isa_g = H5T_VEC_ISA_NONE;
+    if(NULL == HDgetenv("HDF5_NO_SIMD_CONV")) {
+#ifdef H5T_VEC_SSE2
+        H5T_vec_isa_g = H5T_VEC_ISA_SSE2;
+#endif /* H5T_VEC_SSE2 */
+#ifdef H5T_VEC_AVX2
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2"))
+            H5T_vec_isa_g = H5T_VEC_ISA_AVX2;
+#endif /* H5T_VEC_AVX2 */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5T__vec_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vec_swap
+ *
+ * Purpose:	Reverses the byte order of each of the NELMTS packed
+ *		SIZE-byte elements in BUF, for H5T__conv_order_opt.
+ *
+ * Return:	TRUE if the elements were swapped, FALSE if there is no
+ *		vector kernel for SIZE and the caller must swap them.
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5T__vec_swap(void *buf, size_t size, size_t nelmts)
+{
+    hbool_t ret_value = FALSE;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if(size != 2 && size != 4 && size != 8)
+        HGOTO_DONE(FALSE)
+
+    switch(H5T_vec_isa_g) {
+#ifdef H5T_VEC_AVX2
+        case H5T_VEC_ISA_AVX2:
+            H5T__vec_swap_avx2((uint8_t *)buf, size, nelmts);
+            ret_value = TRUE;
+            break;
+#endif /* H5T_VEC_AVX2 */
+
+#ifdef H5T_VEC_SSE2
+        case H5T_VEC_ISA_SSE2:
+            H5T__vec_swap_sse2((uint8_t *)buf, size, nelmts);
+            ret_value = TRUE;
+            break;
+#endif /* H5T_VEC_SSE2 */
+
+        case H5T_VEC_ISA_NONE:
+        default:
+            break;
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vec_swap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vec_conv
+ *
+ * Purpose:	Converts NELMTS packed elements in BUF from native type SRC
+ *		to native type DST in place, for the hard conversion
+ *		routines.  Results match the conversion without an
+ *		exception callback.
+ *
+ * Return:	TRUE if the elements were converted, FALSE if there is no
+ *		vector kernel for the pair and the caller must convert them.
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5T__vec_conv(H5T_vec_type_t src, H5T_vec_type_t dst, void *buf, size_t nelmts)
+{
+    hbool_t ret_value = FALSE;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    switch(H5T_vec_isa_g) {
+#ifdef H5T_VEC_AVX2
+        case H5T_VEC_ISA_AVX2:
+            ret_value = H5T__vec_conv_avx2(src, dst, buf, nelmts);
+            break;
+#endif /* H5T_VEC_AVX2 */
+
+#ifdef H5T_VEC_SSE2
+        case H5T_VEC_ISA_SSE2:
+            ret_value = H5T__vec_conv_sse2(src, dst, buf, nelmts);
+            break;
+#endif /* H5T_VEC_SSE2 */
+
+        case H5T_VEC_ISA_NONE:
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vec_conv() */
+
+#ifdef H5T_VEC_SSE2
+
+/* Swap the bytes of each 16-bit lane */
+#define H5T_VEC_SSE2_SWAP16(V)                                                \
+    _mm_or_si128(_mm_slli_epi16((V), 8), _mm_srli_epi16((V), 8))
+
+/* Swap the bytes of each 32-bit lane */
+#define H5T_VEC_SSE2_SWAP32(V)                                                \
+    H5T_VEC_SSE2_SWAP16(_mm_shufflehi_epi16(_mm_shufflelo_epi16((V), 0xB1), 0xB1))
+
+/* Swap the bytes of each 64-bit lane */
+#define H5T_VEC_SSE2_SWAP64(V)                                                \
+    H5T_VEC_SSE2_SWAP16(_mm_shufflehi_epi16(_mm_shufflelo_epi16((V), 0x1B), 0x1B))
+
+/* Conversion blocks, each reading all of its sources before any store */
+#define H5T_VEC_SSE2_SHORT_FLOAT(S, D) {                                      \
+    __m128i _v = _mm_loadu_si128((const __m128i *)(S));                       \
+    __m128i _lo = _mm_srai_epi32(_mm_unpacklo_epi16(_v, _v), 16);             \
+    __m128i _hi = _mm_srai_epi32(_mm_unpackhi_epi16(_v, _v), 16);             \
+                                                                              \
+    _mm_storeu_ps((float *)(D), _mm_cvtepi32_ps(_lo));                        \
+    _mm_storeu_ps((float *)(D) + 4, _mm_cvtepi32_ps(_hi));                    \
+}
+#define H5T_VEC_SSE2_USHORT_FLOAT(S, D) {                                     \
+    __m128i _v = _mm_loadu_si128((const __m128i *)(S));                       \
+    __m128i _lo = _mm_unpacklo_epi16(_v, _mm_setzero_si128());                \
+    __m128i _hi = _mm_unpackhi_epi16(_v, _mm_setzero_si128());                \
+                                                                              \
+    _mm_storeu_ps((float *)(D), _mm_cvtepi32_ps(_lo));                        \
+    _mm_storeu_ps((float *)(D) + 4, _mm_cvtepi32_ps(_hi));                    \
+}
+#define H5T_VEC_SSE2_INT_FLOAT(S, D) {                                        \
+    __m128i _v = _mm_loadu_si128((const __m128i *)(S));                       \
+                                                                              \
+    _mm_storeu_ps((float *)(D), _mm_cvtepi32_ps(_v));                         \
+}
+#define H5T_VEC_SSE2_INT_DOUBLE(S, D) {                                       \
+    __m128i _v = _mm_loadu_si128((const __m128i *)(S));                       \
+    __m128d _lo = _mm_cvtepi32_pd(_v);                                        \
+    __m128d _hi = _mm_cvtepi32_pd(_mm_srli_si128(_v, 8));                     \
+                                                                              \
+    _mm_storeu_pd((double *)(D), _lo);                                        \
+    _mm_storeu_pd((double *)(D) + 2, _hi);                                    \
+}
+#define H5T_VEC_SSE2_FLOAT_DOUBLE(S, D) {                                     \
+    __m128 _v = _mm_loadu_ps((const float *)(S));                             \
+    __m128d _lo = _mm_cvtps_pd(_v);                                           \
+    __m128d _hi = _mm_cvtps_pd(_mm_movehl_ps(_v, _v));                        \
+                                                                              \
+    _mm_storeu_pd((double *)(D), _lo);                                        \
+    _mm_storeu_pd((double *)(D) + 2, _hi);                                    \
+}
+
+/* Values out of the range of float become infinities, as in the "no
+ * exception" core, rather than whatever rounding gives */
+#define H5T_VEC_SSE2_DOUBLE_FLOAT(S, D) {                                     \
+    __m128d _lo = _mm_loadu_pd((const double *)(S));                          \
+    __m128d _hi = _mm_loadu_pd((const double *)(S) + 2);                      \
+    __m128d _max = _mm_set1_pd((double)FLT_MAX);                              \
+    __m128d _min = _mm_set1_pd(-(double)FLT_MAX);                             \
+    int _over = _mm_movemask_pd(_mm_or_pd(_mm_cmpgt_pd(_lo, _max), _mm_cmplt_pd(_lo, _min))) | \
+            (_mm_movemask_pd(_mm_or_pd(_mm_cmpgt_pd(_hi, _max), _mm_cmplt_pd(_hi, _min))) << 2); \
+    __m128 _f = _mm_movelh_ps(_mm_cvtpd_ps(_lo), _mm_cvtpd_ps(_hi));          \
+                                                                              \
+    _mm_storeu_ps((float *)(D), _f);                                          \
+    if(_over) {                                                               \
+        double _s[4];                                                         \
+        float _d;                                                             \
+        unsigned _u;                                                          \
+                                                                              \
+        _mm_storeu_pd(_s, _lo);                                               \
+        _mm_storeu_pd(_s + 2, _hi);                                           \
+        for(_u = 0; _u < 4; _u++)                                             \
+            if(_over & (1 << _u)) {                                           \
+                _d = _s[_u] > 0 ? H5T_NATIVE_FLOAT_POS_INF_g : H5T_NATIVE_FLOAT_NEG_INF_g; \
+                HDmemcpy((uint8_t *)(D) + _u * sizeof(float), &_d, sizeof(float)); \
+            } /* end if */                                                    \
+    } /* end if */                                                            \
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vec_swap_sse2
+ *
+ * Purpose:	SSE2 version of H5T__vec_swap.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__vec_swap_sse2(uint8_t *buf, size_t size, size_t nelmts)
+{
+    size_t nbytes = size * nelmts;      /* Bytes to swap */
+    size_t nvec = nbytes & ~(size_t)15; /* Bytes to swap with vectors */
+    size_t u;                           /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + u));
+
+        if(2 == size)
+            v = H5T_VEC_SSE2_SWAP16(v);
+        else if(4 == size)
+            v = H5T_VEC_SSE2_SWAP32(v);
+        else
+            v = H5T_VEC_SSE2_SWAP64(v);
+        _mm_storeu_si128((__m128i *)(buf + u), v);
+    } /* end for */
+
+    /* Swap the remaining elements one at a time */
+    for(/*void*/; u < nbytes; u += size) {
+        uint8_t tmp;
+        size_t lo, hi;
+
+        for(lo = u, hi = u + size - 1; lo < hi; lo++, hi--) {
+            tmp = buf[lo];
+            buf[lo] = buf[hi];
+            buf[hi] = tmp;
+        } /* end for */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__vec_swap_sse2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vec_conv_sse2
+ *
+ * Purpose:	SSE2 version of H5T__vec_conv.
+ *
+ * Return:	TRUE if the elements were converted, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5T__vec_conv_sse2(H5T_vec_type_t src, H5T_vec_type_t dst, void *buf,
+    size_t nelmts)
+{
+    hbool_t ret_value = TRUE;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDcompile_assert(sizeof(short) == 2 && sizeof(int) == 4);
+
+    if(H5T_VEC_SHORT == src && H5T_VEC_FLOAT == dst)
+        H5T_VEC_CONV_LOOP(short, float, 8, H5T_VEC_SSE2_SHORT_FLOAT, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_USHORT == src && H5T_VEC_FLOAT == dst)
+        H5T_VEC_CONV_LOOP(unsigned short, float, 8, H5T_VEC_SSE2_USHORT_FLOAT, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_INT == src && H5T_VEC_FLOAT == dst)
+        H5T_VEC_CONV_LOOP(int, float, 4, H5T_VEC_SSE2_INT_FLOAT, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_INT == src && H5T_VEC_DOUBLE == dst)
+        H5T_VEC_CONV_LOOP(int, double, 4, H5T_VEC_SSE2_INT_DOUBLE, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_FLOAT == src && H5T_VEC_DOUBLE == dst)
+        H5T_VEC_CONV_LOOP(float, double, 4, H5T_VEC_SSE2_FLOAT_DOUBLE, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_DOUBLE == src && H5T_VEC_FLOAT == dst)
+        H5T_VEC_CONV_LOOP(double, float, 4, H5T_VEC_SSE2_DOUBLE_FLOAT, H5T_VEC_CONV_ONE_DOUBLE_FLOAT, buf, nelmts)
+    else
+        ret_value = FALSE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vec_conv_sse2() */
+#endif /* H5T_VEC_SSE2 */
+
+#ifdef H5T_VEC_AVX2
+
+/* Conversion blocks, each reading all of its sources before any store */
+#define H5T_VEC_AVX2_SHORT_FLOAT(S, D) {                                      \
+    __m256i _v = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(S))); \
+                                                                              \
+    _mm256_storeu_ps((float *)(D), _mm256_cvtepi32_ps(_v));                   \
+}
+#define H5T_VEC_AVX2_USHORT_FLOAT(S, D) {                                     \
+    __m256i _v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(S))); \
+                                                                              \
+    _mm256_storeu_ps((float *)(D), _mm256_cvtepi32_ps(_v));                   \
+}
+#define H5T_VEC_AVX2_INT_FLOAT(S, D) {                                        \
+    __m256i _v = _mm256_loadu_si256((const __m256i *)(S));                    \
+                                                                              \
+    _mm256_storeu_ps((float *)(D), _mm256_cvtepi32_ps(_v));                   \
+}
+#define H5T_VEC_AVX2_INT_DOUBLE(S, D) {                                       \
+    __m128i _v = _mm_loadu_si128((const __m128i *)(S));                       \
+                                                                              \
+    _mm256_storeu_pd((double *)(D), _mm256_cvtepi32_pd(_v));                  \
+}
+#define H5T_VEC_AVX2_FLOAT_DOUBLE(S, D) {                                     \
+    __m128 _v = _mm_loadu_ps((const float *)(S));                             \
+                                                                              \
+    _mm256_storeu_pd((double *)(D), _mm256_cvtps_pd(_v));                     \
+}
+#define H5T_VEC_AVX2_DOUBLE_FLOAT(S, D) {                                     \
+    __m256d _v = _mm256_loadu_pd((const double *)(S));                        \
+    int _over = _mm256_movemask_pd(_mm256_or_pd(                              \
+            _mm256_cmp_pd(_v, _mm256_set1_pd((double)FLT_MAX), _CMP_GT_OQ),   \
+            _mm256_cmp_pd(_v, _mm256_set1_pd(-(double)FLT_MAX), _CMP_LT_OQ))); \
+                                                                              \
+    _mm_storeu_ps((float *)(D), _mm256_cvtpd_ps(_v));                         \
+    if(_over) {                                                               \
+        double _s[4];                                                         \
+        float _d;                                                             \
+        unsigned _u;                                                          \
+                                                                              \
+        _mm256_storeu_pd(_s, _v);                                             \
+        for(_u = 0; _u < 4; _u++)                                             \
+            if(_over & (1 << _u)) {                                           \
+                _d = _s[_u] > 0 ? H5T_NATIVE_FLOAT_POS_INF_g : H5T_NATIVE_FLOAT_NEG_INF_g; \
+                HDmemcpy((uint8_t *)(D) + _u * sizeof(float), &_d, sizeof(float)); \
+            } /* end if */                                                    \
+    } /* end if */                                                            \
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vec_swap_avx2
+ *
+ * Purpose:	AVX2 version of H5T__vec_swap.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__vec_swap_avx2(uint8_t *buf, size_t size, size_t nelmts)
+{
+    size_t nbytes = size * nelmts;      /* Bytes to swap */
+    size_t nvec = nbytes & ~(size_t)31; /* Bytes to swap with vectors */
+    __m256i mask;                       /* Byte shuffle for one element size */
+    size_t u;                           /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(2 == size)
+        mask = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    else if(4 == size)
+        mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    else
+        mask = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    for(u = 0; u < nvec; u += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(buf + u));
+
+        _mm256_storeu_si256((__m256i *)(buf + u), _mm256_shuffle_epi8(v, mask));
+    } /* end for */
+
+    /* Swap the remaining elements one at a time */
+    for(/*void*/; u < nbytes; u += size) {
+        uint8_t tmp;
+        size_t lo, hi;
+
+        for(lo = u, hi = u + size - 1; lo < hi; lo++, hi--) {
+            tmp = buf[lo];
+            buf[lo] = buf[hi];
+            buf[hi] = tmp;
+        } /* end for */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__vec_swap_avx2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vec_conv_avx2
+ *
+ * Purpose:	AVX2 version of H5T__vec_conv.
+ *
+ * Return:	TRUE if the elements were converted, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5T__vec_conv_avx2(H5T_vec_type_t src, H5T_vec_type_t dst, void *buf,
+    size_t nelmts)
+{
+    hbool_t ret_value = TRUE;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5T_VEC_SHORT == src && H5T_VEC_FLOAT == dst)
+        H5T_VEC_CONV_LOOP(short, float, 8, H5T_VEC_AVX2_SHORT_FLOAT, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_USHORT == src && H5T_VEC_FLOAT == dst)
+        H5T_VEC_CONV_LOOP(unsigned short, float, 8, H5T_VEC_AVX2_USHORT_FLOAT, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_INT == src && H5T_VEC_FLOAT == dst)
+        H5T_VEC_CONV_LOOP(int, float, 8, H5T_VEC_AVX2_INT_FLOAT, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_INT == src && H5T_VEC_DOUBLE == dst)
+        H5T_VEC_CONV_LOOP(int, double, 4, H5T_VEC_AVX2_INT_DOUBLE, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_FLOAT == src && H5T_VEC_DOUBLE == dst)
+        H5T_VEC_CONV_LOOP(float, double, 4, H5T_VEC_AVX2_FLOAT_DOUBLE, H5T_VEC_CONV_ONE, buf, nelmts)
+    else if(H5T_VEC_DOUBLE == src && H5T_VEC_FLOAT == dst)
+        H5T_VEC_CONV_LOOP(double, float, 4, H5T_VEC_AVX2_DOUBLE_FLOAT, H5T_VEC_CONV_ONE_DOUBLE_FLOAT, buf, nelmts)
+    else
+        ret_value = FALSE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vec_conv_avx2() */
+#endif /* H5T_VEC_AVX2 */
@@ -49,6 +49,35 @@ typedef herr_t (*H5VM_opvv_func_t)(hsize_t dst_off, hsize_t src_off,
 
 #define H5VM_vector_zero(N,DST) HDmemset(DST,0,(N)*sizeof(*(DST)))
 
+/* Move the coordinate for the unlimited dimension to the front of an array,
+ *      so that it becomes the slowest-changing dimension */
+#define H5VM_swizzle_coords(TYPE, COORDS, UNLIM_DIM) {                        \
+    /* COORDS must be an array of type TYPE */                                \
+    HDassert(sizeof(COORDS[0]) == sizeof(TYPE));                              \
+                                                                              \
+    /* Nothing to do when unlimited dimension is at position 0 */             \
+    if(0 != (UNLIM_DIM)) {                                                    \
+        TYPE _tmp = (COORDS)[UNLIM_DIM];                                      \
+                                                                              \
+        HDmemmove(&(COORDS)[1], &(COORDS)[0], sizeof(TYPE) * (UNLIM_DIM));    \
+        (COORDS)[0] = _tmp;                                                   \
+    } /* end if */                                                            \
+}
+
+/* Inverse of H5VM_swizzle_coords() */
+#define H5VM_unswizzle_coords(TYPE, COORDS, UNLIM_DIM) {                      \
+    /* COORDS must be an array of type TYPE */                                \
+    HDassert(sizeof(COORDS[0]) == sizeof(TYPE));                              \
+                                                                              \
+    /* Nothing to do when unlimited dimension is at position 0 */             \
+    if(0 != (UNLIM_DIM)) {                                                    \
+        TYPE _tmp = (COORDS)[0];                                              \
+                                                                              \
+        HDmemmove(&(COORDS)[0], &(COORDS)[1], sizeof(TYPE) * (UNLIM_DIM));    \
+        (COORDS)[UNLIM_DIM] = _tmp;                                           \
+    } /* end if */                                                            \
+}
+
 /* A null pointer is equivalent to a zero vector */
 #define H5VM_ZERO        NULL
 
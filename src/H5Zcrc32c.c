@@ -0,0 +1,132 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	An error detection filter storing the CRC32C checksum of
+ *		each chunk after the chunk, like the Fletcher32 filter.
+ *		CRC32C is computed with the SSE4.2 crc32 instruction when
+ *		the CPU has it, and detects more errors than Fletcher32.
+ */
+
+#include "H5Zmodule.h"          /* This source code file is part of the H5Z module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"         /* File access                          */
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Zpkg.h"		/* Data filters				*/
+
+/* Local function prototypes */
+static size_t H5Z_filter_crc32c(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_CRC32C[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    H5Z_FILTER_CRC32C,		/* Filter id number		*/
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "crc32c",			/* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    H5Z_filter_crc32c,		/* The actual filter function	*/
+}};
+
+#define CRC32C_LEN       4
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_filter_crc32c
+ *
+ * Purpose:	Implement an I/O filter of CRC32C Checksum
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z_filter_crc32c(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts, const unsigned H5_ATTR_UNUSED cd_values[],
+                     size_t nbytes, size_t *buf_size, void **buf)
+{
+    void    *outbuf = NULL;     /* Pointer to new buffer */
+    unsigned char *src = (unsigned char*)(*buf);
+    uint32_t crc;               /* Checksum value */
+    size_t   ret_value = 0;     /* Return value */
+
+    FUNC_ENTER_NOAPI(0)
+
+    if (flags & H5Z_FLAG_REVERSE) { /* Read */
+        if(nbytes < CRC32C_LEN)
+            HGOTO_ERROR(H5E_STORAGE, H5E_READERROR, 0, "chunk too small to hold a CRC32C checksum")
+
+        /* Do checksum if it's enabled for read; otherwise skip it
+         * to save performance. */
+        if (!(flags & H5Z_FLAG_SKIP_EDC)) {
+            unsigned char *tmp_src;             /* Pointer to checksum in buffer */
+            size_t  src_nbytes = nbytes;        /* Original number of bytes */
+            uint32_t stored_crc;                /* Stored checksum value */
+
+            /* Get the stored checksum */
+            src_nbytes -= CRC32C_LEN;
+            tmp_src = src + src_nbytes;
+            UINT32DECODE(tmp_src, stored_crc);
+
+            /* Compute checksum (can't fail) */
+            crc = src_nbytes > 0 ? H5_checksum_crc32c(src, src_nbytes) : 0;
+
+            /* Verify computed checksum matches stored checksum */
+            if(stored_crc != crc)
+	        HGOTO_ERROR(H5E_STORAGE, H5E_READERROR, 0, "data error detected by CRC32C checksum")
+        }
+
+        /* Set return values */
+        /* (Re-use the input buffer, just note that the size is smaller by the size of the checksum) */
+        ret_value = nbytes - CRC32C_LEN;
+    } else { /* Write */
+        unsigned char *dst;     /* Temporary pointer to destination buffer */
+
+        /* Compute checksum (can't fail) */
+        crc = nbytes > 0 ? H5_checksum_crc32c(src, nbytes) : 0;
+
+	if (NULL == (outbuf = H5MM_malloc(nbytes + CRC32C_LEN)))
+	    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate CRC32C checksum destination buffer")
+
+        dst = (unsigned char *) outbuf;
+
+        /* Copy raw data */
+        HDmemcpy((void*)dst, (void*)(*buf), nbytes);
+
+        /* Append checksum to raw data for storage */
+        dst += nbytes;
+        UINT32ENCODE(dst, crc);
+
+        /* Free input buffer */
+ 	H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf_size = nbytes + CRC32C_LEN;
+	*buf = outbuf;
+	outbuf = NULL;
+	ret_value = *buf_size;
+    }
+
+done:
+    if(outbuf)
+        H5MM_xfree(outbuf);
+    FUNC_LEAVE_NOAPI(ret_value)
+}
+
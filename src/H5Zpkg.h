@@ -33,6 +33,9 @@ H5_DLLVAR const H5Z_class2_t H5Z_SHUFFLE[1];
 /* Fletcher32 filter */
 H5_DLLVAR const H5Z_class2_t H5Z_FLETCHER32[1];
 
+/* CRC32C filter */
+H5_DLLVAR const H5Z_class2_t H5Z_CRC32C[1];
+
 /* n-bit filter */
 H5_DLLVAR H5Z_class2_t H5Z_NBIT[1];
 
@@ -53,5 +56,12 @@ H5_DLLVAR const H5Z_class2_t H5Z_DEFLATE[1];
 H5_DLLVAR H5Z_class2_t H5Z_SZIP[1];
 #endif /* H5_HAVE_FILTER_SZIP */
 
+/******************************/
+/* Package Private Prototypes */
+/******************************/
+
+/* Shuffle filter kernels */
+H5_DLL herr_t H5Z__shuffle_init(void);
+
 #endif /* _H5Zpkg_H */
 
@@ -41,6 +41,7 @@ typedef int H5Z_filter_t;
 #define H5Z_FILTER_SZIP         4       /*szip compression              */
 #define H5Z_FILTER_NBIT         5       /*nbit compression              */
 #define H5Z_FILTER_SCALEOFFSET  6       /*scale+offset compression      */
+#define H5Z_FILTER_CRC32C       7       /*crc32c checksum of EDC        */
 #define H5Z_FILTER_RESERVED     256	/*filter ids below this value are reserved for library use */
 
 #define H5Z_FILTER_MAX		65535	/*maximum filter id		*/
@@ -78,6 +79,10 @@ typedef int H5Z_filter_t;
 /* Macros for the shuffle filter */
 #define H5Z_SHUFFLE_USER_NPARMS    0    /* Number of parameters that users can set */
 #define H5Z_SHUFFLE_TOTAL_NPARMS   1    /* Total number of parameters for filter */
+#define H5Z_SHUFFLE_MODE_NPARMS    2    /* Total number of parameters for filter with a shuffle mode */
+#define H5Z_SHUFFLE_PARM_MODE      1    /* "User" parameter for the shuffle mode */
+#define H5Z_SHUFFLE_BYTE           0    /* Shuffle mode: group the bytes of each element */
+#define H5Z_SHUFFLE_BIT            1    /* Shuffle mode: group the bits of each element */
 
 /* Macros for the szip filter */
 #define H5Z_SZIP_USER_NPARMS    2       /* Number of parameters that users can set */
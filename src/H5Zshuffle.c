@@ -24,10 +24,60 @@
 #include "H5Tprivate.h"		/* Datatypes         			*/
 #include "H5Zpkg.h"		/* Data filters				*/
 
+/* SSE2 kernels are used on every x86-64 system.  AVX2 kernels are compiled
+ * in when the compiler supports per-function target attributes and are
+ * selected at run time when the CPU has AVX2. */
+#if defined(__x86_64__) || defined(_M_X64)
+#define H5Z_SHUFFLE_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) && (defined(__clang__) || (__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define H5Z_SHUFFLE_AVX2
+#include <immintrin.h>
+#endif /* __GNUC__ */
+#endif /* __x86_64__ */
+
+/* Attribute for functions using AVX2 instructions */
+#define H5Z_SHUFFLE_AVX2_ATTR      __attribute__((target("avx2")))
+
+/* Instruction sets available for the shuffle kernels */
+typedef enum H5Z_shuffle_isa_t {
+    H5Z_SHUFFLE_ISA_NONE = 0,   /* Scalar loops only */
+    H5Z_SHUFFLE_ISA_SSE2,       /* SSE2 kernels */
+    H5Z_SHUFFLE_ISA_AVX2        /* AVX2 kernels */
+} H5Z_shuffle_isa_t;
+
 /* Local function prototypes */
 static herr_t H5Z_set_local_shuffle(hid_t dcpl_id, hid_t type_id, hid_t space_id);
 static size_t H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts,
     const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+static void H5Z__shuffle_bytes(uint8_t *dest, const uint8_t *src, size_t size,
+    size_t nelmts);
+static void H5Z__unshuffle_bytes(uint8_t *dest, const uint8_t *src, size_t size,
+    size_t nelmts);
+static void H5Z__shuffle_bits(uint8_t *dest, const uint8_t *src, size_t size,
+    size_t nelmts);
+static void H5Z__unshuffle_bits(uint8_t *dest, const uint8_t *src, size_t size,
+    size_t nelmts);
+#ifdef H5Z_SHUFFLE_SSE2
+static void H5Z__shuffle_bytes_sse2(uint8_t *dest, const uint8_t *src,
+    size_t size, size_t nelmts);
+static void H5Z__unshuffle_bytes_sse2(uint8_t *dest, const uint8_t *src,
+    size_t size, size_t nelmts);
+static size_t H5Z__shuffle_bits_sse2(uint8_t *dest, const uint8_t *src,
+    size_t nelmts);
+static size_t H5Z__unshuffle_bits_sse2(uint8_t *dest, const uint8_t *src,
+    size_t nelmts);
+#endif /* H5Z_SHUFFLE_SSE2 */
+#ifdef H5Z_SHUFFLE_AVX2
+static void H5Z__shuffle_bytes_avx2(uint8_t *dest, const uint8_t *src,
+    size_t size, size_t nelmts) H5Z_SHUFFLE_AVX2_ATTR;
+static void H5Z__unshuffle_bytes_avx2(uint8_t *dest, const uint8_t *src,
+    size_t size, size_t nelmts) H5Z_SHUFFLE_AVX2_ATTR;
+static size_t H5Z__shuffle_bits_avx2(uint8_t *dest, const uint8_t *src,
+    size_t nelmts) H5Z_SHUFFLE_AVX2_ATTR;
+static size_t H5Z__unshuffle_bits_avx2(uint8_t *dest, const uint8_t *src,
+    size_t nelmts) H5Z_SHUFFLE_AVX2_ATTR;
+#endif /* H5Z_SHUFFLE_AVX2 */
 
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_SHUFFLE[1] = {{
@@ -44,7 +94,42 @@ const H5Z_class2_t H5Z_SHUFFLE[1] = {{
 /* Local macros */
 #define H5Z_SHUFFLE_PARM_SIZE      0       /* "Local" parameter for shuffling size */
 
-
+/* Best instruction set for the kernels on this CPU, set by H5Z__shuffle_init() */
+static H5Z_shuffle_isa_t H5Z_shuffle_isa_g = H5Z_SHUFFLE_ISA_NONE;
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_init
+ *
+ * Purpose:	Picks the instruction set used by the shuffle kernels,
+ *		based on what the CPU supports.  Setting the environment
+ *		variable HDF5_NO_SIMD_SHUFFLE turns the kernels off.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z__shuffle_init(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    H5Z_shuffle_isa_g = H5Z_SHUFFLE_ISA_NONE;
+    if(NULL == HDgetenv("HDF5_NO_SIMD_SHUFFLE")) {
+#ifdef H5Z_SHUFFLE_SSE2
+        H5Z_shuffle_isa_g = H5Z_SHUFFLE_ISA_SSE2;
+#endif /* H5Z_SHUFFLE_SSE2 */
+#ifdef H5Z_SHUFFLE_AVX2
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2"))
+            H5Z_shuffle_isa_g = H5Z_SHUFFLE_ISA_AVX2;
+#endif /* H5Z_SHUFFLE_AVX2 */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5Z__shuffle_init() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5Z_set_local_shuffle
  *
@@ -58,6 +143,7 @@ const H5Z_class2_t H5Z_SHUFFLE[1] = {{
  *              Monday, April  7, 2003
  *
  * Modifications:
+ *              Keep the shuffle mode, when one was set.
  *
  *-------------------------------------------------------------------------
  */
@@ -67,8 +153,8 @@ H5Z_set_local_shuffle(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_i
     H5P_genplist_t *dcpl_plist;     /* Property list pointer */
     const H5T_t	*type;                  /* Datatype */
     unsigned flags;                     /* Filter flags */
-    size_t cd_nelmts = H5Z_SHUFFLE_USER_NPARMS;     /* Number of filter parameters */
-    unsigned cd_values[H5Z_SHUFFLE_TOTAL_NPARMS];  /* Filter parameters */
+    size_t cd_nelmts = H5Z_SHUFFLE_MODE_NPARMS;     /* Number of filter parameters */
+    unsigned cd_values[H5Z_SHUFFLE_MODE_NPARMS];  /* Filter parameters */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -85,19 +171,27 @@ H5Z_set_local_shuffle(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_i
     if(H5P_get_filter_by_id(dcpl_plist, H5Z_FILTER_SHUFFLE, &flags, &cd_nelmts, cd_values, (size_t)0, NULL, NULL) < 0)
 	HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get shuffle parameters")
 
+    /* Only the byte shuffle, which stores no mode, and an explicit mode are valid */
+    if(cd_nelmts == H5Z_SHUFFLE_MODE_NPARMS) {
+        if(cd_values[H5Z_SHUFFLE_PARM_MODE] != H5Z_SHUFFLE_BYTE && cd_values[H5Z_SHUFFLE_PARM_MODE] != H5Z_SHUFFLE_BIT)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "invalid shuffle mode")
+    } /* end if */
+    else
+        cd_nelmts = H5Z_SHUFFLE_TOTAL_NPARMS;
+
     /* Set "local" parameter for this dataset */
     if((cd_values[H5Z_SHUFFLE_PARM_SIZE] = (unsigned)H5T_get_size(type)) == 0)
 	HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "bad datatype size")
 
     /* Modify the filter's parameters for this dataset */
-    if(H5P_modify_filter(dcpl_plist, H5Z_FILTER_SHUFFLE, flags, (size_t)H5Z_SHUFFLE_TOTAL_NPARMS, cd_values) < 0)
+    if(H5P_modify_filter(dcpl_plist, H5Z_FILTER_SHUFFLE, flags, cd_nelmts, cd_values) < 0)
 	HGOTO_ERROR(H5E_PLINE, H5E_CANTSET, FAIL, "can't set local shuffle parameters")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_set_local_shuffle() */
 
-
+
 /*-------------------------------------------------------------------------
  * Function:	H5Z_filter_shuffle
  *
@@ -108,6 +202,13 @@ done:
  *              Usually, the bytes in each byte position are more related to
  *              each other and putting them together will increase compression.
  *
+ *              In the H5Z_SHUFFLE_BIT mode, the bytes of each byte position
+ *              are then split into bit planes: each run of eight elements
+ *              contributes one bit to each of eight bytes, one byte per bit
+ *              position.  Bytes of the last (number of elements % 8)
+ *              elements in each byte position are stored unchanged after
+ *              the bit planes.
+ *
  * Return:	Success: Size of buffer filtered
  *		Failure: 0
  *
@@ -118,6 +219,9 @@ done:
  *              Quincey Koziol, November 13, 2002
  *              Cleaned up code.
  *
+ *              Moved the loops into H5Z__[un]shuffle_bytes, which use
+ *              vector kernels when they can, and added the bit shuffle.
+ *
  *-------------------------------------------------------------------------
  */
 static size_t
@@ -125,22 +229,26 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
                    size_t nbytes, size_t *buf_size, void **buf)
 {
     void *dest = NULL;          /* Buffer to deposit [un]shuffled bytes into */
-    unsigned char *_src=NULL;   /* Alias for source buffer */
-    unsigned char *_dest=NULL;  /* Alias for destination buffer */
+    unsigned char *_src;        /* Alias for source buffer */
+    unsigned char *_dest;       /* Alias for destination buffer */
     unsigned bytesoftype;       /* Number of bytes per element */
+    hbool_t bitshuffle = FALSE; /* Whether to shuffle bits */
     size_t numofelements;       /* Number of elements in buffer */
-    size_t i;                   /* Local index variables */
-#ifdef NO_DUFFS_DEVICE
-    size_t j;                   /* Local index variable */
-#endif /* NO_DUFFS_DEVICE */
     size_t leftover;            /* Extra bytes at end of buffer */
     size_t ret_value = 0;       /* Return value */
 
     FUNC_ENTER_NOAPI(0)
 
     /* Check arguments */
-    if (cd_nelmts!=H5Z_SHUFFLE_TOTAL_NPARMS || cd_values[H5Z_SHUFFLE_PARM_SIZE]==0)
+    if((cd_nelmts != H5Z_SHUFFLE_TOTAL_NPARMS && cd_nelmts != H5Z_SHUFFLE_MODE_NPARMS)
+            || cd_values[H5Z_SHUFFLE_PARM_SIZE] == 0)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid shuffle parameters")
+    if(cd_nelmts == H5Z_SHUFFLE_MODE_NPARMS) {
+        if(cd_values[H5Z_SHUFFLE_PARM_MODE] == H5Z_SHUFFLE_BIT)
+            bitshuffle = TRUE;
+        else if(cd_values[H5Z_SHUFFLE_PARM_MODE] != H5Z_SHUFFLE_BYTE)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid shuffle mode")
+    } /* end if */
 
     /* Get the number of bytes per element from the parameter block */
     bytesoftype=cd_values[H5Z_SHUFFLE_PARM_SIZE];
@@ -148,8 +256,9 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
     /* Compute the number of elements in buffer */
     numofelements=nbytes/bytesoftype;
 
-    /* Don't do anything for 1-byte elements, or "fractional" elements */
-    if(bytesoftype > 1 && numofelements > 1) {
+    /* Don't do anything for "fractional" elements, or for 1-byte elements
+     * when only shuffling bytes */
+    if((bytesoftype > 1 || bitshuffle) && numofelements > 1) {
         /* Compute the leftover bytes if there are any */
         leftover = nbytes%bytesoftype;
 
@@ -157,135 +266,739 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
         if (NULL==(dest = H5MM_malloc(nbytes)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for shuffle buffer")
 
+        _src = (unsigned char *)(*buf);
+        _dest = (unsigned char *)dest;
         if(flags & H5Z_FLAG_REVERSE) {
-            /* Get the pointer to the source buffer */
-            _src =(unsigned char *)(*buf);
+            /* Input; undo the bit shuffle into the destination buffer, then
+             * unshuffle the bytes back into the input buffer */
+            if(bitshuffle) {
+                H5Z__unshuffle_bits(_dest, _src, (size_t)bytesoftype, numofelements);
+                H5Z__unshuffle_bytes(_src, _dest, (size_t)bytesoftype, numofelements);
+            } /* end if */
+            else
+                H5Z__unshuffle_bytes(_dest, _src, (size_t)bytesoftype, numofelements);
+        } /* end if */
+        else {
+            /* Output; shuffle the bytes into the destination buffer, then
+             * shuffle the bits back into the input buffer */
+            H5Z__shuffle_bytes(_dest, _src, (size_t)bytesoftype, numofelements);
+            if(bitshuffle)
+                H5Z__shuffle_bits(_src, _dest, (size_t)bytesoftype, numofelements);
+        } /* end else */
 
-            /* Input; unshuffle */
-            for(i=0; i<bytesoftype; i++) {
-                _dest=((unsigned char *)dest)+i;
+        /* The bit shuffle leaves its result in the input buffer, the byte
+         * shuffle in the destination buffer */
+        if(bitshuffle)
+            dest = H5MM_xfree(dest);
+        else {
+            /* Add leftover to the end of data */
+            if(leftover > 0)
+                HDmemcpy(_dest + (nbytes - leftover), _src + (nbytes - leftover), leftover);
+
+            /* Free the input buffer */
+            H5MM_xfree(*buf);
+
+            /* Set the buffer information to return */
+            *buf = dest;
+            *buf_size=nbytes;
+        } /* end else */
+    } /* end if */
+
+    /* Set the return value */
+    ret_value = nbytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bytes
+ *
+ * Purpose:	Shuffles NELMTS elements of SIZE bytes from SRC into DEST,
+ *		so byte B of element I lands at DEST[B * NELMTS + I].
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__shuffle_bytes(uint8_t *dest, const uint8_t *src, size_t size, size_t nelmts)
+{
+    const uint8_t *_src;        /* Alias for source buffer */
+    uint8_t *_dest = dest;      /* Alias for destination buffer */
+    size_t i;                   /* Local index variables */
+#ifdef NO_DUFFS_DEVICE
+    size_t j;                   /* Local index variable */
+#endif /* NO_DUFFS_DEVICE */
+    hbool_t vec_done = FALSE;   /* Whether a vector kernel did the work */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Use a vector kernel for the common element sizes */
+    if(size == 2 || size == 4 || size == 8 || size == 16)
+        switch(H5Z_shuffle_isa_g) {
+#ifdef H5Z_SHUFFLE_AVX2
+            case H5Z_SHUFFLE_ISA_AVX2:
+                H5Z__shuffle_bytes_avx2(dest, src, size, nelmts);
+                vec_done = TRUE;
+                break;
+#endif /* H5Z_SHUFFLE_AVX2 */
+
+#ifdef H5Z_SHUFFLE_SSE2
+            case H5Z_SHUFFLE_ISA_SSE2:
+                H5Z__shuffle_bytes_sse2(dest, src, size, nelmts);
+                vec_done = TRUE;
+                break;
+#endif /* H5Z_SHUFFLE_SSE2 */
+
+            case H5Z_SHUFFLE_ISA_NONE:
+            default:
+                break;
+        } /* end switch */
+
+    /* Shuffle anything else one byte position at a time */
+    if(!vec_done) {
+        for(i = 0; i < size; i++) {
+            _src = src + i;
 #define DUFF_GUTS							    \
-    *_dest=*_src++;                             \
-    _dest+=bytesoftype;
+        *_dest++=*_src;                             \
+        _src+=size;
 #ifdef NO_DUFFS_DEVICE
-                j = numofelements;
-                while(j > 0) {
-                    DUFF_GUTS;
+            j = nelmts;
+            while(j > 0) {
+                DUFF_GUTS;
 
-                    j--;
-                } /* end for */
+                j--;
+            } /* end for */
 #else /* NO_DUFFS_DEVICE */
-            {
-                size_t duffs_index; /* Counting index for Duff's device */
-
-                duffs_index = (numofelements + 7) / 8;
-                switch (numofelements % 8) {
-                    default:
-                        HDassert(0 && "This Should never be executed!");
-                        break;
-                    case 0:
-                        do
-                          {
-                            DUFF_GUTS
-                    case 7:
-                            DUFF_GUTS
-                    case 6:
-                            DUFF_GUTS
-                    case 5:
-                            DUFF_GUTS
-                    case 4:
-                            DUFF_GUTS
-                    case 3:
-                            DUFF_GUTS
-                    case 2:
-                            DUFF_GUTS
-                    case 1:
-                            DUFF_GUTS
-                      } while (--duffs_index > 0);
-                } /* end switch */
-            }
+        {
+            size_t duffs_index; /* Counting index for Duff's device */
+
+            duffs_index = (nelmts + 7) / 8;
+            switch (nelmts % 8) {
+                default:
+                    HDassert(0 && "This Should never be executed!");
+                    break;
+                case 0:
+                    do
+                      {
+                        DUFF_GUTS
+                case 7:
+                        DUFF_GUTS
+                case 6:
+                        DUFF_GUTS
+                case 5:
+                        DUFF_GUTS
+                case 4:
+                        DUFF_GUTS
+                case 3:
+                        DUFF_GUTS
+                case 2:
+                        DUFF_GUTS
+                case 1:
+                        DUFF_GUTS
+                  } while (--duffs_index > 0);
+            } /* end switch */
+        }
 #endif /* NO_DUFFS_DEVICE */
 #undef DUFF_GUTS
-            } /* end for */
+        } /* end for */
+    } /* end if */
 
-            /* Add leftover to the end of data */
-            if(leftover>0) {
-                /* Adjust back to end of shuffled bytes */
-                _dest -= (bytesoftype - 1);     /*lint !e794 _dest is initialized */
-                HDmemcpy((void*)_dest, (void*)_src, leftover);
-            }
-        } /* end if */
-        else {
-            /* Get the pointer to the destination buffer */
-            _dest =(unsigned char *)dest;
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_bytes() */
 
-            /* Output; shuffle */
-            for(i=0; i<bytesoftype; i++) {
-                _src=((unsigned char *)(*buf))+i;
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bytes
+ *
+ * Purpose:	Reverses H5Z__shuffle_bytes: gathers byte B of element I
+ *		from SRC[B * NELMTS + I] into DEST.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__unshuffle_bytes(uint8_t *dest, const uint8_t *src, size_t size, size_t nelmts)
+{
+    const uint8_t *_src = src;  /* Alias for source buffer */
+    uint8_t *_dest;             /* Alias for destination buffer */
+    size_t i;                   /* Local index variables */
+#ifdef NO_DUFFS_DEVICE
+    size_t j;                   /* Local index variable */
+#endif /* NO_DUFFS_DEVICE */
+    hbool_t vec_done = FALSE;   /* Whether a vector kernel did the work */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Use a vector kernel for the common element sizes */
+    if(size == 2 || size == 4 || size == 8 || size == 16)
+        switch(H5Z_shuffle_isa_g) {
+#ifdef H5Z_SHUFFLE_AVX2
+            case H5Z_SHUFFLE_ISA_AVX2:
+                H5Z__unshuffle_bytes_avx2(dest, src, size, nelmts);
+                vec_done = TRUE;
+                break;
+#endif /* H5Z_SHUFFLE_AVX2 */
+
+#ifdef H5Z_SHUFFLE_SSE2
+            case H5Z_SHUFFLE_ISA_SSE2:
+                H5Z__unshuffle_bytes_sse2(dest, src, size, nelmts);
+                vec_done = TRUE;
+                break;
+#endif /* H5Z_SHUFFLE_SSE2 */
+
+            case H5Z_SHUFFLE_ISA_NONE:
+            default:
+                break;
+        } /* end switch */
+
+    /* Unshuffle anything else one byte position at a time */
+    if(!vec_done) {
+        for(i = 0; i < size; i++) {
+            _dest = dest + i;
 #define DUFF_GUTS							    \
-    *_dest++=*_src;                             \
-    _src+=bytesoftype;
+        *_dest=*_src++;                             \
+        _dest+=size;
 #ifdef NO_DUFFS_DEVICE
-                j = numofelements;
-                while(j > 0) {
-                    DUFF_GUTS;
+            j = nelmts;
+            while(j > 0) {
+                DUFF_GUTS;
 
-                    j--;
-                } /* end for */
+                j--;
+            } /* end for */
 #else /* NO_DUFFS_DEVICE */
-            {
-                size_t duffs_index; /* Counting index for Duff's device */
-
-                duffs_index = (numofelements + 7) / 8;
-                switch (numofelements % 8) {
-                    default:
-                        HDassert(0 && "This Should never be executed!");
-                        break;
-                    case 0:
-                        do
-                          {
-                            DUFF_GUTS
-                    case 7:
-                            DUFF_GUTS
-                    case 6:
-                            DUFF_GUTS
-                    case 5:
-                            DUFF_GUTS
-                    case 4:
-                            DUFF_GUTS
-                    case 3:
-                            DUFF_GUTS
-                    case 2:
-                            DUFF_GUTS
-                    case 1:
-                            DUFF_GUTS
-                      } while (--duffs_index > 0);
-                } /* end switch */
-            }
+        {
+            size_t duffs_index; /* Counting index for Duff's device */
+
+            duffs_index = (nelmts + 7) / 8;
+            switch (nelmts % 8) {
+                default:
+                    HDassert(0 && "This Should never be executed!");
+                    break;
+                case 0:
+                    do
+                      {
+                        DUFF_GUTS
+                case 7:
+                        DUFF_GUTS
+                case 6:
+                        DUFF_GUTS
+                case 5:
+                        DUFF_GUTS
+                case 4:
+                        DUFF_GUTS
+                case 3:
+                        DUFF_GUTS
+                case 2:
+                        DUFF_GUTS
+                case 1:
+                        DUFF_GUTS
+                  } while (--duffs_index > 0);
+            } /* end switch */
+        }
 #endif /* NO_DUFFS_DEVICE */
 #undef DUFF_GUTS
+        } /* end for */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__unshuffle_bytes() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__transpose_bits
+ *
+ * Purpose:	Transposes the 8x8 bit matrix in X, whose byte I holds row
+ *		I, so bit K of byte I moves to bit I of byte K.
+ *
+ * Return:	The transposed matrix
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE uint64_t
+H5Z__transpose_bits(uint64_t x)
+{
+    uint64_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x = x ^ t ^ (t << 28);
+
+    return x;
+} /* end H5Z__transpose_bits() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bits
+ *
+ * Purpose:	Splits each of the SIZE byte rows written by
+ *		H5Z__shuffle_bytes into bit planes.  Of a row of N bytes,
+ *		the first N - N % 8 become eight planes of N / 8 bytes each,
+ *		bit K of byte I going to bit I % 8 of byte I / 8 of plane K;
+ *		the last N % 8 bytes are copied after the planes.  SRC holds
+ *		SIZE rows of NELMTS bytes each.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__shuffle_bits(uint8_t *dest, const uint8_t *src, size_t size, size_t nelmts)
+{
+    size_t nplane = nelmts / 8;         /* Bytes in each bit plane of a row */
+    size_t row;                         /* Current row */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(row = 0; row < size; row++) {
+        const uint8_t *rsrc = src + row * nelmts;
+        uint8_t *rdest = dest + row * nelmts;
+        size_t done = 0;                /* Bytes of plane already filled */
+        size_t u, k;
+
+        switch(H5Z_shuffle_isa_g) {
+#ifdef H5Z_SHUFFLE_AVX2
+            case H5Z_SHUFFLE_ISA_AVX2:
+                done = H5Z__shuffle_bits_avx2(rdest, rsrc, nelmts);
+                break;
+#endif /* H5Z_SHUFFLE_AVX2 */
+
+#ifdef H5Z_SHUFFLE_SSE2
+            case H5Z_SHUFFLE_ISA_SSE2:
+                done = H5Z__shuffle_bits_sse2(rdest, rsrc, nelmts);
+                break;
+#endif /* H5Z_SHUFFLE_SSE2 */
+
+            case H5Z_SHUFFLE_ISA_NONE:
+            default:
+                break;
+        } /* end switch */
+
+        for(u = done; u < nplane; u++) {
+            uint64_t x = 0;
+
+            for(k = 0; k < 8; k++)
+                x |= (uint64_t)rsrc[u * 8 + k] << (8 * k);
+            x = H5Z__transpose_bits(x);
+            for(k = 0; k < 8; k++)
+                rdest[k * nplane + u] = (uint8_t)(x >> (8 * k));
+        } /* end for */
+
+        /* Copy the bytes left over after the last full run of eight */
+        if(nelmts % 8)
+            HDmemcpy(rdest + nplane * 8, rsrc + nplane * 8, nelmts % 8);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_bits() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bits
+ *
+ * Purpose:	Reverses H5Z__shuffle_bits, gathering the bit planes of
+ *		SIZE rows of NELMTS bytes each from SRC back into bytes.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__unshuffle_bits(uint8_t *dest, const uint8_t *src, size_t size, size_t nelmts)
+{
+    size_t nplane = nelmts / 8;         /* Bytes in each bit plane of a row */
+    size_t row;                         /* Current row */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(row = 0; row < size; row++) {
+        const uint8_t *rsrc = src + row * nelmts;
+        uint8_t *rdest = dest + row * nelmts;
+        size_t done = 0;                /* Bytes of plane already read */
+        size_t u, k;
+
+        switch(H5Z_shuffle_isa_g) {
+#ifdef H5Z_SHUFFLE_AVX2
+            case H5Z_SHUFFLE_ISA_AVX2:
+                done = H5Z__unshuffle_bits_avx2(rdest, rsrc, nelmts);
+                break;
+#endif /* H5Z_SHUFFLE_AVX2 */
+
+#ifdef H5Z_SHUFFLE_SSE2
+            case H5Z_SHUFFLE_ISA_SSE2:
+                done = H5Z__unshuffle_bits_sse2(rdest, rsrc, nelmts);
+                break;
+#endif /* H5Z_SHUFFLE_SSE2 */
+
+            case H5Z_SHUFFLE_ISA_NONE:
+            default:
+                break;
+        } /* end switch */
+
+        for(u = done; u < nplane; u++) {
+            uint64_t x = 0;
+
+            for(k = 0; k < 8; k++)
+                x |= (uint64_t)rsrc[k * nplane + u] << (8 * k);
+            x = H5Z__transpose_bits(x);
+            for(k = 0; k < 8; k++)
+                rdest[u * 8 + k] = (uint8_t)(x >> (8 * k));
+        } /* end for */
+
+        /* Copy the bytes left over after the last full run of eight */
+        if(nelmts % 8)
+            HDmemcpy(rdest + nplane * 8, rsrc + nplane * 8, nelmts % 8);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__unshuffle_bits() */
+
+
+#ifdef H5Z_SHUFFLE_SSE2
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bytes_sse2
+ *
+ * Purpose:	H5Z__shuffle_bytes for 2, 4, 8 and 16-byte elements, sixteen
+ *		elements at a time.  Each of the log2(SIZE) passes splits
+ *		the even and odd bytes of pairs of vectors apart, which
+ *		leaves byte position B of the sixteen elements in vector B.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__shuffle_bytes_sse2(uint8_t *dest, const uint8_t *src, size_t size, size_t nelmts)
+{
+    const __m128i lo_mask = _mm_set1_epi16(0x00FF);
+    __m128i v[16], t[16];               /* Vectors being shuffled */
+    size_t half = size / 2;
+    size_t nvec = nelmts - (nelmts % 16);
+    size_t u, i, step;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 16) {
+        for(i = 0; i < size; i++)
+            v[i] = _mm_loadu_si128((const __m128i *)(src + u * size + i * 16));
+        for(step = size; step > 1; step /= 2) {
+            for(i = 0; i < half; i++) {
+                t[i] = _mm_packus_epi16(_mm_and_si128(v[2 * i], lo_mask),
+                        _mm_and_si128(v[2 * i + 1], lo_mask));
+                t[half + i] = _mm_packus_epi16(_mm_srli_epi16(v[2 * i], 8),
+                        _mm_srli_epi16(v[2 * i + 1], 8));
             } /* end for */
+            for(i = 0; i < size; i++)
+                v[i] = t[i];
+        } /* end for */
+        for(i = 0; i < size; i++)
+            _mm_storeu_si128((__m128i *)(dest + i * nelmts + u), v[i]);
+    } /* end for */
 
-            /* Add leftover to the end of data */
-            if(leftover>0) {
-                /* Adjust back to end of shuffled bytes */
-                _src -= (bytesoftype - 1);      /*lint !e794 _src is initialized */
-                HDmemcpy((void*)_dest, (void*)_src, leftover);
-            }
-        } /* end else */
+    /* Shuffle the elements left over */
+    for(u = nvec; u < nelmts; u++)
+        for(i = 0; i < size; i++)
+            dest[i * nelmts + u] = src[u * size + i];
 
-        /* Free the input buffer */
-        H5MM_xfree(*buf);
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_bytes_sse2() */
 
-        /* Set the buffer information to return */
-        *buf = dest;
-        *buf_size=nbytes;
-    } /* end else */
 
-    /* Set the return value */
-    ret_value = nbytes;
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bytes_sse2
+ *
+ * Purpose:	H5Z__unshuffle_bytes for 2, 4, 8 and 16-byte elements,
+ *		interleaving the bytes of pairs of vectors to undo the passes
+ *		of H5Z__shuffle_bytes_sse2.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__unshuffle_bytes_sse2(uint8_t *dest, const uint8_t *src, size_t size, size_t nelmts)
+{
+    __m128i v[16], t[16];               /* Vectors being unshuffled */
+    size_t half = size / 2;
+    size_t nvec = nelmts - (nelmts % 16);
+    size_t u, i, step;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 16) {
+        for(i = 0; i < size; i++)
+            v[i] = _mm_loadu_si128((const __m128i *)(src + i * nelmts + u));
+        for(step = size; step > 1; step /= 2) {
+            for(i = 0; i < half; i++) {
+                t[2 * i] = _mm_unpacklo_epi8(v[i], v[half + i]);
+                t[2 * i + 1] = _mm_unpackhi_epi8(v[i], v[half + i]);
+            } /* end for */
+            for(i = 0; i < size; i++)
+                v[i] = t[i];
+        } /* end for */
+        for(i = 0; i < size; i++)
+            _mm_storeu_si128((__m128i *)(dest + u * size + i * 16), v[i]);
+    } /* end for */
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-}
+    /* Unshuffle the elements left over */
+    for(u = nvec; u < nelmts; u++)
+        for(i = 0; i < size; i++)
+            dest[u * size + i] = src[i * nelmts + u];
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__unshuffle_bytes_sse2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bits_sse2
+ *
+ * Purpose:	Splits a row of NELMTS bytes into bit planes for
+ *		H5Z__shuffle_bits, sixteen bytes at a time, taking the top
+ *		bit of every byte with one movemask per plane.
+ *
+ * Return:	Number of bytes of each plane filled
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__shuffle_bits_sse2(uint8_t *dest, const uint8_t *src, size_t nelmts)
+{
+    size_t nplane = nelmts / 8;         /* Bytes in each bit plane */
+    size_t nvec = nplane - (nplane % 2);
+    size_t u, k;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 2) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + u * 8));
+
+        for(k = 8; k > 0; k--) {
+            uint16_t m = (uint16_t)_mm_movemask_epi8(v);
+
+            HDmemcpy(dest + (k - 1) * nplane + u, &m, sizeof(m));
+            v = _mm_add_epi8(v, v);
+        } /* end for */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(nvec)
+} /* end H5Z__shuffle_bits_sse2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bits_sse2
+ *
+ * Purpose:	Gathers the bit planes of a row of NELMTS bytes back into
+ *		bytes for H5Z__unshuffle_bits, sixteen bytes at a time.
+ *
+ * Return:	Number of bytes of each plane read
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__unshuffle_bits_sse2(uint8_t *dest, const uint8_t *src, size_t nelmts)
+{
+    const __m128i bitsel = _mm_set1_epi64x((long long)0x8040201008040201ULL);
+    size_t nplane = nelmts / 8;         /* Bytes in each bit plane */
+    size_t nvec = nplane - (nplane % 2);
+    size_t u, k;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 2) {
+        __m128i r = _mm_setzero_si128();
+
+        for(k = 0; k < 8; k++) {
+            const uint8_t *p = src + k * nplane + u;
+            __m128i x = _mm_unpacklo_epi64(_mm_set1_epi8((char)p[0]), _mm_set1_epi8((char)p[1]));
+
+            x = _mm_cmpeq_epi8(_mm_and_si128(x, bitsel), bitsel);
+            r = _mm_or_si128(r, _mm_and_si128(x, _mm_set1_epi8((char)(1 << k))));
+        } /* end for */
+        _mm_storeu_si128((__m128i *)(dest + u * 8), r);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(nvec)
+} /* end H5Z__unshuffle_bits_sse2() */
+#endif /* H5Z_SHUFFLE_SSE2 */
+
+#ifdef H5Z_SHUFFLE_AVX2
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bytes_avx2
+ *
+ * Purpose:	H5Z__shuffle_bytes_sse2 with 32 elements at a time.  The
+ *		packs work within 128-bit lanes, so each result has its
+ *		64-bit quarters put back in order.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__shuffle_bytes_avx2(uint8_t *dest, const uint8_t *src, size_t size, size_t nelmts)
+{
+    const __m256i lo_mask = _mm256_set1_epi16(0x00FF);
+    __m256i v[16], t[16];               /* Vectors being shuffled */
+    size_t half = size / 2;
+    size_t nvec = nelmts - (nelmts % 32);
+    size_t u, i, step;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 32) {
+        for(i = 0; i < size; i++)
+            v[i] = _mm256_loadu_si256((const __m256i *)(src + u * size + i * 32));
+        for(step = size; step > 1; step /= 2) {
+            for(i = 0; i < half; i++) {
+                t[i] = _mm256_permute4x64_epi64(_mm256_packus_epi16(
+                        _mm256_and_si256(v[2 * i], lo_mask),
+                        _mm256_and_si256(v[2 * i + 1], lo_mask)), 0xD8);
+                t[half + i] = _mm256_permute4x64_epi64(_mm256_packus_epi16(
+                        _mm256_srli_epi16(v[2 * i], 8),
+                        _mm256_srli_epi16(v[2 * i + 1], 8)), 0xD8);
+            } /* end for */
+            for(i = 0; i < size; i++)
+                v[i] = t[i];
+        } /* end for */
+        for(i = 0; i < size; i++)
+            _mm256_storeu_si256((__m256i *)(dest + i * nelmts + u), v[i]);
+    } /* end for */
+
+    /* Shuffle the elements left over */
+    for(u = nvec; u < nelmts; u++)
+        for(i = 0; i < size; i++)
+            dest[i * nelmts + u] = src[u * size + i];
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_bytes_avx2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bytes_avx2
+ *
+ * Purpose:	H5Z__unshuffle_bytes_sse2 with 32 elements at a time.  The
+ *		unpacks work within 128-bit lanes, so the halves of each
+ *		pair of results are recombined.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__unshuffle_bytes_avx2(uint8_t *dest, const uint8_t *src, size_t size, size_t nelmts)
+{
+    __m256i v[16], t[16];               /* Vectors being unshuffled */
+    size_t half = size / 2;
+    size_t nvec = nelmts - (nelmts % 32);
+    size_t u, i, step;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 32) {
+        for(i = 0; i < size; i++)
+            v[i] = _mm256_loadu_si256((const __m256i *)(src + i * nelmts + u));
+        for(step = size; step > 1; step /= 2) {
+            for(i = 0; i < half; i++) {
+                __m256i lo = _mm256_unpacklo_epi8(v[i], v[half + i]);
+                __m256i hi = _mm256_unpackhi_epi8(v[i], v[half + i]);
+
+                t[2 * i] = _mm256_permute2x128_si256(lo, hi, 0x20);
+                t[2 * i + 1] = _mm256_permute2x128_si256(lo, hi, 0x31);
+            } /* end for */
+            for(i = 0; i < size; i++)
+                v[i] = t[i];
+        } /* end for */
+        for(i = 0; i < size; i++)
+            _mm256_storeu_si256((__m256i *)(dest + u * size + i * 32), v[i]);
+    } /* end for */
+
+    /* Unshuffle the elements left over */
+    for(u = nvec; u < nelmts; u++)
+        for(i = 0; i < size; i++)
+            dest[u * size + i] = src[i * nelmts + u];
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__unshuffle_bytes_avx2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bits_avx2
+ *
+ * Purpose:	H5Z__shuffle_bits_sse2 with 32 bytes at a time.
+ *
+ * Return:	Number of bytes of each plane filled
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__shuffle_bits_avx2(uint8_t *dest, const uint8_t *src, size_t nelmts)
+{
+    size_t nplane = nelmts / 8;         /* Bytes in each bit plane */
+    size_t nvec = nplane - (nplane % 4);
+    size_t u, k;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 4) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + u * 8));
+
+        for(k = 8; k > 0; k--) {
+            uint32_t m = (uint32_t)_mm256_movemask_epi8(v);
+
+            HDmemcpy(dest + (k - 1) * nplane + u, &m, sizeof(m));
+            v = _mm256_add_epi8(v, v);
+        } /* end for */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(nvec)
+} /* end H5Z__shuffle_bits_avx2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bits_avx2
+ *
+ * Purpose:	H5Z__unshuffle_bits_sse2 with 32 bytes at a time, spreading
+ *		the plane bytes across the vector with a byte shuffle.
+ *
+ * Return:	Number of bytes of each plane read
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__unshuffle_bits_avx2(uint8_t *dest, const uint8_t *src, size_t nelmts)
+{
+    const __m256i bitsel = _mm256_set1_epi64x((long long)0x8040201008040201ULL);
+    const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    size_t nplane = nelmts / 8;         /* Bytes in each bit plane */
+    size_t nvec = nplane - (nplane % 4);
+    size_t u, k;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < nvec; u += 4) {
+        __m256i r = _mm256_setzero_si256();
+
+        for(k = 0; k < 8; k++) {
+            uint32_t m;
+            __m256i x;
+
+            HDmemcpy(&m, src + k * nplane + u, sizeof(m));
+            x = _mm256_shuffle_epi8(_mm256_set1_epi32((int)m), spread);
+            x = _mm256_cmpeq_epi8(_mm256_and_si256(x, bitsel), bitsel);
+            r = _mm256_or_si256(r, _mm256_and_si256(x, _mm256_set1_epi8((char)(1 << k))));
+        } /* end for */
+        _mm256_storeu_si256((__m256i *)(dest + u * 8), r);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(nvec)
+} /* end H5Z__unshuffle_bits_avx2() */
+#endif /* H5Z_SHUFFLE_AVX2 */
 
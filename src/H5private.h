@@ -92,6 +92,14 @@
 #   include <sys/stat.h>
 #endif
 
+/*
+ * The `struct iovec' data type for the vectored I/O calls readv(),
+ * preadv(), etc.
+ */
+#ifdef H5_HAVE_SYS_UIO_H
+#   include <sys/uio.h>
+#endif
+
 /*
  * If a program may include both `time.h' and `sys/time.h' then
  * TIME_WITH_SYS_TIME is defined (see AC_HEADER_TIME in configure.ac).
@@ -1118,6 +1126,12 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDpow
     #define HDpow(X,Y)    pow(X,Y)
 #endif /* HDpow */
+#ifndef HDpread
+    #define HDpread(F,B,S,O)    pread(F,B,S,O)
+#endif /* HDpread */
+#ifndef HDpreadv
+    #define HDpreadv(F,V,C,O)    preadv(F,V,C,O)
+#endif /* HDpreadv */
 /* printf() variable arguments */
 #ifndef HDputc
     #define HDputc(C,F)    putc(C,F)
@@ -1128,6 +1142,12 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDputs
     #define HDputs(S)    puts(S)
 #endif /* HDputs */
+#ifndef HDpwrite
+    #define HDpwrite(F,B,S,O)    pwrite(F,B,S,O)
+#endif /* HDpwrite */
+#ifndef HDpwritev
+    #define HDpwritev(F,V,C,O)    pwritev(F,V,C,O)
+#endif /* HDpwritev */
 #ifndef HDqsort
     #define HDqsort(M,N,Z,F)  qsort(M,N,Z,F)
 #endif /* HDqsort*/
@@ -1256,6 +1276,9 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDsleep
     #define HDsleep(N)    sleep(N)
 #endif /* HDsleep */
+#ifndef HDnanosleep
+    #define HDnanosleep(S, R)    nanosleep(S, R)
+#endif /* HDnanosleep */
 #ifndef HDsnprintf
     #define HDsnprintf    snprintf /*varargs*/
 #endif /* HDsnprintf */
@@ -2556,12 +2579,14 @@ H5_DLL int H5Z_term_package(void);
 /* Checksum functions */
 H5_DLL uint32_t H5_checksum_fletcher32(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_crc(const void *data, size_t len);
+H5_DLL uint32_t H5_checksum_crc32c(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_lookup3(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_checksum_metadata(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_hash_string(const char *str);
 
 /* Time related routines */
 H5_DLL time_t H5_make_time(struct tm *tm);
+H5_DLL void H5_nanosleep(uint64_t nanosec);
 
 /* Functions for building paths, etc. */
 H5_DLL herr_t   H5_build_extpath(const char *name, char **extpath /*out*/);
@@ -728,6 +728,42 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5_make_time() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_nanosleep
+ *
+ * Purpose:	Sleep for a given # of nanoseconds (rounded up to whole
+ *		milliseconds on Windows).  A sleep interrupted by a signal
+ *		is resumed for the time remaining.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_nanosleep(uint64_t nanosec)
+{
+#ifdef H5_HAVE_WIN32_API
+    DWORD milliseconds = (DWORD)((nanosec + 999999) / 1000000);
+#else /* H5_HAVE_WIN32_API */
+    struct timespec sleeptime;  /* Time to sleep */
+#endif /* H5_HAVE_WIN32_API */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_HAVE_WIN32_API
+    Sleep(milliseconds);
+#else /* H5_HAVE_WIN32_API */
+    sleeptime.tv_sec = (time_t)(nanosec / 1000000000);
+    sleeptime.tv_nsec = (long)(nanosec % 1000000000);
+    while(HDnanosleep(&sleeptime, &sleeptime) < 0)
+        if(EINTR != errno)
+            break;
+#endif /* H5_HAVE_WIN32_API */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5_nanosleep() */
+
 #ifdef H5_HAVE_VISUAL_STUDIO
 
 /* Offset between 1/1/1601 and 1/1/1970 in 100 nanosecond units */
@@ -618,6 +618,41 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         } /* end else */
                         break;
 
+                    case 'p':
+                        if(ptr) {
+                            if(vp)
+                                fprintf(out, "0x%lx", (unsigned long)vp);
+                            else
+                                fprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5D_chunk_cache_policy_t policy = (H5D_chunk_cache_policy_t)va_arg(ap, int);
+
+                            switch(policy) {
+                                case H5D_CHUNK_CACHE_POLICY_ERROR:
+                                    fprintf(out, "H5D_CHUNK_CACHE_POLICY_ERROR");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_W0:
+                                    fprintf(out, "H5D_CHUNK_CACHE_POLICY_W0");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_LRU:
+                                    fprintf(out, "H5D_CHUNK_CACHE_POLICY_LRU");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_ARC:
+                                    fprintf(out, "H5D_CHUNK_CACHE_POLICY_ARC");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_NTYPES:
+                                default:
+                                    fprintf(out, "%ld", (long)policy);
+                                    break;
+                            } /* end switch */
+                        } /* end else */
+                        break;
+
                     case 's':
                         if(ptr) {
                             if(vp)
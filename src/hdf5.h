@@ -41,6 +41,7 @@
 #include "H5Zpublic.h"		/* Data filters				*/
 
 /* Predefined file drivers */
+#include "H5FDaio.h"		/* Asynchronous POSIX file I/O		*/
 #include "H5FDcore.h"		/* Files stored entirely in memory	*/
 #include "H5FDdirect.h"     	/* Linux direct I/O			*/
 #include "H5FDfamily.h"		/* File families 			*/
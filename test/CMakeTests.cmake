@@ -650,6 +650,10 @@ add_test (
         ttsafe_dcreate.h5
         ttsafe_cancel.h5
         ttsafe_acreate.h5
+        ttsafe_dread0.h5
+        ttsafe_dread1.h5
+        ttsafe_dread2.h5
+        ttsafe_dread3.h5
     WORKING_DIRECTORY
         ${HDF5_TEST_BINARY_DIR}/H5TEST
 )
@@ -814,6 +818,10 @@ if (BUILD_SHARED_LIBS)
           ttsafe_dcreate.h5
           ttsafe_cancel.h5
           ttsafe_acreate.h5
+          ttsafe_dread0.h5
+          ttsafe_dread1.h5
+          ttsafe_dread2.h5
+          ttsafe_dread3.h5
       WORKING_DIRECTORY
           ${HDF5_TEST_BINARY_DIR}/H5TEST-shared
   )
@@ -27,10 +27,15 @@
  * This file needs to access private information from the H5Z package.
  */
 #define H5Z_FRIEND
+#define H5D_FRIEND		/*suppress error about including H5Dpkg	  */
 
+/* Define this macro to indicate that the testing APIs should be available */
+#define H5D_TESTING
 
 #include "h5test.h"
 #include "H5srcdir.h"
+#include "H5Dpkg.h"
+#include "H5MMprivate.h"
 #include "H5Zpkg.h"
 #ifdef H5_HAVE_SZLIB_H
 #   include "szlib.h"
@@ -51,6 +56,10 @@ const char *FILENAME[] = {
     "copy_dcpl_newfile",
     "layout_extend",
     "zero_chunk",
+    "filter_nthreads",
+    "chunk_index",
+    "chunk_cache_stats",
+    "multi_io",
     NULL
 };
 #define FILENAME_BUF_SIZE       1024
@@ -69,11 +78,15 @@ const char *FILENAME[] = {
 #define DSET_COMPACT_MAX2_NAME   "max_compact_2"
 #define DSET_CONV_BUF_NAME	"conv_buf"
 #define DSET_TCONV_NAME		"tconv"
+#define DSET_READ_DIRECT_NAME	"read_direct"
 #define DSET_DEFLATE_NAME	"deflate"
 #define DSET_SHUFFLE_NAME	"shuffle"
 #define DSET_FLETCHER32_NAME	"fletcher32"
 #define DSET_FLETCHER32_NAME_2	"fletcher32_2"
 #define DSET_FLETCHER32_NAME_3	"fletcher32_3"
+#define DSET_CRC32C_NAME	"crc32c"
+#define DSET_CRC32C_NAME_2	"crc32c_2"
+#define DSET_CRC32C_NAME_3	"crc32c_3"
 #define DSET_SHUF_DEF_FLET_NAME	"shuffle+deflate+fletcher32"
 #define DSET_SHUF_DEF_FLET_NAME_2	"shuffle+deflate+fletcher32_2"
 #ifdef H5_HAVE_FILTER_SZIP
@@ -92,6 +105,7 @@ const char *FILENAME[] = {
 #define DSET_SET_LOCAL_NAME	"set_local"
 #define DSET_SET_LOCAL_NAME_2	"set_local_2"
 #define DSET_ONEBYTE_SHUF_NAME	"onebyte_shuffle"
+#define DSET_BITSHUF_NAME	"bitshuffle"
 #define DSET_NBIT_INT_NAME             "nbit_int"
 #define DSET_NBIT_FLOAT_NAME           "nbit_float"
 #define DSET_NBIT_DOUBLE_NAME          "nbit_double"
@@ -196,6 +210,20 @@ const char *FILENAME[] = {
 #define BYPASS_CHUNK_DIM         500
 #define BYPASS_FILL_VALUE        7
 
+/* Parameters for testing the threaded filter pipeline */
+#define FILT_THREADS_DATASET    "filt_threads"
+#define FILT_THREADS_WDATASET   "filt_threads_write"
+#define FILT_THREADS_CHUNK_DIM1 10
+#define FILT_THREADS_CHUNK_DIM2 20
+#define FILT_THREADS_NTHREADS   4
+
+/* Parameters for chunk index tests */
+#define CHUNK_IDX_DIM1          100
+#define CHUNK_IDX_DIM2          20
+#define CHUNK_IDX_CHUNK_DIM1    7
+#define CHUNK_IDX_CHUNK_DIM2    4
+#define CHUNK_IDX_EXT_DIM2      50
+
 /* Shared global arrays */
 #define DSET_DIM1       100
 #define DSET_DIM2       200
@@ -1233,6 +1261,145 @@ error:
     return -1;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_read_direct
+ *
+ * Purpose:	Test strided reads without datatype conversion into a
+ *		single block of the application's buffer, which are read
+ *		straight into it as one list of blocks, with a hyperslab
+ *		vector size much smaller than the number of blocks.  Also
+ *		reads into a strided memory selection and checks that both
+ *		give the same result.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_read_direct(hid_t file)
+{
+    const hsize_t nrows = 64, ncols = 512;      /* Dataset dimensions */
+    const size_t guard = 16;                    /* Elements on either side of the block */
+    short	*out = NULL;                    /* Data written */
+    short	*in = NULL;                     /* Data read into a block */
+    short	*in2 = NULL;                    /* Data read into a strided selection */
+    hsize_t	dims[2], start[2], stride[2], count[2], mdims[1], mstart[1], mstride[1];
+    hid_t	space = -1, mspace = -1, dataset = -1, dxpl = -1;
+    size_t	nelmts, u;
+
+    TESTING("strided read without data type conversion");
+
+    if((out = (short *)HDmalloc((size_t)(nrows * ncols) * sizeof(short))) == NULL)
+        goto error;
+    nelmts = (size_t)(nrows * (ncols / 2));
+    if((in = (short *)HDmalloc((nelmts + 2 * guard) * sizeof(short))) == NULL)
+        goto error;
+    if((in2 = (short *)HDmalloc(2 * nelmts * sizeof(short))) == NULL)
+        goto error;
+
+    for(u = 0; u < (size_t)(nrows * ncols); u++)
+        out[u] = (short)((u * 37) - 16000);
+
+    /* Create and write the dataset */
+    dims[0] = nrows;
+    dims[1] = ncols;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0) goto error;
+    if((dataset = H5Dcreate2(file, DSET_READ_DIRECT_NAME, H5T_NATIVE_SHORT, space,
+            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if(H5Dwrite(dataset, H5T_NATIVE_SHORT, H5S_ALL, H5S_ALL, H5P_DEFAULT, out) < 0)
+        goto error;
+
+    /* Select every other column in the file */
+    start[0] = start[1] = 0;
+    stride[0] = 1;
+    stride[1] = 2;
+    count[0] = nrows;
+    count[1] = ncols / 2;
+    if(H5Sselect_hyperslab(space, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        goto error;
+
+    /* Use a vector size much smaller than the number of blocks */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) goto error;
+    if(H5Pset_hyper_vector_size(dxpl, (size_t)2) < 0) goto error;
+
+    /* Read into a block in the middle of the buffer */
+    for(u = 0; u < nelmts + 2 * guard; u++)
+        in[u] = -1;
+    mdims[0] = nelmts + 2 * guard;
+    if((mspace = H5Screate_simple(1, mdims, NULL)) < 0) goto error;
+    mstart[0] = guard;
+    mdims[0] = nelmts;
+    if(H5Sselect_hyperslab(mspace, H5S_SELECT_SET, mstart, NULL, mdims, NULL) < 0)
+        goto error;
+    if(H5Dread(dataset, H5T_NATIVE_SHORT, mspace, space, dxpl, in) < 0)
+        goto error;
+    if(H5Sclose(mspace) < 0) goto error;
+
+    for(u = 0; u < guard; u++)
+        if(in[u] != -1 || in[guard + nelmts + u] != -1) {
+            H5_FAILED();
+            puts("    Read outside of the memory selection.");
+            goto error;
+        } /* end if */
+    for(u = 0; u < nelmts; u++)
+        if(in[guard + u] != out[2 * u]) {
+            H5_FAILED();
+            printf("    Element %lu read as %d instead of %d.\n", (unsigned long)u,
+                   (int)in[guard + u], (int)out[2 * u]);
+            goto error;
+        } /* end if */
+
+    /* Read into every other element of a buffer */
+    mdims[0] = 2 * nelmts;
+    if((mspace = H5Screate_simple(1, mdims, NULL)) < 0) goto error;
+    mstart[0] = 0;
+    mstride[0] = 2;
+    mdims[0] = nelmts;
+    if(H5Sselect_hyperslab(mspace, H5S_SELECT_SET, mstart, mstride, mdims, NULL) < 0)
+        goto error;
+    if(H5Dread(dataset, H5T_NATIVE_SHORT, mspace, space, dxpl, in2) < 0)
+        goto error;
+    if(H5Sclose(mspace) < 0) goto error;
+
+    for(u = 0; u < nelmts; u++)
+        if(in2[2 * u] != in[guard + u]) {
+            H5_FAILED();
+            printf("    Element %lu differs between block and strided reads.\n", (unsigned long)u);
+            goto error;
+        } /* end if */
+
+    if(H5Pclose(dxpl) < 0) goto error;
+    if(H5Dclose(dataset) < 0) goto error;
+    if(H5Sclose(space) < 0) goto error;
+    HDfree(out);
+    HDfree(in);
+    HDfree(in2);
+
+    PASSED();
+    return 0;
+
+error:
+    if(out)
+        HDfree(out);
+    if(in)
+        HDfree(in);
+    if(in2)
+        HDfree(in2);
+
+    H5E_BEGIN_TRY {
+        H5Pclose(dxpl);
+        H5Dclose(dataset);
+        H5Sclose(mspace);
+        H5Sclose(space);
+    } H5E_END_TRY;
+
+    return -1;
+}
+
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_BOGUS[1] = {{
     H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
@@ -1516,7 +1683,7 @@ static H5Z_cb_return_t
 filter_cb_cont(H5Z_filter_t filter, void H5_ATTR_UNUSED *buf, size_t H5_ATTR_UNUSED buf_size,
            void H5_ATTR_UNUSED *op_data)
 {
-    if(H5Z_FILTER_FLETCHER32==filter)
+    if(H5Z_FILTER_FLETCHER32==filter || H5Z_FILTER_CRC32C==filter)
        return H5Z_CB_CONT;
     else
         return H5Z_CB_FAIL;
@@ -1539,7 +1706,7 @@ static H5Z_cb_return_t
 filter_cb_fail(H5Z_filter_t filter, void H5_ATTR_UNUSED *buf, size_t H5_ATTR_UNUSED buf_size,
            void H5_ATTR_UNUSED *op_data)
 {
-    if(H5Z_FILTER_FLETCHER32==filter)
+    if(H5Z_FILTER_FLETCHER32==filter || H5Z_FILTER_CRC32C==filter)
        return H5Z_CB_FAIL;
     else
        return H5Z_CB_CONT;
@@ -2194,6 +2361,35 @@ H5_ATTR_UNUSED
     /* Clean up objects used for this test */
     if(H5Pclose (dc) < 0) goto error;
 
+    /*----------------------------------------------------------
+     * STEP 1a: Test CRC32C Checksum by itself.
+     *----------------------------------------------------------
+     */
+    puts("Testing CRC32C checksum(enabled for read)");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_crc32c(dc) < 0) goto error;
+
+    /* Enable checksum during read */
+    if(test_filter_internal(file,DSET_CRC32C_NAME,dc,ENABLE_FLETCHER32,DATA_NOT_CORRUPTED,&fletcher32_size) < 0) goto error;
+    if(fletcher32_size<=null_size) {
+        H5_FAILED();
+        puts("    Size after checksumming is incorrect.");
+        goto error;
+    } /* end if */
+
+    /* Disable checksum during read */
+    puts("Testing CRC32C checksum(disabled for read)");
+    if(test_filter_internal(file,DSET_CRC32C_NAME_2,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&fletcher32_size) < 0) goto error;
+
+    /* Try to corrupt data and see if checksum fails */
+    puts("Testing CRC32C checksum(when data is corrupted)");
+    if(H5Pset_filter(dc, H5Z_FILTER_CORRUPT, 0, (size_t)3, data_corrupt) < 0) goto error;
+    if(test_filter_internal(file,DSET_CRC32C_NAME_3,dc,DISABLE_FLETCHER32,DATA_CORRUPTED,&fletcher32_size) < 0) goto error;
+
+    /* Clean up objects used for this test */
+    if(H5Pclose (dc) < 0) goto error;
+
 
     /*----------------------------------------------------------
      * STEP 2: Test deflation by itself.
@@ -2703,6 +2899,156 @@ error:
     return -1;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_shuffle_modes
+ *
+ * Purpose:	Checks the byte and bit shuffles against plain loops for
+ *		element sizes with and without vector kernels, element counts
+ *		that leave a remainder, and trailing partial elements, then
+ *		checks that the bit shuffle undoes itself and round trips
+ *		through a dataset.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define SHUF_NELMTS     1037
+#define SHUF_MAX_SIZE   16
+static herr_t
+test_shuffle_modes(hid_t file)
+{
+    const size_t        sizes[] = {1, 2, 3, 4, 8, 16};
+    unsigned            cd_values[H5Z_SHUFFLE_MODE_NPARMS];
+    unsigned char       *orig = NULL, *expect = NULL, *bytes = NULL;
+    void                *buf = NULL;
+    size_t              buf_size;
+    unsigned            mode;
+    size_t              s, nbytes, size, n, nplane, row, u, i, k;
+    hid_t               dataset = -1, space = -1, dc = -1;
+    const hsize_t       dims[1] = {SHUF_NELMTS};
+    const hsize_t       chunk_dims[1] = {256};
+    unsigned            filter_flags, filter_config;
+    size_t              cd_nelmts;
+    unsigned            *wdata = NULL, *rdata = NULL;
+
+    TESTING("byte and bit shuffle kernels");
+
+    nbytes = SHUF_NELMTS * SHUF_MAX_SIZE + SHUF_MAX_SIZE;
+    if(NULL == (orig = (unsigned char *)HDmalloc(nbytes))) TEST_ERROR
+    if(NULL == (expect = (unsigned char *)HDmalloc(nbytes))) TEST_ERROR
+    if(NULL == (bytes = (unsigned char *)HDmalloc(nbytes))) TEST_ERROR
+    for(u = 0; u < nbytes; u++)
+        orig[u] = (unsigned char)HDrandom();
+
+    for(mode = H5Z_SHUFFLE_BYTE; mode <= H5Z_SHUFFLE_BIT; mode++)
+        for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            size = sizes[s];
+            n = SHUF_NELMTS;
+            nplane = n / 8;
+            nbytes = n * size + (size - 1);
+
+            /* Shuffle with plain loops: bytes first, then bits */
+            for(u = 0; u < n; u++)
+                for(i = 0; i < size; i++)
+                    bytes[i * n + u] = orig[u * size + i];
+            HDmemcpy(bytes + n * size, orig + n * size, nbytes - n * size);
+            if(mode == H5Z_SHUFFLE_BIT) {
+                for(row = 0; row < size; row++) {
+                    for(u = 0; u < nplane; u++)
+                        for(k = 0; k < 8; k++) {
+                            unsigned char c = 0;
+
+                            for(i = 0; i < 8; i++)
+                                c = (unsigned char)(c | (((bytes[row * n + u * 8 + i] >> k) & 1) << i));
+                            expect[row * n + k * nplane + u] = c;
+                        } /* end for */
+                    HDmemcpy(expect + row * n + nplane * 8, bytes + row * n + nplane * 8, n % 8);
+                } /* end for */
+                HDmemcpy(expect + n * size, orig + n * size, nbytes - n * size);
+            } /* end if */
+            else
+                HDmemcpy(expect, bytes, nbytes);
+
+            /* Run the filter forward and compare */
+            if(NULL == (buf = H5MM_malloc(nbytes))) TEST_ERROR
+            HDmemcpy(buf, orig, nbytes);
+            buf_size = nbytes;
+            cd_values[0] = (unsigned)size;
+            cd_values[H5Z_SHUFFLE_PARM_MODE] = mode;
+            if((H5Z_SHUFFLE->filter)(0, (size_t)H5Z_SHUFFLE_MODE_NPARMS, cd_values, nbytes, &buf_size, &buf) != nbytes) TEST_ERROR
+            if(HDmemcmp(buf, expect, nbytes)) {
+                H5_FAILED();
+                printf("    Wrong %s shuffle of %lu-byte elements\n", mode == H5Z_SHUFFLE_BIT ? "bit" : "byte", (unsigned long)size);
+                goto error;
+            } /* end if */
+
+            /* Run it in reverse and compare with the original */
+            if((H5Z_SHUFFLE->filter)(H5Z_FLAG_REVERSE, (size_t)H5Z_SHUFFLE_MODE_NPARMS, cd_values, nbytes, &buf_size, &buf) != nbytes) TEST_ERROR
+            if(HDmemcmp(buf, orig, nbytes)) {
+                H5_FAILED();
+                printf("    Wrong %s unshuffle of %lu-byte elements\n", mode == H5Z_SHUFFLE_BIT ? "bit" : "byte", (unsigned long)size);
+                goto error;
+            } /* end if */
+            buf = H5MM_xfree(buf);
+        } /* end for */
+
+    /* Round trip a bit shuffled dataset and check its stored parameters */
+    if(NULL == (wdata = (unsigned *)HDmalloc(SHUF_NELMTS * sizeof(unsigned)))) TEST_ERROR
+    if(NULL == (rdata = (unsigned *)HDcalloc(SHUF_NELMTS, sizeof(unsigned)))) TEST_ERROR
+    for(u = 0; u < SHUF_NELMTS; u++)
+        wdata[u] = (unsigned)(u * 7);
+    if((space = H5Screate_simple(1, dims, NULL)) < 0) TEST_ERROR
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_chunk(dc, 1, chunk_dims) < 0) TEST_ERROR
+    if(H5Pset_bitshuffle(dc) < 0) TEST_ERROR
+    if((dataset = H5Dcreate2(file, DSET_BITSHUF_NAME, H5T_NATIVE_UINT, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Pclose(dc) < 0) TEST_ERROR
+    if(H5Dwrite(dataset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0) TEST_ERROR
+    if(H5Dread(dataset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0) TEST_ERROR
+    if(HDmemcmp(wdata, rdata, SHUF_NELMTS * sizeof(unsigned))) TEST_ERROR
+    if((dc = H5Dget_create_plist(dataset)) < 0) TEST_ERROR
+    cd_nelmts = H5Z_SHUFFLE_MODE_NPARMS;
+    if(H5Pget_filter_by_id2(dc, H5Z_FILTER_SHUFFLE, &filter_flags, &cd_nelmts, cd_values, (size_t)0, NULL, &filter_config) < 0) TEST_ERROR
+    if(cd_nelmts != H5Z_SHUFFLE_MODE_NPARMS || cd_values[0] != sizeof(unsigned)
+            || cd_values[H5Z_SHUFFLE_PARM_MODE] != H5Z_SHUFFLE_BIT) TEST_ERROR
+    if(H5Pclose(dc) < 0) TEST_ERROR
+    if(H5Dclose(dataset) < 0) TEST_ERROR
+    if(H5Sclose(space) < 0) TEST_ERROR
+
+    HDfree(wdata);
+    HDfree(rdata);
+    HDfree(orig);
+    HDfree(expect);
+    HDfree(bytes);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dc);
+        H5Dclose(dataset);
+        H5Sclose(space);
+    } H5E_END_TRY;
+    if(buf)
+        H5MM_xfree(buf);
+    if(wdata)
+        HDfree(wdata);
+    if(rdata)
+        HDfree(rdata);
+    if(orig)
+        HDfree(orig);
+    if(expect)
+        HDfree(expect);
+    if(bytes)
+        HDfree(bytes);
+    return -1;
+}
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_nbit_int
@@ -7339,6 +7685,351 @@ error:
     return -1;
 } /* end test_chunk_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_cache_stats
+ *
+ * Purpose: Tests the chunk cache statistics API and the chunk cache
+ *          replacement policies.  A pair of chunks in steady use
+ *          followed by a scan across all the chunks should push the
+ *          pair out of an LRU cache, but not out of an ARC cache.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_cache_stats(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dapl2 = -1;     /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim, chunk_dim; /* Dataset and chunk dimensions */
+    hsize_t     start, count;   /* Hyperslab selection */
+    int         wbuf[100];      /* Data to write */
+    int         rbuf[10];       /* One chunk of data read */
+    /* A pair of chunks used twice, a scan across the rest, then the pair again */
+    const int   pattern[] = {0, 1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1};
+    const H5D_chunk_cache_policy_t policies[2] = {H5D_CHUNK_CACHE_POLICY_LRU, H5D_CHUNK_CACHE_POLICY_ARC};
+    const hsize_t exp_hits[2] = {2, 4};         /* Expected hits for each policy */
+    H5D_chunk_cache_stats_t stats;      /* Chunk cache statistics */
+    H5D_chunk_cache_policy_t policy;    /* Chunk cache policy */
+    herr_t      ret;            /* Generic return value */
+    unsigned    u, v;           /* Local index variables */
+
+    TESTING("dataset chunk cache statistics and policies");
+
+    h5_fixname(FILENAME[16], fapl, filename, sizeof filename);
+
+    /* Create file */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Ten chunks of 40 bytes each, with room for four of them in the cache */
+    chunk_dim = 10;
+    dim = 100;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, &chunk_dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)101, (size_t)(4 * chunk_dim * sizeof(int)), H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check the default policy and that invalid policies are rejected */
+    if(H5Pget_chunk_cache_policy(dapl, &policy) < 0) FAIL_STACK_ERROR
+    if(policy != H5D_CHUNK_CACHE_POLICY_W0)
+        FAIL_PUTS_ERROR("    Default chunk cache policy is not H5D_CHUNK_CACHE_POLICY_W0.")
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_NTYPES);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("    Invalid chunk cache policy was accepted.")
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_ERROR);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("    Invalid chunk cache policy was accepted.")
+
+    /* Write the whole dataset through the cache */
+    if(H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_LRU) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    for(u = 0; u < 100; u++)
+        wbuf[u] = (int)u;
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* Six chunks were preempted to make room and written out */
+    if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nevictions != 6 || stats.nflushes != 6 || stats.nbytes_written != 6 * chunk_dim * sizeof(int)
+            || stats.nmisses != 0 || stats.nbytes_read != 0 || stats.nused != 4
+            || stats.nbytes_used != 4 * chunk_dim * sizeof(int) || stats.nslots != 101
+            || stats.policy != H5D_CHUNK_CACHE_POLICY_LRU)
+        FAIL_PUTS_ERROR("    Chunk cache statistics after write are wrong.")
+
+    /* Flushing writes the rest */
+    if(H5Fflush(fid, H5F_SCOPE_LOCAL) < 0) FAIL_STACK_ERROR
+    if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nflushes != 10 || stats.nbytes_written != 10 * chunk_dim * sizeof(int))
+        FAIL_PUTS_ERROR("    Chunk cache statistics after flush are wrong.")
+
+    /* Resetting clears the counters, but not the cache */
+    if(H5Dreset_chunk_cache_stats(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nhits != 0 || stats.nevictions != 0 || stats.nflushes != 0 || stats.nbytes_written != 0
+            || stats.nused != 4)
+        FAIL_PUTS_ERROR("    Chunk cache statistics after reset are wrong.")
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Read the same access pattern with each policy */
+    for(u = 0; u < 2; u++) {
+        if(H5Pset_chunk_cache_policy(dapl, policies[u]) < 0) FAIL_STACK_ERROR
+        if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+
+        /* The dataset's access property list reports the policy in use */
+        if((dapl2 = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+        if(H5Pget_chunk_cache_policy(dapl2, &policy) < 0) FAIL_STACK_ERROR
+        if(policy != policies[u])
+            FAIL_PUTS_ERROR("    Chunk cache policy from retrieved dapl is wrong.")
+        if(H5Pclose(dapl2) < 0) FAIL_STACK_ERROR
+
+        for(v = 0; v < sizeof(pattern) / sizeof(pattern[0]); v++) {
+            start = (hsize_t)pattern[v] * chunk_dim;
+            count = chunk_dim;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+            if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+            if(rbuf[0] != (int)start || rbuf[9] != (int)start + 9)
+                FAIL_PUTS_ERROR("    Data read is wrong.")
+        } /* end for */
+
+        if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+        if(stats.nhits != exp_hits[u]
+                || stats.nmisses != sizeof(pattern) / sizeof(pattern[0]) - exp_hits[u]
+                || stats.nevictions != stats.nmisses - 4
+                || stats.nbytes_read != stats.nmisses * chunk_dim * sizeof(int)
+                || stats.ninits != 0 || stats.nflushes != 0 || stats.nbytes_written != 0
+                || stats.nused != 4 || stats.policy != policies[u]) {
+            HDfprintf(stdout, "    policy %d: nhits = %Hu, nmisses = %Hu, nevictions = %Hu\n",
+                (int)policies[u], stats.nhits, stats.nmisses, stats.nevictions);
+            FAIL_PUTS_ERROR("    Chunk cache statistics after reads are wrong.")
+        } /* end if */
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Statistics are only kept for chunked datasets */
+    if((dsid = H5Dcreate2(fid, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dget_chunk_cache_stats(dsid, &stats);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("    Chunk cache statistics of a contiguous dataset were returned.")
+
+    /* Close */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_cache_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_multi_io
+ *
+ * Purpose: Tests H5Dwrite_multi() and H5Dread_multi() on contiguous
+ *          and chunked datasets, with and without type conversion,
+ *          with the file driver under test and with the core driver,
+ *          which takes lists of blocks.  A dataset listed twice with
+ *          disjoint selections gets both parts.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MULTI_NDSETS    4
+#define MULTI_DIM       100
+static herr_t
+test_multi_io(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    const char *names[MULTI_NDSETS] = {"contig_a", "contig_b", "chunked", "conv"};
+    hid_t       fapl_core = -1; /* File access property list using the core driver */
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       hsid = -1;      /* Dataspace with every other element selected */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsids[MULTI_NDSETS];    /* Dataset IDs */
+    hid_t       mtypes[MULTI_NDSETS];   /* Memory datatypes */
+    hid_t       mspaces[MULTI_NDSETS];  /* Memory dataspaces */
+    hid_t       fspaces[MULTI_NDSETS];  /* File dataspaces */
+    hid_t       twice[2];               /* One dataset listed twice */
+    const void *wbufs[MULTI_NDSETS];    /* Buffers to write */
+    void       *rbufs[MULTI_NDSETS];    /* Buffers to read into */
+    hsize_t     dim = MULTI_DIM, chunk_dim = 10, half = MULTI_DIM / 2;
+    hsize_t     start, stride, count;
+    int         wbuf[MULTI_NDSETS][MULTI_DIM];  /* Data written (adjacent, so the first two merge) */
+    int         rbuf[MULTI_NDSETS][MULTI_DIM];  /* Data read */
+    int         half_buf[MULTI_DIM];    /* Every other element, read back */
+    int         pass;                   /* Which file driver is in use */
+    size_t      u, v;
+    herr_t      ret;
+
+    TESTING("multi-dataset read and write");
+
+    for(u = 0; u < MULTI_NDSETS; u++)
+        dsids[u] = -1;
+
+    if((fapl_core = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fapl_core(fapl_core, (size_t)(64 * KB), FALSE) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+
+    /* Every other element, in the file and packed in memory */
+    if((hsid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    start = 0;
+    stride = 2;
+    count = half;
+    if(H5Sselect_hyperslab(hsid, H5S_SELECT_SET, &start, &stride, &count, NULL) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, &half, NULL)) < 0) FAIL_STACK_ERROR
+
+    for(pass = 0; pass < 2; pass++) {
+        h5_fixname(FILENAME[17], pass ? fapl_core : fapl, filename, sizeof filename);
+        if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, pass ? fapl_core : fapl)) < 0) FAIL_STACK_ERROR
+
+        if((dsids[0] = H5Dcreate2(fid, names[0], H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if((dsids[1] = H5Dcreate2(fid, names[1], H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if((dsids[2] = H5Dcreate2(fid, names[2], H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if((dsids[3] = H5Dcreate2(fid, names[3], H5T_STD_I16BE, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+        /* Write all the datasets at once */
+        for(u = 0; u < MULTI_NDSETS; u++) {
+            for(v = 0; v < MULTI_DIM; v++)
+                wbuf[u][v] = (int)(u * 1000 + v + (size_t)pass);
+            mtypes[u] = H5T_NATIVE_INT;
+            mspaces[u] = H5S_ALL;
+            fspaces[u] = H5S_ALL;
+            wbufs[u] = wbuf[u];
+            rbufs[u] = rbuf[u];
+        } /* end for */
+        if(H5Dwrite_multi((size_t)MULTI_NDSETS, dsids, mtypes, mspaces, fspaces, H5P_DEFAULT, wbufs) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read them back, both at once and one by one */
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread_multi((size_t)MULTI_NDSETS, dsids, mtypes, mspaces, fspaces, H5P_DEFAULT, rbufs) < 0)
+            FAIL_STACK_ERROR
+        for(u = 0; u < MULTI_NDSETS; u++)
+            for(v = 0; v < MULTI_DIM; v++)
+                if(rbuf[u][v] != wbuf[u][v]) {
+                    printf("    dataset %s, element %u: read %d, wrote %d\n", names[u], (unsigned)v, rbuf[u][v], wbuf[u][v]);
+                    FAIL_PUTS_ERROR("    Wrong data from multi-dataset read.")
+                } /* end if */
+        for(u = 0; u < MULTI_NDSETS; u++) {
+            HDmemset(rbuf[u], 0, sizeof(rbuf[u]));
+            if(H5Dread(dsids[u], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[u]) < 0) FAIL_STACK_ERROR
+            if(HDmemcmp(rbuf[u], wbuf[u], sizeof(wbuf[u])))
+                FAIL_PUTS_ERROR("    Wrong data after multi-dataset write.")
+        } /* end for */
+
+        /* Read every other element of each dataset into packed buffers */
+        for(u = 0; u < MULTI_NDSETS; u++) {
+            mspaces[u] = msid;
+            fspaces[u] = hsid;
+        } /* end for */
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread_multi((size_t)MULTI_NDSETS, dsids, mtypes, mspaces, fspaces, H5P_DEFAULT, rbufs) < 0)
+            FAIL_STACK_ERROR
+        for(u = 0; u < MULTI_NDSETS; u++)
+            for(v = 0; v < half; v++)
+                if(rbuf[u][v] != wbuf[u][2 * v])
+                    FAIL_PUTS_ERROR("    Wrong data from multi-dataset read of a selection.")
+
+        /* Write the two halves of one dataset with one call */
+        for(v = 0; v < MULTI_DIM; v++)
+            half_buf[v] = -(int)v;
+        mspaces[0] = msid;
+        fspaces[0] = hsid;
+        wbufs[0] = half_buf;
+        if((fspaces[1] = H5Scopy(hsid)) < 0) FAIL_STACK_ERROR
+        start = 1;
+        if(H5Sselect_hyperslab(fspaces[1], H5S_SELECT_SET, &start, &stride, &count, NULL) < 0) FAIL_STACK_ERROR
+        mspaces[1] = msid;
+        wbufs[1] = half_buf + half;
+        twice[0] = twice[1] = dsids[0];
+        ret = H5Dwrite_multi((size_t)2, twice, mtypes, mspaces, fspaces, H5P_DEFAULT, wbufs);
+        if(H5Sclose(fspaces[1]) < 0) FAIL_STACK_ERROR
+        if(ret < 0) FAIL_STACK_ERROR
+
+        if(H5Dread(dsids[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[0]) < 0) FAIL_STACK_ERROR
+        for(v = 0; v < half; v++)
+            if(rbuf[0][2 * v] != half_buf[v] || rbuf[0][2 * v + 1] != half_buf[half + v])
+                FAIL_PUTS_ERROR("    Wrong data after writing one dataset twice.")
+
+        /* A bad dataset ID fails the whole call */
+        twice[1] = sid;
+        H5E_BEGIN_TRY {
+            ret = H5Dread_multi((size_t)2, twice, mtypes, mspaces, fspaces, H5P_DEFAULT, rbufs);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            FAIL_PUTS_ERROR("    Multi-dataset read of a dataspace ID succeeded.")
+
+        for(u = 0; u < MULTI_NDSETS; u++) {
+            if(H5Dclose(dsids[u]) < 0) FAIL_STACK_ERROR
+            dsids[u] = -1;
+        } /* end for */
+        if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+        fid = -1;
+    } /* end for */
+
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(hsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(fapl_core) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        for(u = 0; u < MULTI_NDSETS; u++)
+            H5Dclose(dsids[u]);
+        H5Sclose(msid);
+        H5Sclose(hsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(fapl_core);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_multi_io() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_big_chunks_bypass_cache
@@ -8040,6 +8731,361 @@ error:
 } /* end test_zero_dim_dset() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_nthreads
+ *
+ * Purpose:     Tests reading and writing a filtered, chunked dataset with
+ *              the filter pipeline running on several threads (which falls
+ *              back to a single thread in builds that aren't thread-safe).
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_nthreads(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dxpl = -1;      /* Dataset transfer property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {DSET_DIM1, DSET_DIM2};       /* Dataset dimensions */
+    hsize_t     chunk_dims[2] = {FILT_THREADS_CHUNK_DIM1, FILT_THREADS_CHUNK_DIM2}; /* Chunk dimensions */
+    hsize_t     start[2], count[2];     /* Hyperslab selection */
+    unsigned    nthreads;       /* Number of threads retrieved */
+    herr_t      ret;            /* Generic return value */
+    int         i, j;           /* Local index variables */
+
+    TESTING("filtering chunks on several threads");
+
+    h5_fixname(FILENAME[14], fapl, filename, sizeof filename);
+
+    /* Check the DXPL property */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_filter_nthreads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 1) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_filter_nthreads(dxpl, 0);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Pset_filter_nthreads(dxpl, FILT_THREADS_NTHREADS) < 0) FAIL_STACK_ERROR
+    if(H5Pget_filter_nthreads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != FILT_THREADS_NTHREADS) TEST_ERROR
+
+    /* Initialize the data */
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            points[i][j] = i * DSET_DIM2 + j;
+
+    /* Create file & filtered dataset */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if(H5Pset_deflate(dcpl, 6) < 0) FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, FILT_THREADS_DATASET, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Re-open the dataset with a chunk cache too small to hold all the
+     * chunks, so that each read has chunks to decode */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)11, (size_t)(4 * FILT_THREADS_CHUNK_DIM1 * FILT_THREADS_CHUNK_DIM2 * sizeof(int)), H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, FILT_THREADS_DATASET, dapl)) < 0) FAIL_STACK_ERROR
+
+    /* Read the whole dataset */
+    HDmemset(check, 0, sizeof(check));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, check) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            if(points[i][j] != check[i][j]) {
+                H5_FAILED();
+                printf("    Read different values than written.\n");
+                printf("    At index %d,%d\n", i, j);
+                goto error;
+            } /* end if */
+
+    /* Read a hyperslab that straddles chunks, some of which are cached */
+    start[0] = 5; start[1] = 15;
+    count[0] = 50; count[1] = 100;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(2, count, NULL)) < 0) FAIL_STACK_ERROR
+    HDmemset(check, 0, sizeof(check));
+    if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, dxpl, check) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < (int)count[0]; i++)
+        for(j = 0; j < (int)count[1]; j++)
+            if(points[i + (int)start[0]][j + (int)start[1]] != ((int *)check)[i * (int)count[1] + j]) {
+                H5_FAILED();
+                printf("    Read different values than written.\n");
+                printf("    At index %d,%d\n", i, j);
+                goto error;
+            } /* end if */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Write a dataset with the chunks encoded on several threads, through
+     * the small chunk cache, and read it back on one thread */
+    if((dsid = H5Dcreate2(fid, FILT_THREADS_WDATASET, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, points) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, dxpl, check) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, FILT_THREADS_WDATASET, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(check, 0, sizeof(check));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            if(points[i][j] != check[i][j]) {
+                H5_FAILED();
+                printf("    Read different values than written.\n");
+                printf("    At index %d,%d\n", i, j);
+                goto error;
+            } /* end if */
+
+    /* Close everything */
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dxpl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_index_one
+ *
+ * Purpose:     Helper for test_chunk_index: creates a chunked dataset with
+ *              the given maximum dimensions, checks which chunk index the
+ *              library picked, then writes, extends, shrinks, re-opens,
+ *              copies and re-reads it.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_index_one(hid_t fid, const char *name, const hsize_t *max_dims,
+    hbool_t filter, H5D_chunk_index_t expect_idx)
+{
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {CHUNK_IDX_DIM1, CHUNK_IDX_DIM2};    /* Dataset dimensions */
+    hsize_t     chunk_dims[2] = {CHUNK_IDX_CHUNK_DIM1, CHUNK_IDX_CHUNK_DIM2};     /* Chunk dimensions */
+    hsize_t     ext_dims[2] = {CHUNK_IDX_DIM1, CHUNK_IDX_DIM2};/* Extended dimensions */
+    hsize_t     start[2], count[2];     /* Hyperslab selection */
+    H5D_chunk_index_t idx_type; /* Chunk index type */
+    char        copy_name[64];  /* Name of copied dataset */
+    int         *wbuf = NULL;   /* Write buffer */
+    int         *rbuf = NULL;   /* Read buffer */
+    hbool_t     extendible;     /* Whether the dataset can grow */
+    size_t      i, j;           /* Local index variables */
+
+    /* Extend along the unlimited dimension, if there is one */
+    extendible = (max_dims[0] == H5S_UNLIMITED || max_dims[1] == H5S_UNLIMITED);
+    if(max_dims[1] == H5S_UNLIMITED)
+        ext_dims[1] = CHUNK_IDX_EXT_DIM2;
+    else if(max_dims[0] == H5S_UNLIMITED)
+        ext_dims[0] = CHUNK_IDX_DIM1 * 2;
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * (size_t)(ext_dims[0] * ext_dims[1])))) TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * (size_t)(ext_dims[0] * ext_dims[1])))) TEST_ERROR
+    for(i = 0; i < (size_t)(ext_dims[0] * ext_dims[1]); i++)
+        wbuf[i] = (int)i;
+
+    /* Create the dataset */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(filter) {
+        if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+        if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    } /* end if */
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    /* Check the chunk index type */
+    if(H5D__layout_idx_type_test(dsid, &idx_type) < 0) FAIL_STACK_ERROR
+    if(idx_type != expect_idx) TEST_ERROR
+
+    /* Write the initial extent (the buffer is laid out for the extended dimensions) */
+    if((sid = H5Screate_simple(2, ext_dims, NULL)) < 0) FAIL_STACK_ERROR
+    start[0] = start[1] = 0;
+    count[0] = dims[0];
+    count[1] = dims[1];
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, sid, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    /* Grow the dataset and fill in the new part */
+    if(extendible) {
+        if(H5Dset_extent(dsid, ext_dims) < 0) FAIL_STACK_ERROR
+        if((sid = H5Screate_simple(2, ext_dims, NULL)) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, sid, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+        /* Shrink it back, dropping the chunks past the new extent */
+        if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+    } /* end if */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Copy the dataset */
+    HDsnprintf(copy_name, sizeof(copy_name), "%s_copy", name);
+    if(H5Ocopy(fid, name, fid, copy_name, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* Verify the data in the original and the copy */
+    for(j = 0; j < 2; j++) {
+        if((dsid = H5Dopen2(fid, j ? copy_name : name, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5D__layout_idx_type_test(dsid, &idx_type) < 0) FAIL_STACK_ERROR
+        if(idx_type != expect_idx) TEST_ERROR
+
+        /* Read the whole dataset */
+        if((sid = H5Screate_simple(2, ext_dims, NULL)) < 0) FAIL_STACK_ERROR
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(int) * (size_t)(ext_dims[0] * ext_dims[1]));
+        if(H5Dread(dsid, H5T_NATIVE_INT, sid, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+        for(i = 0; i < (size_t)dims[0]; i++) {
+            size_t k;
+
+            for(k = 0; k < (size_t)dims[1]; k++)
+                if(rbuf[i * ext_dims[1] + k] != wbuf[i * ext_dims[1] + k]) {
+                    H5_FAILED();
+                    printf("    Read different values than written.\n");
+                    printf("    At index %u,%u\n", (unsigned)i, (unsigned)k);
+                    goto error;
+                } /* end if */
+        } /* end for */
+
+        /* Grow the dataset again; the dropped chunks must read back as fill values */
+        if(extendible) {
+            if(H5Dset_extent(dsid, ext_dims) < 0) FAIL_STACK_ERROR
+            if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+            for(i = 0; i < (size_t)ext_dims[0]; i++) {
+                size_t k;
+
+                for(k = 0; k < (size_t)ext_dims[1]; k++)
+                    if(i >= dims[0] || k >= dims[1])
+                        if(rbuf[i * ext_dims[1] + k] != 0) {
+                            H5_FAILED();
+                            printf("    Read non-fill value from removed chunk.\n");
+                            printf("    At index %u,%u\n", (unsigned)i, (unsigned)k);
+                            goto error;
+                        } /* end if */
+            } /* end for */
+        } /* end if */
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+} /* end test_chunk_index_one() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_index
+ *
+ * Purpose:     Tests that the chunk index is picked from the dataset's
+ *              maximum dimensions with the latest file format (fixed array
+ *              for fixed-size datasets, extensible array for a single
+ *              unlimited dimension, v1 B-tree otherwise), and that I/O
+ *              works with each of them.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_index(hid_t fapl, hbool_t new_format)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hsize_t     fixed_dims[2] = {CHUNK_IDX_DIM1, CHUNK_IDX_DIM2};  /* Fixed max. dims */
+    hsize_t     unlim_first[2] = {H5S_UNLIMITED, CHUNK_IDX_DIM2};   /* Unlimited first dim */
+    hsize_t     unlim_last[2] = {CHUNK_IDX_DIM1 * 2, H5S_UNLIMITED}; /* Unlimited last dim */
+    hsize_t     unlim_both[2] = {H5S_UNLIMITED, H5S_UNLIMITED};     /* Both dims unlimited */
+    unsigned    filter;         /* Whether to use filters */
+
+    TESTING("chunk index selection and I/O");
+
+    h5_fixname(FILENAME[15], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    for(filter = 0; filter < 2; filter++) {
+        if(test_chunk_index_one(fid, filter ? "fixed_filt" : "fixed", fixed_dims, (hbool_t)filter,
+                new_format ? H5D_CHUNK_IDX_FARRAY : H5D_CHUNK_IDX_BTREE) < 0)
+            goto error;
+        if(test_chunk_index_one(fid, filter ? "unlim_first_filt" : "unlim_first", unlim_first, (hbool_t)filter,
+                new_format ? H5D_CHUNK_IDX_EARRAY : H5D_CHUNK_IDX_BTREE) < 0)
+            goto error;
+        if(test_chunk_index_one(fid, filter ? "unlim_last_filt" : "unlim_last", unlim_last, (hbool_t)filter,
+                new_format ? H5D_CHUNK_IDX_EARRAY : H5D_CHUNK_IDX_BTREE) < 0)
+            goto error;
+        if(test_chunk_index_one(fid, filter ? "unlim_both_filt" : "unlim_both", unlim_both, (hbool_t)filter,
+                H5D_CHUNK_IDX_BTREE) < 0)
+            goto error;
+    } /* end for */
+
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_index() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -9148,8 +10194,10 @@ main(void)
         nerrors += (test_max_compact(my_fapl) < 0  		? 1 : 0);
         nerrors += (test_conv_buffer(file) < 0		        ? 1 : 0);
         nerrors += (test_tconv(file) < 0			? 1 : 0);
+        nerrors += (test_read_direct(file) < 0		? 1 : 0);
         nerrors += (test_filters(file, my_fapl) < 0		? 1 : 0);
         nerrors += (test_onebyte_shuffle(file) < 0 		? 1 : 0);
+        nerrors += (test_shuffle_modes(file) < 0 		? 1 : 0);
         nerrors += (test_nbit_int(file) < 0 		        ? 1 : 0);
         nerrors += (test_nbit_float(file) < 0         	        ? 1 : 0);
         nerrors += (test_nbit_double(file) < 0         	        ? 1 : 0);
@@ -9185,11 +10233,15 @@ main(void)
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
         nerrors += (test_huge_chunks(my_fapl) < 0		? 1 : 0);
         nerrors += (test_chunk_cache(my_fapl) < 0		? 1 : 0);
+        nerrors += (test_chunk_cache_stats(my_fapl) < 0	? 1 : 0);
+        nerrors += (test_multi_io(my_fapl) < 0		? 1 : 0);
         nerrors += (test_big_chunks_bypass_cache(my_fapl) < 0   ? 1 : 0);
         nerrors += (test_chunk_expand(my_fapl) < 0		? 1 : 0);
         nerrors += (test_layout_extend(my_fapl) < 0		? 1 : 0);
         nerrors += (test_large_chunk_shrink(my_fapl) < 0        ? 1 : 0);
         nerrors += (test_zero_dim_dset(my_fapl) < 0             ? 1 : 0);
+        nerrors += (test_filter_nthreads(my_fapl) < 0           ? 1 : 0);
+        nerrors += (test_chunk_index(my_fapl, new_format) < 0  ? 1 : 0);
 
         if(H5Fclose(file) < 0)
             goto error;
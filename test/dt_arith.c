@@ -662,6 +662,183 @@ error:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_hard_packed
+ *
+ * Purpose:     Tests hard conversions of packed buffers, which may use the
+ *              library's vector kernels, against plain C casts.  Element
+ *              counts are odd so that both the vector and scalar parts of
+ *              each conversion are used, and the buffers are converted in
+ *              place as H5Tconvert does.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_hard_packed(void)
+{
+    const size_t nelmts = 1027;         /* Number of elements to convert */
+    short       *s_src = NULL;          /* Source shorts */
+    int         *i_src = NULL;          /* Source ints */
+    float       *f_src = NULL;          /* Source floats */
+    double      *d_src = NULL;          /* Source doubles */
+    void        *buf = NULL;            /* Conversion buffer */
+    hid_t       be_type = -1;           /* Big-endian copy of native double */
+    size_t      u;                      /* Local index variable */
+
+    TESTING("hard conversions of packed buffers");
+
+    if(NULL == (s_src = (short *)HDmalloc(nelmts * sizeof(short))))
+        goto error;
+    if(NULL == (i_src = (int *)HDmalloc(nelmts * sizeof(int))))
+        goto error;
+    if(NULL == (f_src = (float *)HDmalloc(nelmts * sizeof(float))))
+        goto error;
+    if(NULL == (d_src = (double *)HDmalloc(nelmts * sizeof(double))))
+        goto error;
+    if(NULL == (buf = HDmalloc(nelmts * sizeof(double))))
+        goto error;
+
+    for(u = 0; u < nelmts; u++) {
+        s_src[u] = (short)((u * 977) - 30000);
+        i_src[u] = (int)((u * 2654435761U) ^ 0x5a5a5a5a);
+        f_src[u] = (float)i_src[u] / 7.0f;
+        d_src[u] = (double)i_src[u] * 1.0e30 / 3.0;
+    } /* end for */
+    /* Values just past FLT_MAX round down in hardware but overflow here */
+    d_src[1] = (double)FLT_MAX * (1.0 + 1.0e-9);
+    d_src[2] = -(double)FLT_MAX * (1.0 + 1.0e-9);
+    /* (and in the elements left over after the vector blocks) */
+    d_src[nelmts - 2] = -(double)FLT_MAX * (1.0 + 1.0e-9);
+    d_src[nelmts - 1] = (double)FLT_MAX * (1.0 + 1.0e-9);
+
+    /* short -> float */
+    HDmemcpy(buf, s_src, nelmts * sizeof(short));
+    if(H5Tconvert(H5T_NATIVE_SHORT, H5T_NATIVE_FLOAT, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    for(u = 0; u < nelmts; u++)
+        if(((float *)buf)[u] != (float)s_src[u]) {
+            H5_FAILED();
+            printf("    short -> float element %lu: %g != %g\n", (unsigned long)u,
+                   (double)((float *)buf)[u], (double)(float)s_src[u]);
+            goto error;
+        } /* end if */
+
+    /* int -> double */
+    HDmemcpy(buf, i_src, nelmts * sizeof(int));
+    if(H5Tconvert(H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    for(u = 0; u < nelmts; u++)
+        if(((double *)buf)[u] != (double)i_src[u]) {
+            H5_FAILED();
+            printf("    int -> double element %lu differs\n", (unsigned long)u);
+            goto error;
+        } /* end if */
+
+    /* float -> double */
+    HDmemcpy(buf, f_src, nelmts * sizeof(float));
+    if(H5Tconvert(H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    for(u = 0; u < nelmts; u++)
+        if(((double *)buf)[u] != (double)f_src[u]) {
+            H5_FAILED();
+            printf("    float -> double element %lu differs\n", (unsigned long)u);
+            goto error;
+        } /* end if */
+
+    /* double -> float, with out of range values becoming infinities */
+    HDmemcpy(buf, d_src, nelmts * sizeof(double));
+    if(H5Tconvert(H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    for(u = 0; u < nelmts; u++) {
+        float expect;
+
+        if(d_src[u] > FLT_MAX)
+            expect = (float)HUGE_VAL;
+        else if(d_src[u] < -FLT_MAX)
+            expect = (float)-HUGE_VAL;
+        else
+            expect = (float)d_src[u];
+        if(((float *)buf)[u] != expect) {
+            H5_FAILED();
+            printf("    double -> float element %lu: %g != %g\n", (unsigned long)u,
+                   (double)((float *)buf)[u], (double)expect);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Byte order swap of doubles, there and back again */
+    if((be_type = H5Tcopy(H5T_NATIVE_DOUBLE)) < 0)
+        goto error;
+    if(H5Tset_order(be_type, H5T_ORDER_LE == H5Tget_order(H5T_NATIVE_DOUBLE) ? H5T_ORDER_BE : H5T_ORDER_LE) < 0)
+        goto error;
+    HDmemcpy(buf, d_src, nelmts * sizeof(double));
+    if(H5Tconvert(H5T_NATIVE_DOUBLE, be_type, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    for(u = 0; u < nelmts; u++) {
+        const unsigned char *a = (const unsigned char *)&d_src[u];
+        const unsigned char *b = (const unsigned char *)buf + u * sizeof(double);
+        size_t v;
+
+        for(v = 0; v < sizeof(double); v++)
+            if(a[v] != b[sizeof(double) - 1 - v]) {
+                H5_FAILED();
+                printf("    double byte swap of element %lu differs\n", (unsigned long)u);
+                goto error;
+            } /* end if */
+    } /* end for */
+    if(H5Tconvert(be_type, H5T_NATIVE_DOUBLE, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    if(HDmemcmp(buf, d_src, nelmts * sizeof(double))) {
+        H5_FAILED();
+        printf("    double byte swap didn't round trip\n");
+        goto error;
+    } /* end if */
+    if(H5Tclose(be_type) < 0)
+        goto error;
+
+    HDfree(s_src);
+    HDfree(i_src);
+    HDfree(f_src);
+    HDfree(d_src);
+    HDfree(buf);
+
+    PASSED();
+
+    /* Restore the default error handler (set in h5_reset()) */
+    h5_restore_err();
+
+    reset_hdf5();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(be_type);
+    } H5E_END_TRY;
+    if(s_src)
+        HDfree(s_src);
+    if(i_src)
+        HDfree(i_src);
+    if(f_src)
+        HDfree(f_src);
+    if(d_src)
+        HDfree(d_src);
+    if(buf)
+        HDfree(buf);
+
+    /* Restore the default error handler (set in h5_reset()) */
+    h5_restore_err();
+
+    reset_hdf5();
+
+    return 1;
+}
+
+
 /*-------------------------------------------------------------------------
  * Function:	expt_handle
  *
@@ -5183,6 +5360,9 @@ main(void)
     /* Test H5Tcompiler_conv() for querying hard conversion. */
     nerrors += test_hard_query();
 
+    /* Test hard conversions of packed buffers */
+    nerrors += test_hard_packed();
+
     /* Test user-define, query functions and software conversion
      * for user-defined floating-point types */
     nerrors += test_derived_flt();
@@ -892,6 +892,12 @@ h5_fileaccess(void)
          * and copy buffer size to the default values. */
         if (H5Pset_fapl_direct(fapl, 1024, 4096, 8*4096)<0)
             return -1;
+#endif
+    } else if (!HDstrcmp(name, "aio")) {
+#ifdef H5_HAVE_AIO
+        /* Queued reads and writes with the default queue depth and threads */
+        if (H5Pset_fapl_aio(fapl, 0, 0, 0)<0)
+            return -1;
 #endif
     } else if(!HDstrcmp(name, "latest")) {
         /* use the latest format */
@@ -1027,6 +1033,12 @@ h5_get_vfd_fapl(void)
          */
         if(H5Pset_fapl_direct(fapl, 1024, 4096, 8*4096)<0)
             return -1;
+#endif
+#ifdef H5_HAVE_AIO
+    } else if(!HDstrcmp(tok, "aio")) {
+        /* Queued reads and writes with the default queue depth and threads */
+        if(H5Pset_fapl_aio(fapl, 0, 0, 0)<0)
+            return -1;
 #endif
     } else {
         /* Unknown driver */
@@ -1310,6 +1322,9 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
                 driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_AIO
+                driver == H5FD_AIO ||
+#endif /* H5_HAVE_AIO */
                 driver == H5FD_LOG) {
             /* Get the file's statistics */
             if(0 == HDstat(filename, &sb))
@@ -1609,6 +1609,162 @@ error:
     return 1;
 } /* end test_move_preserves() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_path_cache
+ *
+ * Purpose:     Check that repeated opens through the same path prefixes
+ *              resolve correctly as links are moved, removed, re-created
+ *              and as files are mounted over cached groups.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_cache(hid_t fapl, hbool_t new_format)
+{
+    hid_t       fid = (-1), fid2 = (-1);        /* File IDs */
+    hid_t       gid = (-1);                     /* Group ID */
+    hid_t       sid = (-1);                     /* Dataspace ID */
+    hid_t       did = (-1);                     /* Dataset ID */
+    char        objname[NAME_BUF_SIZE];         /* Object name */
+    char        filename[NAME_BUF_SIZE];
+    char        filename2[NAME_BUF_SIZE];
+    int         i;
+
+    if(new_format)
+        TESTING("path cache (w/new group format)")
+    else
+        TESTING("path cache")
+
+    /* Create a file with a nested dataset */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+    if((sid = H5Screate(H5S_SCALAR)) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/a", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/a/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/a/b/c", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((did = H5Dcreate2(fid, "/a/b/c/d1", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    /* Create a file to mount over a cached group */
+    h5_fixname(FILENAME[1], fapl, filename2, sizeof filename2);
+    if((fid2 = H5Fcreate(filename2, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+    if((did = H5Dcreate2(fid2, "m1", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0) TEST_ERROR
+
+    /* Open the dataset repeatedly, by absolute and relative path */
+    for(i = 0; i < 3; i++) {
+        if((did = H5Dopen2(fid, "/a/b/c/d1", H5P_DEFAULT)) < 0) TEST_ERROR
+        if(H5Iget_name(did, objname, (size_t)NAME_BUF_SIZE) < 0) TEST_ERROR
+        if(HDstrcmp(objname, "/a/b/c/d1")) TEST_ERROR
+        if(H5Dclose(did) < 0) TEST_ERROR
+    } /* end for */
+    if((did = H5Dopen2(fid, "//a/./b//c/d1", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Iget_name(did, objname, (size_t)NAME_BUF_SIZE) < 0) TEST_ERROR
+    if(HDstrcmp(objname, "/a/b/c/d1")) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+    if((gid = H5Gopen2(fid, "/a", H5P_DEFAULT)) < 0) TEST_ERROR
+    for(i = 0; i < 2; i++) {
+        if((did = H5Dopen2(gid, "b/c/d1", H5P_DEFAULT)) < 0) TEST_ERROR
+        if(H5Iget_name(did, objname, (size_t)NAME_BUF_SIZE) < 0) TEST_ERROR
+        if(HDstrcmp(objname, "/a/b/c/d1")) TEST_ERROR
+        if(H5Dclose(did) < 0) TEST_ERROR
+    } /* end for */
+
+    /* Move a cached group */
+    if(H5Lmove(fid, "/a/b", fid, "/a/x", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        did = H5Dopen2(fid, "/a/b/c/d1", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(did >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        did = H5Dopen2(gid, "b/c/d1", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(did >= 0) TEST_ERROR
+    if((did = H5Dopen2(fid, "/a/x/c/d1", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Iget_name(did, objname, (size_t)NAME_BUF_SIZE) < 0) TEST_ERROR
+    if(HDstrcmp(objname, "/a/x/c/d1")) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+
+    /* Re-create the old path with a different dataset */
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/a/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/a/b/c", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((did = H5Dcreate2(fid, "/a/b/c/d2", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+    if((did = H5Dopen2(fid, "/a/b/c/d2", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+    if(H5Lexists(fid, "/a/b/c/d1", H5P_DEFAULT) != FALSE) TEST_ERROR
+
+    /* Delete the re-created group */
+    if(H5Ldelete(fid, "/a/b", H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Lexists(fid, "/a/b", H5P_DEFAULT) != FALSE) TEST_ERROR
+    H5E_BEGIN_TRY {
+        did = H5Dopen2(fid, "/a/b/c/d2", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(did >= 0) TEST_ERROR
+
+    /* Hard link the moved group back to its original name */
+    if(H5Lcreate_hard(fid, "/a/x", fid, "/a/b", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    if((did = H5Dopen2(fid, "/a/b/c/d1", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+
+    /* Soft links are followed each time, never cached */
+    if(H5Lcreate_soft("/a/x", fid, "/s", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    for(i = 0; i < 2; i++) {
+        if((did = H5Dopen2(fid, "/s/c/d1", H5P_DEFAULT)) < 0) TEST_ERROR
+        if(H5Dclose(did) < 0) TEST_ERROR
+    } /* end for */
+    if(H5Lmove(fid, "/a/x", fid, "/a/y", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        did = H5Dopen2(fid, "/s/c/d1", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(did >= 0) TEST_ERROR
+
+    /* Mount a file over a cached group */
+    if((did = H5Dopen2(fid, "/a/b/c/d1", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+    if(H5Fmount(fid, "/a/b/c", fid2, H5P_DEFAULT) < 0) TEST_ERROR
+    if((did = H5Dopen2(fid, "/a/b/c/m1", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        did = H5Dopen2(fid, "/a/b/c/d1", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(did >= 0) TEST_ERROR
+    if(H5Funmount(fid, "/a/b/c") < 0) TEST_ERROR
+    if((did = H5Dopen2(fid, "/a/b/c/d1", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+
+    /* Close objects */
+    if(H5Sclose(sid) < 0) TEST_ERROR
+    if(H5Fclose(fid2) < 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Gclose(gid);
+        H5Sclose(sid);
+        H5Fclose(fid2);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_deprec
@@ -14550,6 +14706,7 @@ main(void)
         nerrors += test_move(my_fapl, new_format);
         nerrors += test_copy(my_fapl, new_format);
         nerrors += test_move_preserves(my_fapl, new_format);
+        nerrors += test_path_cache(my_fapl, new_format);
 #ifndef H5_NO_DEPRECATED_SYMBOLS
         nerrors += test_deprec(my_fapl, new_format);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
@@ -0,0 +1,604 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Tests the page buffer, which caches page-aligned blocks of
+ *              the file beneath the metadata accumulator.
+ */
+#include "h5test.h"
+
+const char *FILENAME[] = {
+    "page_buffer",
+    NULL
+};
+
+#define PAGE_SIZE       4096
+#define NUM_PAGES       64
+#define INTS_PER_PAGE   (PAGE_SIZE / (int)sizeof(int))
+#define NUM_ELMTS       (NUM_PAGES * INTS_PER_PAGE)
+#define NUM_GROUPS      50
+#define DSET_NAME       "dset"
+#define NUM_SMALL_DSETS 32
+#define SMALL_DSET_SIZE 8
+
+/* Local prototypes */
+static unsigned test_args(hid_t fapl);
+static unsigned test_raw_data(hid_t fapl);
+static unsigned test_eviction(hid_t fapl);
+static unsigned test_metadata(hid_t fapl);
+static unsigned test_eoa_growth(hid_t fapl);
+static herr_t read_elmt(hid_t did, hsize_t idx, int *val);
+static herr_t write_elmt(hid_t did, hsize_t idx, int val);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    read_elmt / write_elmt
+ *
+ * Purpose:     Read or write a single element of a 1-D integer dataset,
+ *              so that each call results in one small file access.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+read_elmt(hid_t did, hsize_t idx, int *val)
+{
+    hsize_t one = 1;
+    hid_t fsid = -1, msid = -1;
+
+    if((fsid = H5Dget_space(did)) < 0) goto error;
+    if(H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &idx, NULL, &one, NULL) < 0) goto error;
+    if((msid = H5Screate_simple(1, &one, NULL)) < 0) goto error;
+    if(H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, val) < 0) goto error;
+    if(H5Sclose(msid) < 0) goto error;
+    if(H5Sclose(fsid) < 0) goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(msid);
+        H5Sclose(fsid);
+    } H5E_END_TRY;
+    return -1;
+} /* end read_elmt() */
+
+static herr_t
+write_elmt(hid_t did, hsize_t idx, int val)
+{
+    hsize_t one = 1;
+    hid_t fsid = -1, msid = -1;
+
+    if((fsid = H5Dget_space(did)) < 0) goto error;
+    if(H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &idx, NULL, &one, NULL) < 0) goto error;
+    if((msid = H5Screate_simple(1, &one, NULL)) < 0) goto error;
+    if(H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, &val) < 0) goto error;
+    if(H5Sclose(msid) < 0) goto error;
+    if(H5Sclose(fsid) < 0) goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(msid);
+        H5Sclose(fsid);
+    } H5E_END_TRY;
+    return -1;
+} /* end write_elmt() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_args
+ *
+ * Purpose:     Check that invalid page buffer settings are rejected, and
+ *              that valid settings round-trip through the FAPL.
+ *
+ * Return:      0 on success, 1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_args(hid_t orig_fapl)
+{
+    char filename[1024];
+    hid_t fapl = -1, fid = -1;
+    size_t buf_size, page_size;
+    unsigned min_meta, min_raw;
+    unsigned accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    herr_t ret;
+
+    TESTING("page buffer property arguments");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+    if((fapl = H5Pcopy(orig_fapl)) < 0) TEST_ERROR
+
+    /* Defaults */
+    if(H5Pget_page_buffer_size(fapl, &buf_size, &min_meta, &min_raw) < 0) TEST_ERROR
+    if(buf_size != 0 || min_meta != 0 || min_raw != 0) TEST_ERROR
+    if(H5Pget_page_buffer_page_size(fapl, &page_size) < 0) TEST_ERROR
+    if(page_size != PAGE_SIZE) TEST_ERROR
+
+    /* Invalid percentages */
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_size(fapl, (size_t)(4 * PAGE_SIZE), 101, 0);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_size(fapl, (size_t)(4 * PAGE_SIZE), 60, 50);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    /* Invalid page sizes */
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_page_size(fapl, (size_t)3000);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_page_size(fapl, (size_t)256);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    /* Valid settings round-trip */
+    if(H5Pset_page_buffer_size(fapl, (size_t)(4 * PAGE_SIZE), 30, 20) < 0) TEST_ERROR
+    if(H5Pset_page_buffer_page_size(fapl, (size_t)(2 * PAGE_SIZE)) < 0) TEST_ERROR
+    if(H5Pget_page_buffer_size(fapl, &buf_size, &min_meta, &min_raw) < 0) TEST_ERROR
+    if(buf_size != 4 * PAGE_SIZE || min_meta != 30 || min_raw != 20) TEST_ERROR
+    if(H5Pget_page_buffer_page_size(fapl, &page_size) < 0) TEST_ERROR
+    if(page_size != 2 * PAGE_SIZE) TEST_ERROR
+
+    /* A buffer smaller than one page can't be used to open a file */
+    if(H5Pset_page_buffer_size(fapl, (size_t)PAGE_SIZE, 0, 0) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    } H5E_END_TRY;
+    if(fid >= 0) TEST_ERROR
+
+    /* Stats aren't available on a file without a page buffer */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, orig_fapl)) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Fget_page_buffering_stats(fid, accesses, hits, misses, evictions, bypasses);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    if(H5Pclose(fapl) < 0) TEST_ERROR
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_args() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_raw_data
+ *
+ * Purpose:     Check that small raw data accesses are buffered, that the
+ *              statistics reflect hits and misses, and that buffered
+ *              writes reach the file.
+ *
+ * Return:      0 on success, 1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_raw_data(hid_t orig_fapl)
+{
+    char filename[1024];
+    hid_t fapl = -1, fid = -1, sid = -1, did = -1;
+    hsize_t dims[1] = {NUM_ELMTS};
+    unsigned accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    int *buf = NULL;
+    int val;
+    int i;
+
+    TESTING("page buffer raw data access");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+    if(NULL == (buf = (int *)HDmalloc(sizeof(int) * NUM_ELMTS))) TEST_ERROR
+    for(i = 0; i < NUM_ELMTS; i++)
+        buf[i] = i;
+
+    /* Small raw data accesses should go straight to the file layer */
+    if((fapl = H5Pcopy(orig_fapl)) < 0) TEST_ERROR
+    if(H5Pset_sieve_buf_size(fapl, (size_t)0) < 0) TEST_ERROR
+    if(H5Pset_page_buffer_size(fapl, (size_t)(16 * PAGE_SIZE), 0, 0) < 0) TEST_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* A full write is larger than a page and bypasses the buffer */
+    if(H5Freset_page_buffering_stats(fid) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+    if(H5Fget_page_buffering_stats(fid, accesses, hits, misses, evictions, bypasses) < 0) FAIL_STACK_ERROR
+    if(accesses[1] != 1 || bypasses[1] != 1) TEST_ERROR
+
+    /* Two reads from the same page: one miss, then one hit */
+    if(H5Freset_page_buffering_stats(fid) < 0) FAIL_STACK_ERROR
+    if(read_elmt(did, (hsize_t)(3 * INTS_PER_PAGE + 1), &val) < 0) TEST_ERROR
+    if(val != 3 * INTS_PER_PAGE + 1) TEST_ERROR
+    if(read_elmt(did, (hsize_t)(3 * INTS_PER_PAGE + 7), &val) < 0) TEST_ERROR
+    if(val != 3 * INTS_PER_PAGE + 7) TEST_ERROR
+    if(H5Fget_page_buffering_stats(fid, accesses, hits, misses, evictions, bypasses) < 0) FAIL_STACK_ERROR
+    if(accesses[1] != 2 || misses[1] != 1 || hits[1] != 1 || bypasses[1] != 0) TEST_ERROR
+
+    /* Small writes are held in the buffer... */
+    for(i = 0; i < NUM_PAGES; i += 8)
+        if(write_elmt(did, (hsize_t)(i * INTS_PER_PAGE + 5), -i) < 0) TEST_ERROR
+
+    /* ...but must be visible to a large read which bypasses it */
+    HDmemset(buf, 0, sizeof(int) * NUM_ELMTS);
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < NUM_ELMTS; i++) {
+        int expect = ((i % INTS_PER_PAGE) == 5 && ((i / INTS_PER_PAGE) % 8) == 0) ? -(i / INTS_PER_PAGE) : i;
+
+        if(buf[i] != expect) TEST_ERROR
+    } /* end for */
+
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Buffered writes must have reached the file */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, orig_fapl)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dopen2(fid, DSET_NAME, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(buf, 0, sizeof(int) * NUM_ELMTS);
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < NUM_ELMTS; i++) {
+        int expect = ((i % INTS_PER_PAGE) == 5 && ((i / INTS_PER_PAGE) % 8) == 0) ? -(i / INTS_PER_PAGE) : i;
+
+        if(buf[i] != expect) TEST_ERROR
+    } /* end for */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    if(H5Pclose(fapl) < 0) TEST_ERROR
+    HDfree(buf);
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    return 1;
+} /* end test_raw_data() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_eviction
+ *
+ * Purpose:     Check that a small page buffer evicts pages, writing dirty
+ *              ones back to the file, without losing any data.
+ *
+ * Return:      0 on success, 1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_eviction(hid_t orig_fapl)
+{
+    char filename[1024];
+    hid_t fapl = -1, fid = -1, sid = -1, did = -1;
+    hsize_t dims[1] = {NUM_ELMTS};
+    unsigned accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    int *buf = NULL;
+    int val;
+    int i;
+
+    TESTING("page buffer eviction");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+    if(NULL == (buf = (int *)HDcalloc(sizeof(int), (size_t)NUM_ELMTS))) TEST_ERROR
+
+    /* Use a buffer that is much smaller than the dataset, with a
+     *  quarter of it reserved for metadata */
+    if((fapl = H5Pcopy(orig_fapl)) < 0) TEST_ERROR
+    if(H5Pset_sieve_buf_size(fapl, (size_t)0) < 0) TEST_ERROR
+    if(H5Pset_page_buffer_size(fapl, (size_t)(4 * PAGE_SIZE), 25, 0) < 0) TEST_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+
+    /* Write one element in every page, twice over */
+    if(H5Freset_page_buffering_stats(fid) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < NUM_PAGES; i++)
+        if(write_elmt(did, (hsize_t)(i * INTS_PER_PAGE), i + 1) < 0) TEST_ERROR
+    for(i = 0; i < NUM_PAGES; i++)
+        if(write_elmt(did, (hsize_t)(i * INTS_PER_PAGE + 1), i + 2) < 0) TEST_ERROR
+    if(H5Fget_page_buffering_stats(fid, accesses, hits, misses, evictions, bypasses) < 0) FAIL_STACK_ERROR
+    if(accesses[1] != 2 * NUM_PAGES) TEST_ERROR
+    if(evictions[1] < NUM_PAGES) TEST_ERROR
+
+    /* Read the elements back through the buffer */
+    for(i = 0; i < NUM_PAGES; i++) {
+        if(read_elmt(did, (hsize_t)(i * INTS_PER_PAGE), &val) < 0) TEST_ERROR
+        if(val != i + 1) TEST_ERROR
+        if(read_elmt(did, (hsize_t)(i * INTS_PER_PAGE + 1), &val) < 0) TEST_ERROR
+        if(val != i + 2) TEST_ERROR
+    } /* end for */
+
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Verify the data without a page buffer */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, orig_fapl)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dopen2(fid, DSET_NAME, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < NUM_ELMTS; i++) {
+        int expect = 0;
+
+        if((i % INTS_PER_PAGE) == 0)
+            expect = (i / INTS_PER_PAGE) + 1;
+        else if((i % INTS_PER_PAGE) == 1)
+            expect = (i / INTS_PER_PAGE) + 2;
+        if(buf[i] != expect) TEST_ERROR
+    } /* end for */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    if(H5Pclose(fapl) < 0) TEST_ERROR
+    HDfree(buf);
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    return 1;
+} /* end test_eviction() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_metadata
+ *
+ * Purpose:     Check that metadata I/O goes through the page buffer and
+ *              that a file created with it can be reopened, with and
+ *              without page buffering.
+ *
+ * Return:      0 on success, 1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_metadata(hid_t orig_fapl)
+{
+    char filename[1024];
+    char name[32];
+    hid_t fapl = -1, fid = -1, gid = -1;
+    unsigned accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    int i;
+
+    TESTING("page buffer metadata access");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if((fapl = H5Pcopy(orig_fapl)) < 0) TEST_ERROR
+    if(H5Pset_page_buffer_size(fapl, (size_t)(8 * PAGE_SIZE), 50, 0) < 0) TEST_ERROR
+
+    /* Create a number of groups, flushing periodically so that
+     *  metadata is written through the buffer */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < NUM_GROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group_%d", i);
+        if((gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+        if((i % 10) == 9)
+            if(H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Fget_page_buffering_stats(fid, accesses, hits, misses, evictions, bypasses) < 0) FAIL_STACK_ERROR
+    if(accesses[0] == 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Reopen with the page buffer and check the groups */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < NUM_GROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group_%d", i);
+        if((gid = H5Gopen2(fid, name, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Fget_page_buffering_stats(fid, accesses, hits, misses, evictions, bypasses) < 0) FAIL_STACK_ERROR
+    if(accesses[0] == 0 || hits[0] == 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Reopen without the page buffer */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, orig_fapl)) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < NUM_GROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group_%d", i);
+        if((gid = H5Gopen2(fid, name, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    if(H5Pclose(fapl) < 0) TEST_ERROR
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_metadata() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_eoa_growth
+ *
+ * Purpose:     Check that a page which was loaded while it extended past
+ *              the end of the file picks up the data later allocated in
+ *              the rest of the page, and that flushing it doesn't write
+ *              over that data.
+ *
+ * Return:      0 on success, 1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_eoa_growth(hid_t orig_fapl)
+{
+    char filename[1024];
+    char dname[32];
+    hid_t fapl = -1, fid = -1, sid = -1, dcpl = -1, did = -1;
+    hsize_t dims[1] = {SMALL_DSET_SIZE};
+    int val;
+    int i, j;
+
+    TESTING("page buffer with a growing end of file");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+    if((fapl = H5Pcopy(orig_fapl)) < 0) TEST_ERROR
+    if(H5Pset_sieve_buf_size(fapl, (size_t)0) < 0) TEST_ERROR
+    if(H5Pset_page_buffer_size(fapl, (size_t)(16 * PAGE_SIZE), 0, 0) < 0) TEST_ERROR
+
+    /* Allocate raw data directly at the end of the file */
+    if(H5Pset_small_data_block_size(fapl, (hsize_t)0) < 0) TEST_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0) FAIL_STACK_ERROR
+
+    /* Each small dataset is allocated at the end of the file, usually in a
+     *  page already buffered by the writes to the previous one */
+    for(i = 0; i < NUM_SMALL_DSETS; i++) {
+        HDsnprintf(dname, sizeof(dname), "%s%d", DSET_NAME, i);
+        if((did = H5Dcreate2(fid, dname, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        for(j = 0; j < SMALL_DSET_SIZE; j++)
+            if(write_elmt(did, (hsize_t)j, i * SMALL_DSET_SIZE + j) < 0) TEST_ERROR
+        if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Read them all back through the buffer */
+    for(i = 0; i < NUM_SMALL_DSETS; i++) {
+        HDsnprintf(dname, sizeof(dname), "%s%d", DSET_NAME, i);
+        if((did = H5Dopen2(fid, dname, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        for(j = 0; j < SMALL_DSET_SIZE; j++) {
+            if(read_elmt(did, (hsize_t)j, &val) < 0) TEST_ERROR
+            if(val != i * SMALL_DSET_SIZE + j) TEST_ERROR
+        } /* end for */
+        if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* And without it */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, orig_fapl)) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < NUM_SMALL_DSETS; i++) {
+        HDsnprintf(dname, sizeof(dname), "%s%d", DSET_NAME, i);
+        if((did = H5Dopen2(fid, dname, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        for(j = 0; j < SMALL_DSET_SIZE; j++) {
+            if(read_elmt(did, (hsize_t)j, &val) < 0) TEST_ERROR
+            if(val != i * SMALL_DSET_SIZE + j) TEST_ERROR
+        } /* end for */
+        if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    if(H5Pclose(fapl) < 0) TEST_ERROR
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_eoa_growth() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Test the page buffer
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    hid_t fapl = -1;
+    unsigned nerrors = 0;
+    const char *env_h5_drvr;
+
+    /* The multi-file drivers don't support page buffering */
+    env_h5_drvr = HDgetenv("HDF5_DRIVER");
+    if(env_h5_drvr == NULL)
+        env_h5_drvr = "nomatch";
+    if(!HDstrcmp(env_h5_drvr, "split") || !HDstrcmp(env_h5_drvr, "multi")) {
+        puts(" -- SKIPPED for incompatible VFD --");
+        return 0;
+    } /* end if */
+
+    h5_reset();
+    fapl = h5_fileaccess();
+
+    nerrors += test_args(fapl);
+    nerrors += test_raw_data(fapl);
+    nerrors += test_eviction(fapl);
+    nerrors += test_metadata(fapl);
+    nerrors += test_eoa_growth(fapl);
+
+    if(nerrors)
+        goto error;
+
+    puts("All page buffer tests passed.");
+    h5_cleanup(FILENAME, fapl);
+
+    return 0;
+
+error:
+    HDputs("*** TESTS FAILED ***");
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    return 1;
+} /* end main() */
+
@@ -0,0 +1,400 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Tests single-writer/multiple-reader (SWMR) file access and
+ *              H5Drefresh.
+ */
+#include "h5test.h"
+
+const char *FILENAME[] = {
+    "swmr",
+    NULL
+};
+
+#define CHUNK_SIZE      8
+#define NROUNDS         16
+#define FIXED_NELMTS    (CHUNK_SIZE * NROUNDS)
+#define EA_DSET_NAME    "extensible"
+#define FA_DSET_NAME    "fixed"
+
+/* Local prototypes */
+static unsigned test_flags(hid_t fapl);
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID)
+static unsigned test_append(hid_t fapl);
+static int reader(const char *filename, hid_t fapl, int from_writer, int to_writer);
+#endif /* defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_flags
+ *
+ * Purpose:     Check which file access flags may be combined with the
+ *              SWMR flags.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_flags(hid_t fapl)
+{
+    char filename[1024];
+    hid_t fid = -1;
+    hid_t fapl2 = -1;
+    hid_t sid = -1, dcpl = -1, did = -1;
+    hsize_t dims[2] = {4, 4};
+    hsize_t max_dims[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t chunk_dims[2] = {2, 2};
+    unsigned intent;
+
+    TESTING("SWMR file access flags");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+
+    /* SWMR writing requires the latest file format */
+    H5E_BEGIN_TRY {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC | H5F_ACC_SWMR_WRITE, H5P_DEFAULT, fapl);
+    } H5E_END_TRY;
+    if(fid >= 0) TEST_ERROR
+
+    if((fapl2 = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_libver_bounds(fapl2, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0) FAIL_STACK_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC | H5F_ACC_SWMR_WRITE, H5P_DEFAULT, fapl2)) < 0) FAIL_STACK_ERROR
+    if(H5Fget_intent(fid, &intent) < 0) FAIL_STACK_ERROR
+    if(intent != (H5F_ACC_RDWR | H5F_ACC_SWMR_WRITE)) TEST_ERROR
+
+    /* Datasets which need a v1 B-tree chunk index can't be created */
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        did = H5Dcreate2(fid, "two_unlim", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(did >= 0) TEST_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Readers may not also be writers, and a writer must be able to write */
+    H5E_BEGIN_TRY {
+        fid = H5Fopen(filename, H5F_ACC_RDWR | H5F_ACC_SWMR_READ, fapl2);
+    } H5E_END_TRY;
+    if(fid >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        fid = H5Fopen(filename, H5F_ACC_RDONLY | H5F_ACC_SWMR_WRITE, fapl2);
+    } H5E_END_TRY;
+    if(fid >= 0) TEST_ERROR
+
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY | H5F_ACC_SWMR_READ, fapl2)) < 0) FAIL_STACK_ERROR
+    if(H5Fget_intent(fid, &intent) < 0) FAIL_STACK_ERROR
+    if(intent != (H5F_ACC_RDONLY | H5F_ACC_SWMR_READ)) TEST_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* The page buffer can't be used with SWMR access */
+    if(H5Pset_page_buffer_size(fapl2, (size_t)(16 * 4096), 0, 0) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        fid = H5Fopen(filename, H5F_ACC_RDONLY | H5F_ACC_SWMR_READ, fapl2);
+    } H5E_END_TRY;
+    if(fid >= 0) TEST_ERROR
+
+    if(H5Pclose(fapl2) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl2);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_flags() */
+
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID)
+
+/*-------------------------------------------------------------------------
+ * Function:    reader
+ *
+ * Purpose:     Reader side of test_append, run in a child process.  For
+ *              every round announced by the writer, refresh the datasets
+ *              and check that the new data is visible.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+reader(const char *filename, hid_t fapl, int from_writer, int to_writer)
+{
+    hid_t fid = -1, ea_did = -1, fa_did = -1, sid = -1;
+    hsize_t dims;
+    int buf[FIXED_NELMTS];
+    int round, ack = 0;
+    int u;
+
+    /* Wait for the writer to create the file */
+    if(HDread(from_writer, &round, sizeof(round)) != (ssize_t)sizeof(round)) goto error;
+
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY | H5F_ACC_SWMR_READ, fapl)) < 0) goto error;
+    if((ea_did = H5Dopen2(fid, EA_DSET_NAME, H5P_DEFAULT)) < 0) goto error;
+    if((fa_did = H5Dopen2(fid, FA_DSET_NAME, H5P_DEFAULT)) < 0) goto error;
+    if(HDwrite(to_writer, &ack, sizeof(ack)) != (ssize_t)sizeof(ack)) goto error;
+
+    while(HDread(from_writer, &round, sizeof(round)) == (ssize_t)sizeof(round) && round > 0) {
+        if(H5Drefresh(ea_did) < 0) goto error;
+        if(H5Drefresh(fa_did) < 0) goto error;
+
+        /* The extensible dataset has grown by one chunk per round */
+        if((sid = H5Dget_space(ea_did)) < 0) goto error;
+        if(H5Sget_simple_extent_dims(sid, &dims, NULL) < 0) goto error;
+        if(H5Sclose(sid) < 0) goto error;
+        sid = -1;
+        if(dims != (hsize_t)(round * CHUNK_SIZE)) goto error;
+        if(H5Dread(ea_did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) goto error;
+        for(u = 0; u < round * CHUNK_SIZE; u++)
+            if(buf[u] != u) goto error;
+
+        /* The fixed-size dataset has one more chunk written per round */
+        if(H5Dread(fa_did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) goto error;
+        for(u = 0; u < FIXED_NELMTS; u++)
+            if(buf[u] != (u < round * CHUNK_SIZE ? -u : 0)) goto error;
+
+        if(HDwrite(to_writer, &ack, sizeof(ack)) != (ssize_t)sizeof(ack)) goto error;
+    } /* end while */
+
+    if(H5Dclose(fa_did) < 0) goto error;
+    if(H5Dclose(ea_did) < 0) goto error;
+    if(H5Fclose(fid) < 0) goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(sid);
+        H5Dclose(fa_did);
+        H5Dclose(ea_did);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end reader() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_append
+ *
+ * Purpose:     A writer appends chunks to a dataset indexed with an
+ *              extensible array and fills in a dataset indexed with a
+ *              fixed array, flushing after each round, while a reader in
+ *              another process follows along with H5Drefresh.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_append(hid_t fapl)
+{
+    char filename[1024];
+    hid_t fid = -1, ea_did = -1, fa_did = -1;
+    hid_t fapl2 = -1, dcpl = -1, sid = -1, fsid = -1, msid = -1;
+    hsize_t dims, max_dims, chunk_dims = CHUNK_SIZE;
+    hsize_t start, count = CHUNK_SIZE;
+    int to_reader[2] = {-1, -1}, from_reader[2] = {-1, -1};
+    int buf[CHUNK_SIZE];
+    int round, ack = 0, status;
+    int fill = 0;
+    pid_t pid = -1;
+    int u;
+
+    TESTING("concurrent reader with H5Drefresh");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+
+    if((fapl2 = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_libver_bounds(fapl2, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0) FAIL_STACK_ERROR
+
+    /* Start the reader before the library has any files open */
+    if(HDpipe(to_reader) < 0 || HDpipe(from_reader) < 0) TEST_ERROR
+    if((pid = HDfork()) < 0) TEST_ERROR
+    if(0 == pid) {
+        int ret;
+
+        HDclose(to_reader[1]);
+        HDclose(from_reader[0]);
+        ret = reader(filename, fapl2, to_reader[0], from_reader[1]);
+        HDclose(to_reader[0]);
+        HDclose(from_reader[1]);
+        HDexit(ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+    } /* end if */
+    HDclose(to_reader[0]);
+    HDclose(from_reader[1]);
+    to_reader[0] = from_reader[1] = -1;
+
+    /* Create the file and the datasets */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC | H5F_ACC_SWMR_WRITE, H5P_DEFAULT, fapl2)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, &chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0) FAIL_STACK_ERROR
+
+    dims = 0;
+    max_dims = H5S_UNLIMITED;
+    if((sid = H5Screate_simple(1, &dims, &max_dims)) < 0) FAIL_STACK_ERROR
+    if((ea_did = H5Dcreate2(fid, EA_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    dims = FIXED_NELMTS;
+    if((sid = H5Screate_simple(1, &dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((fa_did = H5Dcreate2(fid, FA_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    sid = -1;
+
+    if(H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0) FAIL_STACK_ERROR
+    round = 0;
+    if(HDwrite(to_reader[1], &round, sizeof(round)) != (ssize_t)sizeof(round)) TEST_ERROR
+    if(HDread(from_reader[0], &ack, sizeof(ack)) != (ssize_t)sizeof(ack)) TEST_ERROR
+
+    if((msid = H5Screate_simple(1, &count, NULL)) < 0) FAIL_STACK_ERROR
+    for(round = 1; round <= NROUNDS; round++) {
+        start = (hsize_t)((round - 1) * CHUNK_SIZE);
+
+        /* Append a chunk to the extensible dataset */
+        dims = (hsize_t)(round * CHUNK_SIZE);
+        if(H5Dset_extent(ea_did, &dims) < 0) FAIL_STACK_ERROR
+        for(u = 0; u < CHUNK_SIZE; u++)
+            buf[u] = (int)start + u;
+        if((fsid = H5Dget_space(ea_did)) < 0) FAIL_STACK_ERROR
+        if(H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite(ea_did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(fsid) < 0) FAIL_STACK_ERROR
+
+        /* Write the next chunk of the fixed-size dataset */
+        for(u = 0; u < CHUNK_SIZE; u++)
+            buf[u] = -((int)start + u);
+        if((fsid = H5Dget_space(fa_did)) < 0) FAIL_STACK_ERROR
+        if(H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite(fa_did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(fsid) < 0) FAIL_STACK_ERROR
+        fsid = -1;
+
+        /* Make the round visible to the reader */
+        if(H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0) FAIL_STACK_ERROR
+        if(HDwrite(to_reader[1], &round, sizeof(round)) != (ssize_t)sizeof(round)) TEST_ERROR
+        if(HDread(from_reader[0], &ack, sizeof(ack)) != (ssize_t)sizeof(ack)) TEST_ERROR
+    } /* end for */
+
+    /* Tell the reader to finish */
+    round = -1;
+    if(HDwrite(to_reader[1], &round, sizeof(round)) != (ssize_t)sizeof(round)) TEST_ERROR
+    HDclose(to_reader[1]);
+    HDclose(from_reader[0]);
+    to_reader[1] = from_reader[0] = -1;
+    if(HDwaitpid(pid, &status, 0) != pid) TEST_ERROR
+    pid = -1;
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) TEST_ERROR
+
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(fa_did) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(ea_did) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(fapl2) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    if(to_reader[1] >= 0)
+        HDclose(to_reader[1]);
+    if(from_reader[0] >= 0)
+        HDclose(from_reader[0]);
+    if(pid > 0)
+        HDwaitpid(pid, &status, 0);
+    H5E_BEGIN_TRY {
+        H5Sclose(fsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Dclose(fa_did);
+        H5Dclose(ea_did);
+        H5Fclose(fid);
+        H5Pclose(fapl2);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_append() */
+#endif /* defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Test SWMR file access
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    hid_t fapl = -1;
+    unsigned nerrors = 0;
+    const char *env_h5_drvr;
+
+    /* SWMR needs a single file that other processes can open */
+    env_h5_drvr = HDgetenv("HDF5_DRIVER");
+    if(env_h5_drvr == NULL)
+        env_h5_drvr = "nomatch";
+    if(!HDstrcmp(env_h5_drvr, "core") || !HDstrcmp(env_h5_drvr, "split")
+            || !HDstrcmp(env_h5_drvr, "multi") || !HDstrcmp(env_h5_drvr, "family")) {
+        puts(" -- SKIPPED for incompatible VFD --");
+        return 0;
+    } /* end if */
+
+    h5_reset();
+    fapl = h5_fileaccess();
+
+    nerrors += test_flags(fapl);
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID)
+    nerrors += test_append(fapl);
+#else /* defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) */
+    TESTING("concurrent reader with H5Drefresh");
+    SKIPPED();
+    puts("    Test skipped due to fork or waitpid not defined.");
+#endif /* defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) */
+
+    if(nerrors)
+        goto error;
+
+    puts("All SWMR tests passed.");
+    h5_cleanup(FILENAME, fapl);
+
+    return 0;
+
+error:
+    HDputs("*** TESTS FAILED ***");
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    return 1;
+} /* end main() */
@@ -198,6 +198,9 @@ test_chksum_large(void)
     chksum = H5_checksum_crc(large_buf, sizeof(large_buf));
     VERIFY(chksum, 0xfbd0f7c0, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(large_buf, sizeof(large_buf));
+    VERIFY(chksum, 0x1fb99cdb, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(large_buf, sizeof(large_buf), 0);
     VERIFY(chksum, 0x1bd2ee7b, "H5_checksum_lookup3");
 
@@ -209,10 +212,88 @@ test_chksum_large(void)
     chksum = H5_checksum_crc(large_buf, sizeof(large_buf));
     VERIFY(chksum, 0xfac8b4c4, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(large_buf, sizeof(large_buf));
+    VERIFY(chksum, 0xbe1c8d5e, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(large_buf, sizeof(large_buf), 0);
     VERIFY(chksum, 0x930c7afc, "H5_checksum_lookup3");
 } /* test_chksum_large() */
 
+
+/****************************************************************
+**
+**  test_chksum_crc32c(): Checksum the standard CRC32C check string
+**
+****************************************************************/
+static void
+test_chksum_crc32c(void)
+{
+    const char *check = "123456789";    /* Standard check string */
+    uint32_t chksum;                    /* Checksum value */
+
+    chksum = H5_checksum_crc32c(check, HDstrlen(check));
+    VERIFY(chksum, 0xe3069283, "H5_checksum_crc32c");
+
+    /* Unaligned start, exactly eight bytes */
+    chksum = H5_checksum_crc32c(check + 1, HDstrlen(check) - 1);
+    VERIFY(chksum, 0xbfe92a83, "H5_checksum_crc32c");
+} /* test_chksum_crc32c() */
+
+
+/****************************************************************
+**
+**  test_chksum_fletcher32_lengths(): Check the fletcher32 vector
+**      kernels against the byte-at-a-time algorithm for many
+**      lengths and alignments, including data whose sums wrap
+**
+****************************************************************/
+static uint32_t
+ref_fletcher32(const uint8_t *data, size_t _len)
+{
+    size_t len = _len / 2;
+    uint32_t sum1 = 0, sum2 = 0;
+
+    while(len) {
+        size_t tlen = len > 360 ? 360 : len;
+        len -= tlen;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while(--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    if(_len % 2) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return (sum2 << 16) | sum1;
+}
+
+static void
+test_chksum_fletcher32_lengths(void)
+{
+    uint32_t chksum;            /* Checksum value */
+    size_t u, len, off;         /* Local index variables */
+    int pattern;                /* Data pattern */
+
+    for(pattern = 0; pattern < 3; pattern++) {
+        for(u = 0; u < BUF_LEN; u++)
+            large_buf[u] = (uint8_t)(pattern == 0 ? HDrandom() : (pattern == 1 ? 0xff : (u < 64 ? 0 : 0xff)));
+        for(off = 0; off < 4; off++)
+            for(len = 1; len + off <= BUF_LEN; len += (len < 600 ? 1 : 97)) {
+                chksum = H5_checksum_fletcher32(large_buf + off, len);
+                VERIFY(chksum, ref_fletcher32(large_buf + off, len), "H5_checksum_fletcher32");
+            } /* end for */
+    } /* end for */
+} /* test_chksum_fletcher32_lengths() */
+
 
 /****************************************************************
 **
@@ -231,6 +312,8 @@ test_checksum(void)
     test_chksum_size_three();		/* Test buffer w/only 3 bytes */
     test_chksum_size_four();		/* Test buffer w/only 4 bytes */
     test_chksum_large();		/* Test buffer w/larger # of bytes */
+    test_chksum_fletcher32_lengths();	/* Test vector fletcher32 kernels */
+    test_chksum_crc32c();		/* Test CRC32C check value */
 
 } /* test_checksum() */
 
@@ -728,6 +728,143 @@ out:
     return -1;
 } /* end test_remove_clear_type() */
 
+    /* Test lookup, removal & iteration order with many IDs in a type */
+
+/* IDs are kept in a hash table that grows and shrinks with the number of
+ * IDs in the type, and are iterated over in the order they were created.
+ * This test registers enough IDs to resize the table several times, removes
+ * most of them in an interleaved pattern and checks that the rest can still
+ * be found and are visited in increasing order. */
+#define TEST_MANY_NIDS 20000
+
+/* User data for test_many_ids_search_func */
+typedef struct {
+    hid_t last_id;              /* Last ID visited */
+    long nvisited;              /* Number of IDs visited */
+    hbool_t in_order;           /* Whether IDs were visited in increasing order */
+} test_many_ids_ud_t;
+
+static int test_many_ids_search_func(void H5_ATTR_UNUSED *obj, hid_t id, void *_udata)
+{
+    test_many_ids_ud_t *udata = (test_many_ids_ud_t *)_udata;
+
+    if(id <= udata->last_id)
+        udata->in_order = FALSE;
+    udata->last_id = id;
+    udata->nvisited++;
+
+    return 0;
+} /* end test_many_ids_search_func() */
+
+static int test_many_ids(void)
+{
+    H5I_type_t obj_type;
+    static int objs[2 * TEST_MANY_NIDS];
+    static hid_t ids[2 * TEST_MANY_NIDS];
+    test_many_ids_ud_t udata;
+    hsize_t nmembers;
+    void *obj;
+    long nleft;
+    long i;
+    herr_t ret;         /* return value */
+
+    /* Register type */
+    obj_type = H5Iregister_type((size_t)64, 0, NULL);
+    CHECK(obj_type, H5I_BADID, "H5Iregister_type");
+    if(obj_type == H5I_BADID)
+        goto out;
+
+    /* Register the first batch of IDs */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        objs[i] = (int)i;
+        ids[i] = H5Iregister(obj_type, &objs[i]);
+        CHECK(ids[i], FAIL, "H5Iregister");
+        if(ids[i] == FAIL)
+            goto out;
+    } /* end for */
+
+    /* Remove two out of every three IDs */
+    for(i = 0; i < TEST_MANY_NIDS; i++)
+        if(i % 3) {
+            obj = H5Iremove_verify(ids[i], obj_type);
+            VERIFY(obj, &objs[i], "H5Iremove_verify");
+            if(obj != &objs[i])
+                goto out;
+        } /* end if */
+
+    /* Register a second batch of IDs */
+    for(i = TEST_MANY_NIDS; i < 2 * TEST_MANY_NIDS; i++) {
+        objs[i] = (int)i;
+        ids[i] = H5Iregister(obj_type, &objs[i]);
+        CHECK(ids[i], FAIL, "H5Iregister");
+        if(ids[i] == FAIL)
+            goto out;
+    } /* end for */
+
+    /* Remove all but one out of every seven IDs in the second batch */
+    for(i = TEST_MANY_NIDS; i < 2 * TEST_MANY_NIDS; i++)
+        if(i % 7) {
+            obj = H5Iremove_verify(ids[i], obj_type);
+            VERIFY(obj, &objs[i], "H5Iremove_verify");
+            if(obj != &objs[i])
+                goto out;
+        } /* end if */
+
+    /* Verify that the remaining IDs (and only those) can be found */
+    nleft = 0;
+    for(i = 0; i < 2 * TEST_MANY_NIDS; i++) {
+        hbool_t present = (i < TEST_MANY_NIDS) ? (0 == i % 3) : (0 == i % 7);
+
+        obj = H5Iobject_verify(ids[i], obj_type);
+        if(present) {
+            VERIFY(obj, &objs[i], "H5Iobject_verify");
+            if(obj != &objs[i])
+                goto out;
+            nleft++;
+        } /* end if */
+        else {
+            VERIFY(obj, NULL, "H5Iobject_verify");
+            if(obj != NULL)
+                goto out;
+        } /* end else */
+    } /* end for */
+    ret = H5Inmembers(obj_type, &nmembers);
+    CHECK(ret, FAIL, "H5Inmembers");
+    if(ret == FAIL)
+        goto out;
+    VERIFY(nmembers, (hsize_t)nleft, "H5Inmembers");
+    if(nmembers != (hsize_t)nleft)
+        goto out;
+
+    /* Verify that the IDs are visited in increasing order */
+    udata.last_id = 0;
+    udata.nvisited = 0;
+    udata.in_order = TRUE;
+    obj = H5Isearch(obj_type, test_many_ids_search_func, &udata);
+    VERIFY(obj, NULL, "H5Isearch");
+    VERIFY(udata.nvisited, nleft, "H5Isearch");
+    if(udata.nvisited != nleft)
+        goto out;
+    VERIFY(udata.in_order, TRUE, "H5Isearch");
+    if(!udata.in_order)
+        goto out;
+
+    /* Destroy type */
+    ret = H5Idestroy_type(obj_type);
+    CHECK(ret, FAIL, "H5Idestroy_type");
+    if(ret == FAIL)
+        goto out;
+
+    return 0;
+
+out:
+    /* Cleanup.  For simplicity, just destroy the types and ignore errors. */
+    H5E_BEGIN_TRY
+        H5Idestroy_type(obj_type);
+    H5E_END_TRY
+    return -1;
+} /* end test_many_ids() */
+
 void test_ids(void)
 {
     /* Set the random # seed */
@@ -739,5 +876,6 @@ void test_ids(void)
 	if (test_get_type() < 0) TestErrPrintf("H5Iget_type test failed\n");
 	if (test_id_type_list() < 0) TestErrPrintf("ID type list test failed\n");
 	if (test_remove_clear_type() < 0) TestErrPrintf("ID remove during H5Iclear_type test failed\n");
+	if (test_many_ids() < 0) TestErrPrintf("Many IDs test failed\n");
 
 }
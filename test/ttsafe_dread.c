@@ -0,0 +1,288 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing thread safety of concurrent dataset reads
+ * -------------------------------------------------
+ *
+ * Several threads repeatedly read contiguous and chunked datasets, each
+ * from its own file opened read-only, while one more thread reads every
+ * file.  Raw data reads of read-only files are issued without the API
+ * lock held, so this checks that the per-file I/O lock keeps the driver
+ * state consistent and that the data comes back intact.
+ *
+ * Then several threads read one dataset while another thread closes
+ * its file with the "strong" close degree, which checks that a read
+ * keeps the dataset and file alive while it is without the API lock.
+ *
+ * Temporary files generated:
+ *   ttsafe_dread<n>.h5
+ *
+ * HDF5 APIs exercised in thread:
+ * H5Fopen, H5Dopen2, H5Dread, H5Dclose, H5Fclose, H5Pset_fclose_degree.
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME_FMT    "ttsafe_dread%d.h5"
+#define NUM_FILES       4
+#define NUM_ROUNDS      32
+#define DSET_NELMTS     (64 * 1024)
+#define CHUNK_NELMTS    (4 * 1024)
+
+typedef struct dread_info_t {
+    int first;          /* First file read by the thread */
+    int nfiles;         /* Number of files read by the thread */
+    int nerrors;        /* Number of failures seen by the thread */
+} dread_info_t;
+
+typedef struct dread_close_info_t {
+    hid_t dset;         /* Dataset read by the thread, closed by another one */
+    int nerrors;        /* Number of bad reads seen by the thread */
+} dread_close_info_t;
+
+static void *tts_dread_reader(void *);
+static void *tts_dread_close_reader(void *);
+
+static void
+dread_filename(int n, char *name, size_t size)
+{
+    HDsnprintf(name, size, FILENAME_FMT, n);
+}
+
+/* Expected value of element 'u' of the datasets in file 'n' */
+#define DREAD_VALUE(N, U)       ((int)((N) * DSET_NELMTS + (U)))
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent dataset reads from read-only files
+ **********************************************************************
+ */
+void tts_dread(void)
+{
+    H5TS_thread_t threads[NUM_FILES + 1];
+    dread_info_t info[NUM_FILES + 1];
+    char name[32];
+    hid_t file, space, dcpl, dset;
+    hsize_t dims[1] = {DSET_NELMTS};
+    hsize_t chunk_dims[1] = {CHUNK_NELMTS};
+    int *data;
+    int i, n;
+    herr_t ret;
+
+    data = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    assert(data);
+
+    /* Create one file per reader, each with a contiguous and a chunked dataset */
+    space = H5Screate_simple(1, dims, NULL);
+    assert(space >= 0);
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    assert(dcpl >= 0);
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    assert(ret >= 0);
+
+    for(n = 0; n < NUM_FILES; n++) {
+        for(i = 0; i < DSET_NELMTS; i++)
+            data[i] = DREAD_VALUE(n, i);
+
+        dread_filename(n, name, sizeof(name));
+        file = H5Fcreate(name, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        assert(file >= 0);
+
+        dset = H5Dcreate2(file, "contig", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        assert(dset >= 0);
+        ret = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        assert(ret >= 0);
+        ret = H5Dclose(dset);
+        assert(ret >= 0);
+
+        dset = H5Dcreate2(file, "chunked", H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        assert(dset >= 0);
+        ret = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        assert(ret >= 0);
+        ret = H5Dclose(dset);
+        assert(ret >= 0);
+
+        ret = H5Fclose(file);
+        assert(ret >= 0);
+    } /* end for */
+
+    ret = H5Pclose(dcpl);
+    assert(ret >= 0);
+    ret = H5Sclose(space);
+    assert(ret >= 0);
+    HDfree(data);
+
+    /* One reader per file, plus one that reads all of them */
+    for(i = 0; i < NUM_FILES; i++) {
+        info[i].first = i;
+        info[i].nfiles = 1;
+        info[i].nerrors = 0;
+        threads[i] = H5TS_create_thread(tts_dread_reader, NULL, &info[i]);
+    } /* end for */
+    info[NUM_FILES].first = 0;
+    info[NUM_FILES].nfiles = NUM_FILES;
+    info[NUM_FILES].nerrors = 0;
+    threads[NUM_FILES] = H5TS_create_thread(tts_dread_reader, NULL, &info[NUM_FILES]);
+
+    for(i = 0; i <= NUM_FILES; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    for(i = 0; i <= NUM_FILES; i++)
+        if(info[i].nerrors)
+            TestErrPrintf("Reader %d saw %d errors - test failed\n", i, info[i].nerrors);
+
+    /* Close a file with the "strong" degree while its dataset is being read */
+    {
+        dread_close_info_t close_info[NUM_FILES];
+        hid_t fapl;
+        int *buf;
+
+        fapl = H5Pcreate(H5P_FILE_ACCESS);
+        assert(fapl >= 0);
+        ret = H5Pset_fclose_degree(fapl, H5F_CLOSE_STRONG);
+        assert(ret >= 0);
+
+        dread_filename(0, name, sizeof(name));
+        file = H5Fopen(name, H5F_ACC_RDONLY, fapl);
+        assert(file >= 0);
+        dset = H5Dopen2(file, "chunked", H5P_DEFAULT);
+        assert(dset >= 0);
+
+        for(i = 0; i < NUM_FILES; i++) {
+            close_info[i].dset = dset;
+            close_info[i].nerrors = 0;
+            threads[i] = H5TS_create_thread(tts_dread_close_reader, NULL, &close_info[i]);
+        } /* end for */
+
+        /* Read once more here, then close the file and the dataset with it */
+        buf = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+        assert(buf);
+        ret = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        assert(ret >= 0);
+        HDfree(buf);
+        ret = H5Fclose(file);
+        assert(ret >= 0);
+
+        for(i = 0; i < NUM_FILES; i++)
+            H5TS_wait_for_thread(threads[i]);
+
+        for(i = 0; i < NUM_FILES; i++)
+            if(close_info[i].nerrors)
+                TestErrPrintf("Reader %d saw %d bad reads during close - test failed\n", i, close_info[i].nerrors);
+
+        ret = H5Pclose(fapl);
+        assert(ret >= 0);
+    }
+}
+
+static void *
+tts_dread_reader(void *_info)
+{
+    dread_info_t *info = (dread_info_t *)_info;
+    const char *dset_names[] = {"contig", "chunked"};
+    char name[32];
+    hid_t file, dset;
+    int *buf;
+    int round, n, d, u;
+
+    buf = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    assert(buf);
+
+    for(round = 0; round < NUM_ROUNDS; round++)
+        for(n = info->first; n < info->first + info->nfiles; n++) {
+            dread_filename(n, name, sizeof(name));
+            if((file = H5Fopen(name, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0) {
+                info->nerrors++;
+                continue;
+            } /* end if */
+
+            for(d = 0; d < 2; d++) {
+                if((dset = H5Dopen2(file, dset_names[d], H5P_DEFAULT)) < 0) {
+                    info->nerrors++;
+                    continue;
+                } /* end if */
+
+                HDmemset(buf, 0, DSET_NELMTS * sizeof(int));
+                if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+                    info->nerrors++;
+                else
+                    for(u = 0; u < DSET_NELMTS; u++)
+                        if(buf[u] != DREAD_VALUE(n, u)) {
+                            info->nerrors++;
+                            break;
+                        } /* end if */
+
+                if(H5Dclose(dset) < 0)
+                    info->nerrors++;
+            } /* end for */
+
+            if(H5Fclose(file) < 0)
+                info->nerrors++;
+        } /* end for */
+
+    HDfree(buf);
+
+    return NULL;
+}
+
+/* Read a dataset until its ID is closed by another thread */
+static void *
+tts_dread_close_reader(void *_info)
+{
+    dread_close_info_t *info = (dread_close_info_t *)_info;
+    int *buf;
+    int round, u;
+    herr_t ret;
+
+    buf = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    assert(buf);
+
+    for(round = 0; round < NUM_ROUNDS; round++) {
+        HDmemset(buf, 0, DSET_NELMTS * sizeof(int));
+        H5E_BEGIN_TRY {
+            ret = H5Dread(info->dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        } H5E_END_TRY;
+
+        /* Stop once the dataset has been closed */
+        if(ret < 0)
+            break;
+
+        for(u = 0; u < DSET_NELMTS; u++)
+            if(buf[u] != DREAD_VALUE(0, u)) {
+                info->nerrors++;
+                break;
+            } /* end if */
+    } /* end for */
+
+    HDfree(buf);
+
+    return NULL;
+}
+
+void cleanup_dread(void)
+{
+    char name[32];
+    int n;
+
+    for(n = 0; n < NUM_FILES; n++) {
+        dread_filename(n, name, sizeof(name));
+        HDunlink(name);
+    } /* end for */
+}
+#endif /*H5_HAVE_THREADSAFE*/
+
@@ -34,6 +34,16 @@
 #define DSET1_DIM2   32
 #define DSET3_NAME   "dset3"
 
+/* Macros for vector I/O tests */
+#define VECTOR_NBLOCKS  9
+#define VECTOR_BLKSIZE  100
+#define VECTOR_GAP      50
+
+/* Macros for the asynchronous I/O VFD test */
+#define AIO_DSET_NAME   "aio_dset"
+#define AIO_CHUNK_DIM1  16
+#define AIO_CHUNK_DIM2  8
+
 /* Macros for Direct VFD */
 #ifdef H5_HAVE_DIRECT
 #define MBOUNDARY    512
@@ -55,6 +65,8 @@ const char *FILENAME[] = {
     "stdio_file",        /*7*/
     "windows_file",      /*8*/
     "new_multi_file_v16",/*9*/
+    "vector_file",       /*10*/
+    "aio_file",          /*11*/
     NULL
 };
 
@@ -1593,6 +1605,331 @@ error:
 }
 
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_drvr
+ *
+ * Purpose:     Writes and reads back a list of blocks with
+ *              H5FDwrite_vector() and H5FDread_vector() through the
+ *              driver set in FAPL.  The blocks are laid out as runs of
+ *              adjacent blocks separated by small and large holes, and
+ *              one block is read past the end of the written data.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_drvr(hid_t fapl)
+{
+    H5FD_t       *file = NULL;
+    char         filename[1024];
+    H5FD_mem_t   types[VECTOR_NBLOCKS + 1];
+    haddr_t      addrs[VECTOR_NBLOCKS + 1];
+    size_t       sizes[VECTOR_NBLOCKS + 1];
+    const void   *wbufs[VECTOR_NBLOCKS];
+    void         *rbufs[VECTOR_NBLOCKS + 1];
+    unsigned char wdata[VECTOR_NBLOCKS][VECTOR_BLKSIZE];
+    unsigned char rdata[VECTOR_NBLOCKS + 1][VECTOR_BLKSIZE];
+    haddr_t      end;
+    unsigned     u, v;
+    herr_t       ret;
+
+    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+
+    /* Three runs of three adjacent blocks, with a small hole before the
+     * second run and a large one before the third */
+    for(u = 0; u < VECTOR_NBLOCKS; u++) {
+        types[u] = H5FD_MEM_DRAW;
+        addrs[u] = (haddr_t)(u * VECTOR_BLKSIZE);
+        if(u >= 3)
+            addrs[u] += VECTOR_GAP;
+        if(u >= 6)
+            addrs[u] += 64 * KB;
+        sizes[u] = VECTOR_BLKSIZE;
+        for(v = 0; v < VECTOR_BLKSIZE; v++)
+            wdata[u][v] = (unsigned char)(u * 7 + v);
+        wbufs[u] = wdata[u];
+        rbufs[u] = rdata[u];
+    } /* end for */
+    end = addrs[VECTOR_NBLOCKS - 1] + VECTOR_BLKSIZE;
+
+    /* One more block, past the end of the data */
+    types[VECTOR_NBLOCKS] = H5FD_MEM_DRAW;
+    addrs[VECTOR_NBLOCKS] = end + 16 * KB;
+    sizes[VECTOR_NBLOCKS] = VECTOR_BLKSIZE;
+    rbufs[VECTOR_NBLOCKS] = rdata[VECTOR_NBLOCKS];
+
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF)))
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_DRAW, addrs[VECTOR_NBLOCKS] + VECTOR_BLKSIZE) < 0)
+        TEST_ERROR;
+
+    /* Write the blocks */
+    if(H5FDwrite_vector(file, H5P_DEFAULT, (size_t)VECTOR_NBLOCKS, types, addrs, sizes, wbufs) < 0)
+        TEST_ERROR;
+
+    /* Read them back, along with the block past the data */
+    HDmemset(rdata, 0xff, sizeof(rdata));
+    if(H5FDread_vector(file, H5P_DEFAULT, (size_t)(VECTOR_NBLOCKS + 1), types, addrs, sizes, rbufs) < 0)
+        TEST_ERROR;
+    for(u = 0; u < VECTOR_NBLOCKS; u++)
+        if(HDmemcmp(wdata[u], rdata[u], (size_t)VECTOR_BLKSIZE))
+            FAIL_PUTS_ERROR("vector read doesn't match vector write");
+    for(v = 0; v < VECTOR_BLKSIZE; v++)
+        if(rdata[VECTOR_NBLOCKS][v] != 0)
+            FAIL_PUTS_ERROR("data past the end of file not zero");
+
+    /* The hole between the first two runs must not have been written */
+    HDmemset(rdata[0], 0xff, (size_t)VECTOR_BLKSIZE);
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, addrs[2] + VECTOR_BLKSIZE, (size_t)VECTOR_GAP, rdata[0]) < 0)
+        TEST_ERROR;
+    for(v = 0; v < VECTOR_GAP; v++)
+        if(rdata[0][v] != 0)
+            FAIL_PUTS_ERROR("hole between blocks was written");
+
+    /* A plain read sees the same data */
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, addrs[4], (size_t)VECTOR_BLKSIZE, rdata[0]) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(wdata[4], rdata[0], (size_t)VECTOR_BLKSIZE))
+        FAIL_PUTS_ERROR("plain read doesn't match vector write");
+
+    /* Blocks past the EOA are rejected */
+    if(H5FDset_eoa(file, H5FD_MEM_DRAW, end) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5FDread_vector(file, H5P_DEFAULT, (size_t)(VECTOR_NBLOCKS + 1), types, addrs, sizes, rbufs);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("vector read past EOA succeeded");
+
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+    } H5E_END_TRY;
+    return -1;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests the vector read and write callbacks of the SEC2 and
+ *              CORE drivers
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    hid_t        fapl            = -1;
+
+    TESTING("vector I/O with SEC2 and CORE file drivers");
+
+    h5_reset();
+
+    fapl = h5_fileaccess();
+    if(H5Pset_fapl_sec2(fapl) < 0)
+        TEST_ERROR;
+    if(test_vector_io_drvr(fapl) < 0)
+        TEST_ERROR;
+    h5_cleanup(FILENAME, fapl);
+
+    h5_reset();
+
+    fapl = h5_fileaccess();
+    if(H5Pset_fapl_core(fapl, (size_t)CORE_INCREMENT, FALSE) < 0)
+        TEST_ERROR;
+    if(test_vector_io_drvr(fapl) < 0)
+        TEST_ERROR;
+    h5_cleanup(FILENAME, fapl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    return -1;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_aio
+ *
+ * Purpose:     Tests the asynchronous I/O driver: its file access
+ *              properties, vector reads and writes with and without
+ *              io_uring, and a chunked dataset whose chunks are read
+ *              with one vector read.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_aio(void)
+{
+#ifdef H5_HAVE_AIO
+    hid_t        file            = -1;
+    hid_t        fapl            = -1;
+    hid_t        access_fapl     = -1;
+    hid_t        dcpl            = -1;
+    hid_t        dapl            = -1;
+    hid_t        space           = -1;
+    hid_t        dset            = -1;
+    char         filename[1024];
+    int          *fhandle        = NULL;
+    hsize_t      dims[2]         = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t      chunk_dims[2]   = {AIO_CHUNK_DIM1, AIO_CHUNK_DIM2};
+    unsigned     queue_depth, nthreads, flags;
+    int          *points         = NULL;
+    int          *check          = NULL;
+    int          i;
+#endif /* H5_HAVE_AIO */
+
+    TESTING("AIO file driver");
+
+#ifndef H5_HAVE_AIO
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_AIO */
+
+    h5_reset();
+
+    /* Set property list and file name for AIO driver */
+    fapl = h5_fileaccess();
+    if(H5Pset_fapl_aio(fapl, 0, 2, 0) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[11], fapl, filename, sizeof filename);
+
+    /* Verify the file access properties */
+    if(H5Pget_fapl_aio(fapl, &queue_depth, &nthreads, &flags) < 0)
+        TEST_ERROR;
+    if(queue_depth != H5FD_AIO_QUEUE_DEPTH_DEF || nthreads != 2 || flags != 0)
+        TEST_ERROR;
+
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+
+    /* Retrieve the access property list... */
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if(H5FD_AIO != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+
+    /* ...and close the property list */
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    /* Check file handle API */
+    if(H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if(*fhandle < 0)
+        TEST_ERROR;
+
+    /* Write a chunked dataset and read it back without the chunk cache,
+     * which reads all the chunks with one vector read */
+    if(NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if(NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, AIO_DSET_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, AIO_DSET_NAME, dapl)) < 0)
+        TEST_ERROR;
+    HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        if(points[i] != check[i])
+            FAIL_PUTS_ERROR("chunked dataset read doesn't match write");
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+    if(H5Pclose(dapl) < 0)
+        TEST_ERROR;
+
+    /* Vector I/O, through io_uring where the kernel supports it... */
+    if(test_vector_io_drvr(fapl) < 0)
+        TEST_ERROR;
+    h5_cleanup(FILENAME, fapl);
+
+    /* ...and through threads */
+    h5_reset();
+
+    fapl = h5_fileaccess();
+    if(H5Pset_fapl_aio(fapl, 4, 3, H5FD_AIO_NO_URING) < 0)
+        TEST_ERROR;
+    if(test_vector_io_drvr(fapl) < 0)
+        TEST_ERROR;
+    h5_cleanup(FILENAME, fapl);
+
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(points)
+        HDfree(points);
+    if(check)
+        HDfree(check);
+    return -1;
+#endif /* H5_HAVE_AIO */
+}
+
+
 
 /*-------------------------------------------------------------------------
  * Function:    main
@@ -1624,6 +1961,8 @@ main(void)
     nerrors += test_log() < 0            ? 1 : 0;
     nerrors += test_stdio() < 0          ? 1 : 0;
     nerrors += test_windows() < 0        ? 1 : 0;
+    nerrors += test_vector_io() < 0      ? 1 : 0;
+    nerrors += test_aio() < 0            ? 1 : 0;
 
     if(nerrors) {
         printf("***** %d Virtual File Driver TEST%s FAILED! *****\n",
@@ -2637,22 +2637,263 @@ compress_readAll(void)
                 nerrors++;
             }
 
-        /* Writing to the compressed, chunked dataset in parallel should fail */
+        /* Change the data */
+        for(u=0; u<dim;u++)
+            data_orig[u]=2*u;
+
+        if(dxfer_coll_type == DXFER_INDEPENDENT_IO) {
+            /* Writing to the compressed, chunked dataset with independent
+             * I/O in parallel should fail */
+            H5E_BEGIN_TRY {
+                ret = H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, xfer_plist, data_orig);
+            } H5E_END_TRY;
+            VRFY((ret < 0), "H5Dwrite failed");
+        }
+        else {
+            /* Writing to the compressed, chunked dataset collectively
+             * should succeed */
+            ret = H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, xfer_plist, data_orig);
+            VRFY((ret >= 0), "H5Dwrite succeeded");
+
+            /* Read the data back */
+            HDmemset(data_read, 0, (size_t)dim*sizeof(DATATYPE));
+            ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, xfer_plist, data_read);
+            VRFY((ret >= 0), "H5Dread succeeded");
+
+            /* Verify data read */
+            for(u=0; u<dim; u++)
+                if(data_orig[u]!=data_read[u]) {
+                    printf("Line #%d: written!=retrieved: data_orig[%u]=%d, data_read[%u]=%d\n",__LINE__,
+                        (unsigned)u,data_orig[u],(unsigned)u,data_read[u]);
+                    nerrors++;
+                }
+        }
+
+        ret = H5Pclose(xfer_plist);
+        VRFY((ret >= 0), "H5Pclose succeeded");
+        ret = H5Dclose(dataset);
+        VRFY((ret >= 0), "H5Dclose succeeded");
+    } /* end if */
+
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* release data buffers */
+    if(data_read) HDfree(data_read);
+    if(data_orig) HDfree(data_orig);
+}
+
+/*
+ * Example of using the parallel HDF5 library to write a compressed
+ * dataset in an HDF5 file with collective parallel access support.
+ * Every chunk is shared by several processes.  The dataset is written
+ * once with each process selecting every mpi_size'th element, then
+ * partially overwritten, read back and verified.  This is done for a
+ * dataset created in parallel, with all its chunks allocated, and for one
+ * created serially, whose unwritten chunks don't exist yet.
+ */
+void
+compress_writeAll(void)
+{
+    hid_t fid;                  /* HDF5 file ID */
+    hid_t acc_tpl;		/* File access templates */
+    hid_t dcpl;                 /* Dataset creation property list */
+    hid_t xfer_plist;		/* Dataset transfer properties list */
+    hid_t file_dataspace;	/* File dataspace ID */
+    hid_t mem_dataspace;	/* memory dataspace ID */
+    hid_t dataset;		/* Dataset ID */
+    const char *dset_names[2] = {"compressed_data_early", "compressed_data_incr"};
+    int rank=1;                 /* Dataspace rank */
+    hsize_t dim;                /* Dataspace dimensions */
+    hsize_t chunk_dim;          /* Chunk dimensions */
+    hsize_t start, count, stride, block; /* for hyperslab setting */
+    hsize_t npoints;            /* Number of elements written by this process */
+    int fill = -1;              /* Fill value */
+    unsigned u;                 /* Local index variable */
+    int i, j;                   /* Local index variables */
+    DATATYPE *data_write = NULL; /* data buffer */
+    DATATYPE *data_read = NULL;	/* data buffer */
+    DATATYPE *data_orig = NULL; /* expected data buffer */
+    const char *filename;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Info info = MPI_INFO_NULL;
+    int mpi_size, mpi_rank;
+    herr_t ret;         	/* Generic return value */
+
+    filename = GetTestParameters();
+    if(VERBOSE_MED)
+	printf("Collective compressed dataset write test on file %s\n", filename);
+
+    /* Retrieve MPI parameters */
+    MPI_Comm_size(comm,&mpi_size);
+    MPI_Comm_rank(comm,&mpi_rank);
+
+    /* Leave the last few chunks unwritten, and make the last one partial */
+    dim = (hsize_t)(64 * mpi_size + 100);
+    chunk_dim = 24;
+
+    /* Allocate data buffers */
+    data_write = (DATATYPE *)HDmalloc((size_t)dim*sizeof(DATATYPE));
+    VRFY((data_write != NULL), "data_write HDmalloc succeeded");
+    data_read = (DATATYPE *)HDmalloc((size_t)dim*sizeof(DATATYPE));
+    VRFY((data_read != NULL), "data_read HDmalloc succeeded");
+    data_orig = (DATATYPE *)HDmalloc((size_t)dim*sizeof(DATATYPE));
+    VRFY((data_orig != NULL), "data_orig HDmalloc succeeded");
+
+    /* Create property list for chunking and compression */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl > 0), "H5Pcreate succeeded");
+    ret = H5Pset_chunk(dcpl, rank, &chunk_dim);
+    VRFY((ret >= 0), "H5Pset_chunk succeeded");
+    ret = H5Pset_deflate(dcpl, 6);
+    VRFY((ret >= 0), "H5Pset_deflate succeeded");
+    ret = H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill);
+    VRFY((ret >= 0), "H5Pset_fill_value succeeded");
+    ret = H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_INCR);
+    VRFY((ret >= 0), "H5Pset_alloc_time succeeded");
+
+    file_dataspace = H5Screate_simple(rank, &dim, NULL);
+    VRFY((file_dataspace > 0), "H5Screate_simple succeeded");
+
+    /* Process zero creates the file with a dataset whose chunks are only
+     * allocated when they are written (datasets created in parallel
+     * always allocate all their chunks) */
+    if(mpi_rank==0) {
+        fid = H5Fcreate(h5_rmprefix(filename), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((fid > 0), "H5Fcreate succeeded");
+        dataset = H5Dcreate2(fid, dset_names[1], H5T_NATIVE_INT, file_dataspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        VRFY((dataset > 0), "H5Dcreate2 succeeded");
+        ret = H5Dclose(dataset);
+        VRFY((ret >= 0), "H5Dclose succeeded");
+        ret = H5Fclose(fid);
+        VRFY((ret >= 0), "H5Fclose succeeded");
+    }
+
+    /* Wait for file to be created */
+    MPI_Barrier(comm);
+
+    /* setup file access template */
+    acc_tpl = create_faccess_plist(comm, info, facc_type);
+    VRFY((acc_tpl >= 0), "");
+
+    /* open the file collectively */
+    fid = H5Fopen(filename, H5F_ACC_RDWR, acc_tpl);
+    VRFY((fid > 0), "H5Fopen succeeded");
+
+    /* Release file-access template */
+    ret = H5Pclose(acc_tpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* Create the other dataset collectively */
+    dataset = H5Dcreate2(fid, dset_names[0], H5T_NATIVE_INT, file_dataspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    VRFY((dataset > 0), "H5Dcreate2 succeeded");
+    ret = H5Dclose(dataset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Pclose(dcpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* Create dataset transfer property list */
+    xfer_plist = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((xfer_plist > 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(xfer_plist, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+    for(j=0; j<2; j++) {
+        dataset = H5Dopen2(fid, dset_names[j], H5P_DEFAULT);
+        VRFY((dataset > 0), "H5Dopen2 succeeded");
+
+        /* Expected contents of the dataset */
+        for(u=0; u<dim; u++)
+            data_orig[u] = fill;
+
+        /* Each process writes every mpi_size'th element of the first
+         * 64*mpi_size elements, so all processes share every chunk written */
+        start = (hsize_t)mpi_rank;
+        stride = (hsize_t)mpi_size;
+        count = 64;
+        block = 1;
+        ret = H5Sselect_hyperslab(file_dataspace, H5S_SELECT_SET, &start, &stride, &count, &block);
+        VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+        npoints = count;
+        mem_dataspace = H5Screate_simple(rank, &npoints, NULL);
+        VRFY((mem_dataspace > 0), "H5Screate_simple succeeded");
+
+        for(u=0; u<count; u++)
+            data_write[u] = (DATATYPE)(u*(unsigned)mpi_size + (unsigned)mpi_rank);
+        for(u=0; u<64*(unsigned)mpi_size; u++)
+            data_orig[u] = (DATATYPE)u;
+
+        ret = H5Dwrite(dataset, H5T_NATIVE_INT, mem_dataspace, file_dataspace, xfer_plist, data_write);
+        VRFY((ret >= 0), "H5Dwrite succeeded");
+        ret = H5Sclose(mem_dataspace);
+        VRFY((ret >= 0), "H5Sclose succeeded");
+
+        /* Each process overwrites a few elements of its own block of 64
+         * elements and process 0 writes a few elements of a chunk that
+         * wasn't written yet */
+        start = (hsize_t)(64 * mpi_rank + 10);
+        count = 20;
+        ret = H5Sselect_hyperslab(file_dataspace, H5S_SELECT_SET, &start, NULL, &count, NULL);
+        VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+        if(mpi_rank == 0) {
+            start = dim - 3;
+            count = 2;
+            ret = H5Sselect_hyperslab(file_dataspace, H5S_SELECT_OR, &start, NULL, &count, NULL);
+            VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+        }
+        npoints = (hsize_t)H5Sget_select_npoints(file_dataspace);
+        mem_dataspace = H5Screate_simple(rank, &npoints, NULL);
+        VRFY((mem_dataspace > 0), "H5Screate_simple succeeded");
+
+        for(u=0; u<npoints; u++)
+            data_write[u] = -1000 - mpi_rank*100 - (int)u;
+        for(i=0; i<mpi_size; i++)
+            for(u=0; u<20; u++)
+                data_orig[64*i + 10 + (int)u] = -1000 - i*100 - (int)u;
+        data_orig[dim - 3] = -1000 - 20;
+        data_orig[dim - 2] = -1000 - 21;
+
+        ret = H5Dwrite(dataset, H5T_NATIVE_INT, mem_dataspace, file_dataspace, xfer_plist, data_write);
+        VRFY((ret >= 0), "H5Dwrite succeeded");
+        ret = H5Sclose(mem_dataspace);
+        VRFY((ret >= 0), "H5Sclose succeeded");
+
+        /* Read the whole dataset back */
+        HDmemset(data_read, 0, (size_t)dim*sizeof(DATATYPE));
+        ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, xfer_plist, data_read);
+        VRFY((ret >= 0), "H5Dread succeeded");
+
+        /* Verify data read */
+        for(u=0; u<dim; u++)
+            if(data_orig[u]!=data_read[u]) {
+                printf("Line #%d: written!=retrieved: data_orig[%u]=%d, data_read[%u]=%d\n",__LINE__,
+                    (unsigned)u,data_orig[u],(unsigned)u,data_read[u]);
+                nerrors++;
+            }
+
+        /* Writing to the compressed dataset independently should fail */
+        ret = H5Pset_dxpl_mpio(xfer_plist, H5FD_MPIO_INDEPENDENT);
+        VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
         H5E_BEGIN_TRY {
             ret = H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, xfer_plist, data_read);
         } H5E_END_TRY;
         VRFY((ret < 0), "H5Dwrite failed");
+        ret = H5Pset_dxpl_mpio(xfer_plist, H5FD_MPIO_COLLECTIVE);
+        VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
 
-        ret = H5Pclose(xfer_plist);
-        VRFY((ret >= 0), "H5Pclose succeeded");
         ret = H5Dclose(dataset);
         VRFY((ret >= 0), "H5Dclose succeeded");
-    } /* end if */
+    } /* end for */
 
+    ret = H5Sclose(file_dataspace);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Pclose(xfer_plist);
+    VRFY((ret >= 0), "H5Pclose succeeded");
     ret = H5Fclose(fid);
     VRFY((ret >= 0), "H5Fclose succeeded");
 
     /* release data buffers */
+    if(data_write) HDfree(data_write);
     if(data_read) HDfree(data_read);
     if(data_orig) HDfree(data_orig);
 }
@@ -4354,6 +4595,176 @@ dataset_atomicity(void)
 
 }
 
+/*
+ * Example of using the parallel HDF5 library to write and read several
+ * datasets with one collective call each.  Every process writes its own
+ * block of three contiguous datasets and one chunked dataset, then both
+ * halves of its block of a fourth dataset, listed twice.  All the datasets
+ * are then read back whole by every process and verified.
+ */
+void
+multi_dset_rwAll(void)
+{
+    hid_t fid;                  /* HDF5 file ID */
+    hid_t acc_tpl;		/* File access templates */
+    hid_t dcpl;                 /* Dataset creation property list */
+    hid_t xfer_plist;		/* Dataset transfer properties list */
+    hid_t file_dataspace;	/* File dataspace ID */
+    hid_t mem_dataspace;	/* memory dataspace ID */
+    hid_t half_dataspace;	/* File dataspace for the second half of a block */
+    hid_t dsets[4];             /* Dataset IDs */
+    hid_t twice[2];             /* The last dataset, listed twice */
+    hid_t mtypes[4];            /* Memory datatypes */
+    hid_t mspaces[4];           /* Memory dataspaces */
+    hid_t fspaces[4];           /* File dataspaces */
+    const void *wbufs[4];       /* Buffers to write */
+    void *rbufs[4];             /* Buffers to read into */
+    const char *dset_names[4] = {"multi_contig_1", "multi_contig_2", "multi_chunked", "multi_twice"};
+    hsize_t dim;                /* Dataspace dimensions */
+    hsize_t block;              /* Elements written by each process */
+    hsize_t start, count;       /* for hyperslab setting */
+    int i, j;                   /* Local index variables */
+    DATATYPE *data_write = NULL; /* data buffer */
+    DATATYPE *data_read = NULL;	/* data buffer */
+    const char *filename;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Info info = MPI_INFO_NULL;
+    int mpi_size, mpi_rank;
+    herr_t ret;         	/* Generic return value */
+
+    filename = GetTestParameters();
+    if(VERBOSE_MED)
+	printf("Collective multi-dataset write and read test on file %s\n", filename);
+
+    /* Retrieve MPI parameters */
+    MPI_Comm_size(comm,&mpi_size);
+    MPI_Comm_rank(comm,&mpi_rank);
+
+    block = 64;
+    dim = block * (hsize_t)mpi_size;
+
+    /* Allocate data buffers: each process's block of each dataset, and
+     * whole datasets */
+    data_write = (DATATYPE *)HDmalloc(4 * (size_t)block * sizeof(DATATYPE));
+    VRFY((data_write != NULL), "data_write HDmalloc succeeded");
+    data_read = (DATATYPE *)HDmalloc(4 * (size_t)dim * sizeof(DATATYPE));
+    VRFY((data_read != NULL), "data_read HDmalloc succeeded");
+    for(i = 0; i < 4; i++)
+        for(j = 0; j < (int)block; j++)
+            data_write[i * (int)block + j] = (i + 1) * 100000 + mpi_rank * (int)block + j;
+
+    /* setup file access template */
+    acc_tpl = create_faccess_plist(comm, info, facc_type);
+    VRFY((acc_tpl >= 0), "");
+
+    /* create the file collectively */
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, acc_tpl);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+    ret = H5Pclose(acc_tpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* Create the datasets */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl > 0), "H5Pcreate succeeded");
+    ret = H5Pset_chunk(dcpl, 1, &block);
+    VRFY((ret >= 0), "H5Pset_chunk succeeded");
+    file_dataspace = H5Screate_simple(1, &dim, NULL);
+    VRFY((file_dataspace > 0), "H5Screate_simple succeeded");
+    for(i = 0; i < 4; i++) {
+        dsets[i] = H5Dcreate2(fid, dset_names[i], H5T_NATIVE_INT, file_dataspace, H5P_DEFAULT,
+                (i == 2 ? dcpl : H5P_DEFAULT), H5P_DEFAULT);
+        VRFY((dsets[i] > 0), "H5Dcreate2 succeeded");
+    }
+
+    xfer_plist = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((xfer_plist >= 0), "H5Pcreate xfer succeeded");
+    ret = H5Pset_dxpl_mpio(xfer_plist, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+    if(dxfer_coll_type == DXFER_INDEPENDENT_IO) {
+        ret = H5Pset_dxpl_mpio_collective_opt(xfer_plist, H5FD_MPIO_INDIVIDUAL_IO);
+        VRFY((ret >= 0), "set independent IO collectively succeeded");
+    }
+
+    /* Write this process's block of the first three datasets at once */
+    start = (hsize_t)mpi_rank * block;
+    count = block;
+    ret = H5Sselect_hyperslab(file_dataspace, H5S_SELECT_SET, &start, NULL, &count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    mem_dataspace = H5Screate_simple(1, &block, NULL);
+    VRFY((mem_dataspace > 0), "H5Screate_simple succeeded");
+    for(i = 0; i < 3; i++) {
+        mtypes[i] = H5T_NATIVE_INT;
+        mspaces[i] = mem_dataspace;
+        fspaces[i] = file_dataspace;
+        wbufs[i] = data_write + i * (int)block;
+    }
+    ret = H5Dwrite_multi((size_t)3, dsets, mtypes, mspaces, fspaces, xfer_plist, wbufs);
+    VRFY((ret >= 0), "H5Dwrite_multi succeeded");
+
+    /* Write the two halves of this process's block of the last dataset,
+     * listing it twice */
+    count = block / 2;
+    ret = H5Sselect_hyperslab(file_dataspace, H5S_SELECT_SET, &start, NULL, &count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    half_dataspace = H5Scopy(file_dataspace);
+    VRFY((half_dataspace > 0), "H5Scopy succeeded");
+    start += block / 2;
+    ret = H5Sselect_hyperslab(half_dataspace, H5S_SELECT_SET, &start, NULL, &count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    ret = H5Sclose(mem_dataspace);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    mem_dataspace = H5Screate_simple(1, &count, NULL);
+    VRFY((mem_dataspace > 0), "H5Screate_simple succeeded");
+    mspaces[0] = mspaces[1] = mem_dataspace;
+    fspaces[0] = file_dataspace;
+    fspaces[1] = half_dataspace;
+    wbufs[0] = data_write + 3 * (int)block;
+    wbufs[1] = data_write + 3 * (int)block + (int)count;
+    twice[0] = twice[1] = dsets[3];
+    ret = H5Dwrite_multi((size_t)2, twice, mtypes, mspaces, fspaces, xfer_plist, wbufs);
+    VRFY((ret >= 0), "H5Dwrite_multi succeeded");
+
+    /* Read all the datasets back whole */
+    HDmemset(data_read, 0, 4 * (size_t)dim * sizeof(DATATYPE));
+    for(i = 0; i < 4; i++) {
+        mtypes[i] = H5T_NATIVE_INT;
+        mspaces[i] = H5S_ALL;
+        fspaces[i] = H5S_ALL;
+        rbufs[i] = data_read + i * (int)dim;
+    }
+    ret = H5Dread_multi((size_t)4, dsets, mtypes, mspaces, fspaces, xfer_plist, rbufs);
+    VRFY((ret >= 0), "H5Dread_multi succeeded");
+    for(i = 0; i < 4; i++)
+        for(j = 0; j < (int)dim; j++)
+            if(data_read[i * (int)dim + j] != (i + 1) * 100000 + j) {
+                if(MAINPROCESS)
+                    printf("Dataset %s, element %d: read %d, expected %d\n", dset_names[i], j,
+                           data_read[i * (int)dim + j], (i + 1) * 100000 + j);
+                nerrors++;
+                break;
+            }
+
+    for(i = 0; i < 4; i++) {
+        ret = H5Dclose(dsets[i]);
+        VRFY((ret >= 0), "H5Dclose succeeded");
+    }
+    ret = H5Sclose(half_dataspace);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Sclose(mem_dataspace);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Sclose(file_dataspace);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Pclose(xfer_plist);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(dcpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    HDfree(data_write);
+    HDfree(data_read);
+}
+
 /* Function: dense_attr_test
  *
  * Purpose: Test cases for writing dense attributes in parallel
@@ -363,6 +363,8 @@ int main(int argc, char **argv)
 	    "dataset collective write", PARATESTFILE);
     AddTest("cdsetr", dataset_readAll, NULL,
 	    "dataset collective read", PARATESTFILE);
+    AddTest("mdsetrw", multi_dset_rwAll, NULL,
+	    "multi-dataset collective write and read", PARATESTFILE);
 
     AddTest("eidsetw", extend_writeInd, NULL,
 	    "extendible dataset independent write", PARATESTFILE);
@@ -384,6 +386,8 @@ int main(int argc, char **argv)
 #ifdef H5_HAVE_FILTER_DEFLATE
     AddTest("cmpdsetr", compress_readAll, NULL,
 	    "compressed dataset collective read", PARATESTFILE);
+    AddTest("cmpdsetw", compress_writeAll, NULL,
+	    "compressed dataset collective write", PARATESTFILE);
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
     AddTest("zerodsetr", zero_dim_dset, NULL,
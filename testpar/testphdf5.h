@@ -254,6 +254,7 @@ void extend_writeInd2(void);
 void extend_writeAll(void);
 void dataset_readInd(void);
 void dataset_readAll(void);
+void multi_dset_rwAll(void);
 void extend_readInd(void);
 void extend_readAll(void);
 void none_selection_chunk(void);
@@ -292,6 +293,7 @@ void checker_board_hyperslab_dr_pio_test(ShapeSameTestMethods sstest_type);
 void file_image_daisy_chain_test(void);
 #ifdef H5_HAVE_FILTER_DEFLATE
 void compress_readAll(void);
+void compress_writeAll(void);
 #endif /* H5_HAVE_FILTER_DEFLATE */
 void test_dense_attr(void);
 
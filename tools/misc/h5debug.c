@@ -161,6 +161,14 @@ get_H5EA_class(const uint8_t *sig)
             cls = H5EA_CLS_TEST;
             break;
 
+        case H5EA_CLS_CHUNK_ID:
+            cls = H5EA_CLS_CHUNK;
+            break;
+
+        case H5EA_CLS_FILT_CHUNK_ID:
+            cls = H5EA_CLS_FILT_CHUNK;
+            break;
+
         case H5EA_NUM_CLS_ID:
         default:
             HDfprintf(stderr, "Unknown extensible array class %u\n", (unsigned)(clsid));
@@ -197,6 +205,14 @@ get_H5FA_class(const uint8_t *sig)
             cls = H5FA_CLS_TEST;
             break;
 
+        case H5FA_CLS_CHUNK_ID:
+            cls = H5FA_CLS_CHUNK;
+            break;
+
+        case H5FA_CLS_FILT_CHUNK_ID:
+            cls = H5FA_CLS_FILT_CHUNK;
+            break;
+
         case H5FA_NUM_CLS_ID: 
         default:
             HDfprintf(stderr, "Unknown fixed array class %u\n", (unsigned)(clsid));